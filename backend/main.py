@@ -27,6 +27,19 @@ import serial.tools.list_ports
 import os
 import threading
 
+# Native forest (backend/native) for the prediction hot path
+try:
+    from native.solar_forest import load_native_forest, NativeForestError, DEFAULT_BLOB as NATIVE_BLOB
+    NATIVE_AVAILABLE = True
+except ImportError:
+    NATIVE_AVAILABLE = False
+
+# "auto" uses the native forest when its features and classes match the
+# sklearn model, "native" also uses it without sklearn installed, "sklearn"
+# never does. A blob that differs from a loaded sklearn model is refused in
+# both modes, since fault_index is the sklearn class index
+INFERENCE_MODE = os.environ.get("SOLAR_INFERENCE", "auto")
+
 # pywhatkit for WhatsApp (uses WhatsApp Web)
 try:
     import pywhatkit as pwk
@@ -83,6 +96,9 @@ class PredictionResponse(BaseModel):
     efficiency: float
     timestamp: str
     recommendation: Optional[str] = None
+    # Confidence points each feature added to (or took from) the predicted
+    # fault; faults from the native forest only
+    explanation: Optional[Dict[str, float]] = None
 
 class WiFiNetwork(BaseModel):
     ssid: str
@@ -118,6 +134,7 @@ class AppState:
         self.model = None
         self.scaler = None
         self.label_encoder = None
+        self.native_forest = None
         self.model_loaded = False
         self.connection_mode = "simulator"
         self.serial_connection = None
@@ -142,16 +159,52 @@ class AppState:
     def load_model(self):
         base_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
         models_dir = os.path.join(base_dir, 'models')
+        sklearn_loaded = False
         try:
             self.model = joblib.load(os.path.join(models_dir, 'solar_fault_rf_model.joblib'))
             self.scaler = joblib.load(os.path.join(models_dir, 'solar_fault_scaler.joblib'))
             self.label_encoder = joblib.load(os.path.join(models_dir, 'solar_fault_label_encoder.joblib'))
-            self.model_loaded = True
+            sklearn_loaded = True
             print("✅ Model loaded successfully")
             print(f"   Classes: {list(self.label_encoder.classes_)}")
         except Exception as e:
             print(f"❌ Failed to load model: {e}")
-            self.model_loaded = False
+        self.load_native_forest(sklearn_loaded)
+        self.model_loaded = sklearn_loaded or self.native_forest is not None
+
+    def load_native_forest(self, sklearn_loaded: bool):
+        """Use the native forest blob for predictions when it is the sklearn model's forest."""
+        if INFERENCE_MODE == "sklearn" or not NATIVE_AVAILABLE:
+            return
+        if INFERENCE_MODE == "auto" and not sklearn_loaded:
+            return
+        forest, error = load_native_forest(os.environ.get("SOLAR_FOREST_BLOB", NATIVE_BLOB))
+        if forest is None:
+            print(f"⚠️ Native forest not loaded: {error}")
+            return
+        mismatch = self.native_forest_mismatch(forest, sklearn_loaded)
+        if mismatch:
+            print(f"❌ Native forest refused: {mismatch}, using sklearn")
+            return
+        self.native_forest = forest
+        print(f"✅ Native forest loaded (model version {forest.model_version})")
+        print(f"   Features: {forest.feature_names}")
+        if not sklearn_loaded:
+            print("⚠️ sklearn model not loaded, native classes not checked against it")
+
+    def native_forest_mismatch(self, forest, sklearn_loaded: bool) -> Optional[str]:
+        """Why the blob is not the forest of the sklearn model, or None."""
+        if sorted(forest.feature_names) != sorted(SKLEARN_FEATURES):
+            return f"features {forest.feature_names} differ from {SKLEARN_FEATURES}"
+        if not sklearn_loaded:
+            return None
+        n_features = getattr(self.model, "n_features_in_", len(SKLEARN_FEATURES))
+        if len(forest.feature_names) != n_features:
+            return f"{len(forest.feature_names)} features, the sklearn model has {n_features}"
+        classes = [str(name) for name in self.label_encoder.classes_]
+        if list(forest.class_names) != classes:
+            return f"classes {forest.class_names} differ from the sklearn model's {classes}"
+        return None
 
 state = AppState()
 
@@ -355,45 +408,84 @@ def calculate_efficiency(voltage: float, current: float, light: float) -> float:
         return round(min(25, max(0, efficiency)), 2)
     return 0.0
 
-def predict_fault(data: SensorData) -> PredictionResponse:
-    """Make fault prediction using the ML model."""
+# Request value for each model feature name
+MODEL_FEATURES = {
+    "Voltage": lambda data, efficiency: data.voltage,
+    "Current": lambda data, efficiency: data.current,
+    "Temperature": lambda data, efficiency: data.temperature,
+    "Light_Intensity": lambda data, efficiency: data.light_intensity,
+    "Efficiency": lambda data, efficiency: efficiency,
+}
+SKLEARN_FEATURES = ["Voltage", "Current", "Temperature", "Light_Intensity", "Efficiency"]
+
+def explain_fault(contributions, index) -> Dict[str, float]:
+    """Per-feature contribution to the predicted class, in confidence points."""
+    return {name: round(values[index] * 100, 2) for name, values in contributions.items()}
+
+def predict_faults(items: List[SensorData]) -> List[PredictionResponse]:
+    """Make fault predictions for a batch of readings in one model call."""
     if not state.model_loaded:
         raise HTTPException(status_code=500, detail="Model not loaded")
+    if not items:
+        return []
     
     # Calculate efficiency if not provided
-    efficiency = data.efficiency
-    if efficiency is None:
-        efficiency = calculate_efficiency(data.voltage, data.current, data.light_intensity)
-    
-    # Prepare features (now includes efficiency)
-    features = np.array([[
-        data.voltage, 
-        data.current, 
-        data.temperature, 
-        data.light_intensity,
-        efficiency
-    ]])
-    features_scaled = state.scaler.transform(features)
-    
-    prediction = state.model.predict(features_scaled)[0]
-    proba = state.model.predict_proba(features_scaled)[0]
-    
-    fault_type = state.label_encoder.inverse_transform([prediction])[0]
-    confidence = float(max(proba) * 100)
-    
-    # Get recommendation
-    rec = FAULT_RECOMMENDATIONS.get(fault_type, FAULT_RECOMMENDATIONS["Normal"])
-    
-    return PredictionResponse(
-        fault_type=fault_type,
-        fault_index=int(prediction),
-        confidence=confidence,
-        is_fault=(fault_type != "Normal"),
-        power=round(data.voltage * data.current, 2),
-        efficiency=efficiency,
-        timestamp=datetime.now().isoformat(),
-        recommendation=rec["action"]
-    )
+    efficiencies = [
+        data.efficiency if data.efficiency is not None
+        else calculate_efficiency(data.voltage, data.current, data.light_intensity)
+        for data in items
+    ]
+    
+    if state.native_forest is not None:
+        forest = state.native_forest
+        rows = [[MODEL_FEATURES[name](data, eff) for name in forest.feature_names]
+                for data, eff in zip(items, efficiencies)]
+        # Attributions come from the same traversal as the classes
+        try:
+            indices, probas, contributions = forest.predict_batch(rows, explain=True)
+        except NativeForestError:
+            # Blob exported without split distributions
+            indices, probas = forest.predict_batch(rows)
+            contributions = [None] * len(rows)
+        fault_types = [forest.class_names[i] for i in indices]
+        confidences = [max(p) * 100 for p in probas]
+        explanations = [explain_fault(c, i) if c is not None and fault_type != "Normal" else None
+                        for c, i, fault_type in zip(contributions, indices, fault_types)]
+    else:
+        # Prepare features (now includes efficiency)
+        features = np.array([[MODEL_FEATURES[name](data, eff) for name in SKLEARN_FEATURES]
+                             for data, eff in zip(items, efficiencies)])
+        features_scaled = state.scaler.transform(features)
+        
+        # predict() is the argmax of predict_proba(), so one pass gives both
+        proba = state.model.predict_proba(features_scaled)
+        indices = state.model.classes_[proba.argmax(axis=1)]
+        fault_types = state.label_encoder.inverse_transform(indices)
+        confidences = proba.max(axis=1) * 100
+        explanations = [None] * len(items)
+    
+    timestamp = datetime.now().isoformat()
+    responses = []
+    for data, eff, index, fault_type, confidence, explanation in zip(
+            items, efficiencies, indices, fault_types, confidences, explanations):
+        # Get recommendation
+        rec = FAULT_RECOMMENDATIONS.get(fault_type, FAULT_RECOMMENDATIONS["Normal"])
+        responses.append(PredictionResponse(
+            fault_type=str(fault_type),
+            fault_index=int(index),
+            confidence=float(confidence),
+            is_fault=(fault_type != "Normal"),
+            power=round(data.voltage * data.current, 2),
+            efficiency=eff,
+            timestamp=timestamp,
+            recommendation=rec["action"],
+            explanation=explanation
+        ))
+    return responses
+
+def predict_fault(data: SensorData) -> PredictionResponse:
+    """Make fault prediction using the ML model."""
+    return predict_faults([data])[0]
 
 # =============================================================================
 # REST ENDPOINTS
@@ -406,6 +498,7 @@ async def root():
 async def get_status():
     return {
         "model_loaded": state.model_loaded,
+        "inference_engine": "native" if state.native_forest is not None else "sklearn",
         "connection_mode": state.connection_mode,
         "is_monitoring": state.is_monitoring,
         "connected_clients": len(state.connected_clients),
@@ -440,25 +533,24 @@ async def receive_gateway_data(records: List[GatewayRecord]):
     """
     processed_count = 0
     
-    for record in records:
-        if not record.valid:
-            continue
-            
-        # Convert to standard SensorData
-        # Calculate efficiency dynamically
-        efficiency = calculate_efficiency(record.voltage, record.current, float(record.ldrValue))
-        
-        sensor_data = SensorData(
+    # Convert to standard SensorData
+    valid_records = [record for record in records if record.valid]
+    readings = [
+        SensorData(
             voltage=record.voltage,
             current=record.current,
             temperature=record.dhtTemp,
             light_intensity=float(record.ldrValue),
-            efficiency=efficiency
+            # Calculate efficiency dynamically
+            efficiency=calculate_efficiency(record.voltage, record.current, float(record.ldrValue))
         )
-        
-        # Run Prediction
-        prediction = predict_fault(sensor_data)
-        
+        for record in valid_records
+    ]
+    
+    # Run Prediction for the whole payload at once
+    predictions = predict_faults(readings)
+    
+    for record, sensor_data, prediction in zip(valid_records, readings, predictions):
         # Send WhatsApp if fault detected (and enabled)
         if prediction.is_fault:
             await send_whatsapp_notification(
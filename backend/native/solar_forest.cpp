@@ -0,0 +1,139 @@
+/*
+ * Solar Panel Fault Detection - Native Inference Library
+ *
+ * C ABI over forest_blob.h / forest_blob_loader.h, see solar_forest.h.
+ *
+ * Build (from backend/native/):
+ *   g++ -O2 -std=c++11 -shared -fPIC -fvisibility=hidden -I../../models \
+ *       solar_forest.cpp -o libsolar_forest.so
+ */
+
+#include "solar_forest.h"
+#include "forest_blob_loader.h"
+
+struct SolarForest {
+    ForestSlot slot;
+};
+
+static ForestModelPtr load_blob(const char* path, int* status) {
+    ForestBlobStatus result;
+#if defined(__unix__) || defined(__APPLE__)
+    ForestModelPtr model = forest_blob_map_file(path, &result);
+#else
+    ForestModelPtr model = forest_blob_read_path(path, &result);
+#endif
+    if (status) *status = result;
+    return model;
+}
+
+SolarForest* solar_forest_open(const char* path, int* status) {
+    ForestModelPtr model = load_blob(path, status);
+    if (!model) return NULL;
+    SolarForest* forest = new (std::nothrow) SolarForest();
+    if (!forest) {
+        if (status) *status = FOREST_BLOB_NO_MEMORY;
+        return NULL;
+    }
+    forest_slot_swap(&forest->slot, model);
+    return forest;
+}
+
+void solar_forest_close(SolarForest* forest) {
+    delete forest;
+}
+
+int solar_forest_reload(SolarForest* forest, const char* path) {
+    int status;
+    ForestModelPtr model = load_blob(path, &status);
+    if (!model) return status;
+    // Buffers sized for the current model must stay large enough
+    ForestModelPtr current = forest_slot_get(&forest->slot);
+    if (model->blob.forest.num_features != current->blob.forest.num_features ||
+        model->blob.forest.num_classes != current->blob.forest.num_classes) {
+        return SOLAR_FOREST_SHAPE_CHANGED;
+    }
+    forest_slot_swap(&forest->slot, model);
+    return status;
+}
+
+const char* solar_forest_error(int status) {
+    if (status == SOLAR_FOREST_SHAPE_CHANGED) return "different number of features or classes";
+    return forest_blob_error((ForestBlobStatus)status);
+}
+
+int solar_forest_num_features(const SolarForest* forest) {
+    return forest_slot_get(&forest->slot)->blob.forest.num_features;
+}
+
+int solar_forest_num_classes(const SolarForest* forest) {
+    return forest_slot_get(&forest->slot)->blob.forest.num_classes;
+}
+
+// Names stay valid while this blob is loaded
+const char* solar_forest_class_name(const SolarForest* forest, int index) {
+    ForestModelPtr model = forest_slot_get(&forest->slot);
+    return index >= 0 && index < model->blob.forest.num_classes ? model->blob.class_names[index] : NULL;
+}
+
+const char* solar_forest_feature_name(const SolarForest* forest, int index) {
+    ForestModelPtr model = forest_slot_get(&forest->slot);
+    return index >= 0 && index < model->blob.forest.num_features ? model->blob.feature_names[index] : NULL;
+}
+
+uint32_t solar_forest_model_version(const SolarForest* forest) {
+    return forest_slot_get(&forest->slot)->blob.model_version;
+}
+
+int solar_forest_predict(const SolarForest* forest, const float* features, float* proba) {
+    ForestModelPtr model = forest_slot_get(&forest->slot);
+    float scratch[FOREST_MAX_CLASSES];
+    return forest_blob_predict_proba(&model->blob, features, proba ? proba : scratch);
+}
+
+size_t solar_forest_predict_batch(const SolarForest* forest, const float* features,
+                                  size_t count, int32_t* classes, float* proba, float* contributions) {
+    ForestModelPtr model = forest_slot_get(&forest->slot);
+    int num_features = model->blob.forest.num_features;
+    int num_classes = model->blob.forest.num_classes;
+    if (contributions && !model->blob.node_proba) return 0;
+    float scratch[FOREST_MAX_CLASSES];
+    for (size_t i = 0; i < count; i++) {
+        const float* row = features + i * num_features;
+        if (!contributions) {
+            classes[i] = forest_blob_predict_proba(&model->blob, row, proba ? proba + i * num_classes : scratch);
+            continue;
+        }
+        ForestExplanation explanation;
+        classes[i] = forest_blob_predict_explain(&model->blob, row, &explanation);
+        float* out = contributions + i * num_features * num_classes;
+        for (int f = 0; f < num_features; f++) {
+            for (int c = 0; c < num_classes; c++) {
+                out[f * num_classes + c] = explanation.contributions[f][c];
+            }
+        }
+        for (int c = 0; proba && c < num_classes; c++) {
+            proba[i * num_classes + c] = explanation.score[c];
+        }
+    }
+    return count;
+}
+
+int solar_forest_explain(const SolarForest* forest, const float* features, float* proba,
+                         float* contributions, float* bias) {
+    ForestModelPtr model = forest_slot_get(&forest->slot);
+    ForestExplanation explanation;
+    int predicted_class = forest_blob_predict_explain(&model->blob, features, &explanation);
+    if (predicted_class < 0) return predicted_class;
+    int num_features = model->blob.forest.num_features;
+    int num_classes = model->blob.forest.num_classes;
+    for (int c = 0; c < num_classes; c++) {
+        if (proba) proba[c] = explanation.score[c];
+        bias[c] = explanation.bias[c];
+    }
+    for (int f = 0; f < num_features; f++) {
+        for (int c = 0; c < num_classes; c++) {
+            contributions[f * num_classes + c] = explanation.contributions[f][c];
+        }
+    }
+    return predicted_class;
+}
@@ -0,0 +1,86 @@
+/*
+ * Solar Panel Fault Detection - Native Inference Library (C ABI)
+ *
+ * Class and class probabilities for the backend from the exported model
+ * blob (models/solar_forest.bin, forest_blob.h), in one call per record
+ * or one call per batch. Python loads it with ctypes (solar_forest.py).
+ *
+ * Probabilities follow sklearn's predict_proba(): the mean over the trees
+ * of each reached leaf's class distribution, and the class is its argmax.
+ *
+ * A handle may be used from several threads at once, and
+ * solar_forest_reload() swaps in a new blob while they predict. Callers
+ * size their buffers from num_features and num_classes, so a handle keeps
+ * the shape of the blob it was opened with: a reload to a blob with other
+ * counts is refused (SOLAR_FOREST_SHAPE_CHANGED).
+ */
+
+#ifndef SOLAR_FOREST_CAPI_H
+#define SOLAR_FOREST_CAPI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_WIN32)
+#define SOLAR_FOREST_API __declspec(dllexport)
+#else
+#define SOLAR_FOREST_API __attribute__((visibility("default")))
+#endif
+
+typedef struct SolarForest SolarForest;
+
+// Map and validate a blob; NULL on failure with *status set (may be NULL)
+SOLAR_FOREST_API SolarForest* solar_forest_open(const char* path, int* status);
+SOLAR_FOREST_API void solar_forest_close(SolarForest* forest);
+
+// solar_forest_reload() status for a blob with another number of features
+// or classes; open a new handle for it
+#define SOLAR_FOREST_SHAPE_CHANGED 100
+
+// Replace the model with another blob; keeps the current one and returns
+// the error status when the new blob does not load or has another shape
+SOLAR_FOREST_API int solar_forest_reload(SolarForest* forest, const char* path);
+
+SOLAR_FOREST_API const char* solar_forest_error(int status);
+
+// Model description (of the blob loaded when called; the counts never
+// change for a handle)
+SOLAR_FOREST_API int solar_forest_num_features(const SolarForest* forest);
+SOLAR_FOREST_API int solar_forest_num_classes(const SolarForest* forest);
+SOLAR_FOREST_API const char* solar_forest_class_name(const SolarForest* forest, int index);
+SOLAR_FOREST_API const char* solar_forest_feature_name(const SolarForest* forest, int index);
+SOLAR_FOREST_API uint32_t solar_forest_model_version(const SolarForest* forest);
+
+// One record: features[num_features] in blob feature order. Returns the
+// class index and fills proba[num_classes] unless it is NULL.
+SOLAR_FOREST_API int solar_forest_predict(const SolarForest* forest, const float* features, float* proba);
+
+// `count` records, row-major features[count][num_features]. Fills
+// classes[count] and, unless NULL, proba[count][num_classes] and
+// contributions[count][num_features][num_classes] (each row's attribution,
+// as solar_forest_explain() computes it, in the same traversal). All rows
+// use the same model even if it is reloaded meanwhile. Returns count, or
+// 0 without writing anything when contributions are asked for and the
+// blob was exported without split distributions.
+SOLAR_FOREST_API size_t solar_forest_predict_batch(const SolarForest* forest, const float* features,
+                                                   size_t count, int32_t* classes, float* proba,
+                                                   float* contributions);
+
+// One record with its explanation: fills proba[num_classes] (may be NULL),
+// contributions[num_features][num_classes] and bias[num_classes] so that
+// bias[c] + the sum of contributions[f][c] over f == proba[c], i.e. how
+// much each feature moved each class's probability (Saabas attribution,
+// forest_blob_predict_explain()). Returns the class index, or -1 when the
+// blob was exported without split distributions.
+SOLAR_FOREST_API int solar_forest_explain(const SolarForest* forest, const float* features, float* proba,
+                                          float* contributions, float* bias);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SOLAR_FOREST_CAPI_H
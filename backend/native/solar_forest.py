@@ -0,0 +1,186 @@
+"""
+=============================================================================
+🔆 SOLAR PANEL FAULT DETECTION - Native Inference Binding
+=============================================================================
+ctypes binding for libsolar_forest.so (solar_forest.h), which predicts
+from the exported model blob (models/solar_forest.bin) without numpy or
+scikit-learn on the request path.
+
+Build the library first (from backend/native/):
+    g++ -O2 -std=c++11 -shared -fPIC -fvisibility=hidden -I../../models \\
+        solar_forest.cpp -o libsolar_forest.so
+=============================================================================
+"""
+
+import ctypes
+import os
+from array import array
+
+NATIVE_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_LIBRARY = os.path.join(NATIVE_DIR, 'libsolar_forest.so')
+DEFAULT_BLOB = os.path.join(os.path.dirname(os.path.dirname(NATIVE_DIR)), 'models', 'solar_forest.bin')
+
+
+class NativeForestError(RuntimeError):
+    """Raised when the library or a blob cannot be loaded."""
+
+
+def _load_library(path):
+    lib = ctypes.CDLL(path)
+    forest_p = ctypes.c_void_p
+    float_p = ctypes.POINTER(ctypes.c_float)
+
+    lib.solar_forest_open.argtypes = [ctypes.c_char_p, ctypes.POINTER(ctypes.c_int)]
+    lib.solar_forest_open.restype = forest_p
+    lib.solar_forest_close.argtypes = [forest_p]
+    lib.solar_forest_close.restype = None
+    lib.solar_forest_reload.argtypes = [forest_p, ctypes.c_char_p]
+    lib.solar_forest_reload.restype = ctypes.c_int
+    lib.solar_forest_error.argtypes = [ctypes.c_int]
+    lib.solar_forest_error.restype = ctypes.c_char_p
+    for name in ('solar_forest_num_features', 'solar_forest_num_classes'):
+        getattr(lib, name).argtypes = [forest_p]
+        getattr(lib, name).restype = ctypes.c_int
+    for name in ('solar_forest_class_name', 'solar_forest_feature_name'):
+        getattr(lib, name).argtypes = [forest_p, ctypes.c_int]
+        getattr(lib, name).restype = ctypes.c_char_p
+    lib.solar_forest_model_version.argtypes = [forest_p]
+    lib.solar_forest_model_version.restype = ctypes.c_uint32
+    lib.solar_forest_predict.argtypes = [forest_p, float_p, float_p]
+    lib.solar_forest_predict.restype = ctypes.c_int
+    lib.solar_forest_predict_batch.argtypes = [forest_p, float_p, ctypes.c_size_t,
+                                               ctypes.POINTER(ctypes.c_int32), float_p, float_p]
+    lib.solar_forest_predict_batch.restype = ctypes.c_size_t
+    lib.solar_forest_explain.argtypes = [forest_p, float_p, float_p, float_p, float_p]
+    lib.solar_forest_explain.restype = ctypes.c_int
+    return lib
+
+
+def _float_buffer(values):
+    """Pointer into an array('f') without copying it again."""
+    address, _ = values.buffer_info()
+    return ctypes.cast(address, ctypes.POINTER(ctypes.c_float))
+
+
+class NativeForest:
+    """
+    A model blob loaded in the native library.
+
+    Features are passed in the blob's own order (feature_names), as a flat
+    row or a list of rows; probabilities are sklearn predict_proba()
+    equivalents.
+    """
+
+    def __init__(self, blob_path=DEFAULT_BLOB, library_path=DEFAULT_LIBRARY):
+        try:
+            self._lib = _load_library(library_path)
+        except OSError as e:
+            raise NativeForestError(f"cannot load {library_path}: {e}")
+        status = ctypes.c_int(0)
+        self._handle = self._lib.solar_forest_open(os.fsencode(blob_path), ctypes.byref(status))
+        if not self._handle:
+            raise NativeForestError(f"{blob_path}: {self._lib.solar_forest_error(status.value).decode()}")
+        self.blob_path = blob_path
+        self._describe()
+
+    def _describe(self):
+        lib, handle = self._lib, self._handle
+        self.num_features = lib.solar_forest_num_features(handle)
+        self.num_classes = lib.solar_forest_num_classes(handle)
+        self.feature_names = [lib.solar_forest_feature_name(handle, i).decode() for i in range(self.num_features)]
+        self.class_names = [lib.solar_forest_class_name(handle, i).decode() for i in range(self.num_classes)]
+        self.model_version = lib.solar_forest_model_version(handle)
+
+    def reload(self, blob_path=None):
+        """
+        Swap in another blob; the current model stays on failure. The
+        library refuses a blob with another number of features or classes
+        (buffers here are sized from them): create a new NativeForest.
+        """
+        path = blob_path or self.blob_path
+        status = self._lib.solar_forest_reload(self._handle, os.fsencode(path))
+        if status != 0:
+            raise NativeForestError(f"{path}: {self._lib.solar_forest_error(status).decode()}")
+        self.blob_path = path
+        self._describe()
+
+    def close(self):
+        if self._handle:
+            self._lib.solar_forest_close(self._handle)
+            self._handle = None
+
+    def __del__(self):
+        self.close()
+
+    def predict(self, features):
+        """One record -> (class index, [probability per class])."""
+        row = array('f', features)
+        if len(row) != self.num_features:
+            raise ValueError(f"expected {self.num_features} features, got {len(row)}")
+        proba = array('f', bytes(4 * self.num_classes))
+        index = self._lib.solar_forest_predict(self._handle, _float_buffer(row), _float_buffer(proba))
+        return index, proba.tolist()
+
+    def explain(self, features):
+        """
+        One record -> (class index, [probability per class],
+        {feature name: [contribution per class]}, [bias per class]).
+
+        For every class the bias plus the feature contributions add up to
+        its probability. Raises NativeForestError when the blob has no
+        split distributions.
+        """
+        row = array('f', features)
+        if len(row) != self.num_features:
+            raise ValueError(f"expected {self.num_features} features, got {len(row)}")
+        k = self.num_classes
+        proba = array('f', bytes(4 * k))
+        contributions = array('f', bytes(4 * self.num_features * k))
+        bias = array('f', bytes(4 * k))
+        index = self._lib.solar_forest_explain(self._handle, _float_buffer(row), _float_buffer(proba),
+                                               _float_buffer(contributions), _float_buffer(bias))
+        if index < 0:
+            raise NativeForestError(f"{self.blob_path}: no split distributions, re-export the blob")
+        per_feature = {name: contributions[f * k:(f + 1) * k].tolist() for f, name in enumerate(self.feature_names)}
+        return index, proba.tolist(), per_feature, bias.tolist()
+
+    def predict_batch(self, rows, explain=False):
+        """
+        Many records in one call -> ([class index], [[probability per class]]),
+        plus [{feature name: [contribution per class]}] per record with
+        `explain` (the attribution of explain(), from the same traversal).
+        Raises NativeForestError with `explain` when the blob has no split
+        distributions.
+        """
+        count = len(rows)
+        if count == 0:
+            return ([], [], []) if explain else ([], [])
+        flat = array('f')
+        for row in rows:
+            if len(row) != self.num_features:
+                raise ValueError(f"expected {self.num_features} features, got {len(row)}")
+            flat.extend(row)
+        k = self.num_classes
+        classes = (ctypes.c_int32 * count)()
+        proba = array('f', bytes(4 * count * k))
+        contributions = array('f', bytes(4 * count * self.num_features * k)) if explain else None
+        done = self._lib.solar_forest_predict_batch(self._handle, _float_buffer(flat), count, classes,
+                                                    _float_buffer(proba),
+                                                    _float_buffer(contributions) if explain else None)
+        if done != count:
+            raise NativeForestError(f"{self.blob_path}: no split distributions, re-export the blob")
+        probas = [proba[i * k:(i + 1) * k].tolist() for i in range(count)]
+        if not explain:
+            return list(classes), probas
+        stride = self.num_features * k
+        explanations = [{name: contributions[i * stride + f * k:i * stride + (f + 1) * k].tolist()
+                         for f, name in enumerate(self.feature_names)} for i in range(count)]
+        return list(classes), probas, explanations
+
+
+def load_native_forest(blob_path=DEFAULT_BLOB, library_path=DEFAULT_LIBRARY):
+    """NativeForest, or None with the reason when it is not available."""
+    try:
+        return NativeForest(blob_path, library_path), None
+    except NativeForestError as e:
+        return None, str(e)
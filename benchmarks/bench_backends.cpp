@@ -0,0 +1,116 @@
+/*
+ * Solar Panel Fault Detection - Model Backend Benchmark (x86 host)
+ *
+ * Times every generated backend against predict() from model_manual.h on
+ * shuffled rows from both datasets and fails on any disagreement.
+ * The ESP32 counterpart is esp32_bench/esp32_bench.ino.
+ *
+ * Build and run (from benchmarks/):
+ *   g++ -O2 -std=c++11 -I../models bench_backends.cpp -o bench_backends
+ *   ./bench_backends [samples]
+ *
+ * Build with -std=c++17 to include the constexpr forest (model_constexpr.h)
+ * and with -DPREDICT_EARLY_EXIT to include predict_early_exit().
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "model_manual.h"
+#include "model_table.h"
+#include "model_quickscorer.h"
+#include "model_lut.h"
+#include "model_compact.h"
+#if __cplusplus >= 201703L
+#include "model_constexpr.h"
+#endif
+#include "bench_common.h"
+
+#define BENCH_REPEATS 5
+
+static int run_manual(const float* x) { return predict(const_cast<float*>(x)); }
+#ifdef PREDICT_EARLY_EXIT
+static int run_early_exit(const float* x) { return predict_early_exit(const_cast<float*>(x)); }
+#endif
+static int run_table(const float* x) { return forest_predict(&SOLAR_FOREST, x); }
+static int run_quickscorer(const float* x) { return quickscorer_predict(&SOLAR_QUICKSCORER, x); }
+#if LUT_AVAILABLE
+static int run_lut(const float* x) { return lut_predict(x); }
+#endif
+static int run_compact(const float* x) { return compact_forest_predict(&SOLAR_COMPACT_FOREST, x); }
+#if __cplusplus >= 201703L
+static int run_constexpr(const float* x) { return cx_predict(x); }
+static int run_constexpr_table(const float* x) { return forest_predict(&SOLAR_FOREST_CX, x); }
+#endif
+
+struct Backend {
+    const char* name;
+    int (*predict)(const float*);
+};
+
+static const Backend BACKENDS[] = {
+    {"if-else (predict)", run_manual},
+#ifdef PREDICT_EARLY_EXIT
+    {"if-else early exit", run_early_exit},
+#endif
+    {"flat table", run_table},
+    {"quickscorer", run_quickscorer},
+#if LUT_AVAILABLE
+    {"dense lut", run_lut},
+#endif
+    {"compact nodes", run_compact},
+#if __cplusplus >= 201703L
+    {"constexpr unrolled", run_constexpr},
+    {"constexpr table", run_constexpr_table},
+#endif
+};
+
+int main(int argc, char** argv) {
+    size_t samples = (argc > 1) ? (size_t)std::atol(argv[1]) : 1000000;
+
+    std::vector<BenchRow> dataset = bench_load_panel_dataset();
+    std::vector<BenchRow> telemetry = bench_load_telemetry();
+    dataset.insert(dataset.end(), telemetry.begin(), telemetry.end());
+    if (dataset.empty()) return 1;
+    bench_shuffle(dataset);
+    std::vector<BenchRow> rows = bench_repeat(dataset, samples);
+    size_t n = rows.size();
+
+    std::vector<int> reference(n), out(n);
+    for (size_t i = 0; i < n; i++) {
+        reference[i] = predict(rows[i].features);
+    }
+
+    std::printf("Samples: %zu (%zu dataset rows, best of %d runs)\n", n, dataset.size(), BENCH_REPEATS);
+    int failed = 0;
+    for (size_t b = 0; b < sizeof(BACKENDS) / sizeof(BACKENDS[0]); b++) {
+        double best = 1e30;
+        for (int r = 0; r < BENCH_REPEATS; r++) {
+            double t0 = bench_now_ns();
+            for (size_t i = 0; i < n; i++) {
+                out[i] = BACKENDS[b].predict(rows[i].features);
+            }
+            double elapsed = bench_now_ns() - t0;
+            if (elapsed < best) best = elapsed;
+        }
+
+        size_t mismatches = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (out[i] != reference[i]) mismatches++;
+        }
+        failed |= mismatches != 0;
+        std::printf("  %-20s %7.1f ns/sample  mismatches: %zu\n", BACKENDS[b].name, best / n, mismatches);
+    }
+#if !LUT_AVAILABLE
+    std::printf("  %-20s unavailable (model_lut.h: table too large)\n", "dense lut");
+#endif
+
+#ifdef PREDICT_EARLY_EXIT
+    std::printf("Early exit skipped %.1f%% of trees (%.2f of %d evaluated per sample)\n",
+                100.0 * early_exit_stats.trees_skipped / (early_exit_stats.predictions * (double)NUM_TREES),
+                NUM_TREES - (double)early_exit_stats.trees_skipped / early_exit_stats.predictions, NUM_TREES);
+#endif
+
+    return failed;
+}
@@ -0,0 +1,62 @@
+/*
+ * Solar Panel Fault Detection - predict() vs predict_batch() Benchmark
+ *
+ * Scores rows from data/solar_panel_dataset.csv one at a time through
+ * predict() and in column-major batches through predict_batch().
+ *
+ * Build and run (from benchmarks/):
+ *   g++ -O2 -std=c++11 -I../models bench_batch.cpp -o bench_batch
+ *   ./bench_batch [samples]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "model_manual.h"
+#include "bench_common.h"
+
+#define BENCH_REPEATS 5
+
+int main(int argc, char** argv) {
+    size_t samples = (argc > 1) ? (size_t)std::atol(argv[1]) : 200000;
+
+    std::vector<BenchRow> dataset = bench_load_panel_dataset();
+    if (dataset.empty()) return 1;
+    std::vector<BenchRow> rows = bench_repeat(dataset, samples);
+    std::vector<float> X = bench_columns(rows);
+    size_t n = rows.size();
+
+    std::vector<int> single(n), batch(n), votes(n * NUM_CLASSES);
+    double best_single = 1e30, best_batch = 1e30, best_votes = 1e30;
+
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            single[i] = predict(rows[i].features);
+        }
+        double t1 = bench_now_ns();
+        predict_batch(X.data(), n, batch.data());
+        double t2 = bench_now_ns();
+        predict_batch_votes(X.data(), n, votes.data());
+        double t3 = bench_now_ns();
+
+        if (t1 - t0 < best_single) best_single = t1 - t0;
+        if (t2 - t1 < best_batch) best_batch = t2 - t1;
+        if (t3 - t2 < best_votes) best_votes = t3 - t2;
+    }
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (single[i] != batch[i] || majority_vote(&votes[i * NUM_CLASSES]) != single[i]) mismatches++;
+    }
+    bench_sink = batch[n - 1];
+
+    std::printf("Samples: %zu (%zu dataset rows, best of %d runs)\n", n, dataset.size(), BENCH_REPEATS);
+    std::printf("  predict() loop        %8.1f ns/sample\n", best_single / n);
+    std::printf("  predict_batch()       %8.1f ns/sample  (%.2fx)\n", best_batch / n, best_single / best_batch);
+    std::printf("  predict_batch_votes() %8.1f ns/sample  (%.2fx)\n", best_votes / n, best_single / best_votes);
+    std::printf("  Mismatches: %zu\n", mismatches);
+
+    return mismatches == 0 ? 0 : 1;
+}
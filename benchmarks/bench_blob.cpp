@@ -0,0 +1,174 @@
+/*
+ * Solar Panel Fault Detection - Model Blob Load Benchmark
+ *
+ * Loads models/solar_forest.bin (forest_blob.h) the ways a host can and
+ * reports:
+ *
+ *   load time       mmap() + validation vs read() into the heap
+ *   first predict   latency of the first forest_predict() on a freshly
+ *                   mapped blob (page faults included) vs steady state
+ *   hot swap        reader threads predicting through a ForestSlot while
+ *                   the main thread keeps swapping models in
+ *
+ * Fails when the blob disagrees with the compiled-in model_table.h on any
+ * dataset row, when a damaged blob is accepted, or when a reader sees a
+ * wrong class during the swaps.
+ *
+ * Build and run (from benchmarks/):
+ *   g++ -O2 -std=c++11 -pthread -I../models bench_blob.cpp -o bench_blob
+ *   ./bench_blob
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "model_table.h"
+#include "forest_blob_loader.h"
+#include "bench_common.h"
+
+#ifndef SOLAR_BLOB_PATH
+#define SOLAR_BLOB_PATH "../models/solar_forest.bin"
+#endif
+
+#define LOAD_REPEATS 200
+#define SWAP_READERS 4
+#define SWAP_COUNT 20000
+
+struct LoadTiming {
+    double load_ns;          // Best load + validation
+    double first_predict_ns; // Median first prediction after loading
+};
+
+static LoadTiming time_loads(ForestModelPtr (*load)(const char*, ForestBlobStatus*), const float* x) {
+    LoadTiming timing = {1e30, 0};
+    std::vector<double> first(LOAD_REPEATS);
+    for (int r = 0; r < LOAD_REPEATS; r++) {
+        ForestBlobStatus status;
+        double t0 = bench_now_ns();
+        ForestModelPtr model = load(SOLAR_BLOB_PATH, &status);
+        double t1 = bench_now_ns();
+        bench_sink = model ? forest_predict(&model->blob.forest, x) : -1;
+        double t2 = bench_now_ns();
+        timing.load_ns = std::min(timing.load_ns, t1 - t0);
+        first[r] = t2 - t1;
+    }
+    std::sort(first.begin(), first.end());
+    timing.first_predict_ns = first[LOAD_REPEATS / 2];
+    return timing;
+}
+
+// Damaged copies of the blob must all be rejected
+static int check_rejections(const ForestBlobModel& model) {
+    const uint8_t* original = (const uint8_t*)model.memory;
+    const ForestBlobHeader* header = (const ForestBlobHeader*)original;
+    std::vector<uint32_t> buffer((model.size + 3) / 4);
+    uint8_t* copy = (uint8_t*)&buffer[0];
+    ForestBlob blob;
+    int failures = 0;
+
+    struct Case {
+        const char* name;
+        size_t offset;
+        uint8_t flip;
+        size_t size;
+        ForestBlobStatus expected;
+    };
+    const Case cases[] = {
+        {"payload bit flip", header->nodes_offset + 1, 0x01, model.size, FOREST_BLOB_BAD_CHECKSUM},
+        {"wrong magic", 0, 0xFF, model.size, FOREST_BLOB_BAD_MAGIC},
+        {"newer format", 4, 0x02, model.size, FOREST_BLOB_BAD_VERSION},
+        {"truncated", 0, 0x00, model.size - 4, FOREST_BLOB_TRUNCATED},
+        // The header is not under the checksum: counts past the stack
+        // buffers, or below the leaf classes, must fail validation
+        {"too many classes", offsetof(ForestBlobHeader, num_classes), 0x08, model.size, FOREST_BLOB_BAD_LAYOUT},
+        {"too many features", offsetof(ForestBlobHeader, num_features), 0x08, model.size, FOREST_BLOB_BAD_LAYOUT},
+        {"leaf past classes", offsetof(ForestBlobHeader, num_classes), 0x04, model.size, FOREST_BLOB_BAD_TREE},
+    };
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        std::copy(original, original + model.size, copy);
+        copy[cases[c].offset] ^= cases[c].flip;
+        ForestBlobStatus status = forest_blob_open(&blob, copy, cases[c].size);
+        bool ok = status == cases[c].expected;
+        failures += !ok;
+        std::printf("  %-18s -> %s%s\n", cases[c].name, forest_blob_error(status), ok ? "" : "  (FAIL)");
+    }
+    return failures;
+}
+
+int main() {
+    std::vector<BenchRow> rows = bench_load_panel_dataset();
+    std::vector<BenchRow> telemetry = bench_load_telemetry();
+    rows.insert(rows.end(), telemetry.begin(), telemetry.end());
+    if (rows.empty()) return 1;
+
+    ForestBlobStatus status;
+    ForestModelPtr mapped = forest_blob_map_file(SOLAR_BLOB_PATH, &status);
+    if (!mapped) {
+        std::fprintf(stderr, "%s: %s\n", SOLAR_BLOB_PATH, forest_blob_error(status));
+        return 1;
+    }
+    const ForestBlob& blob = mapped->blob;
+    std::printf("%s: %zu bytes, model version %u, CRC-32 %08x, %d trees, %d classes\n\n",
+                SOLAR_BLOB_PATH, mapped->size, blob.model_version, blob.checksum,
+                blob.forest.num_trees, blob.forest.num_classes);
+
+    // Same class as the compiled-in table for every row
+    std::vector<int> expected(rows.size());
+    size_t mismatches = 0;
+    for (size_t i = 0; i < rows.size(); i++) {
+        expected[i] = forest_predict(&SOLAR_FOREST, rows[i].features);
+        mismatches += forest_predict(&blob.forest, rows[i].features) != expected[i];
+    }
+    std::printf("Parity with model_table.h: %zu rows, %zu mismatches\n\n", rows.size(), mismatches);
+
+    std::printf("Damaged blobs:\n");
+    int failures = check_rejections(*mapped);
+
+    // Load paths
+    LoadTiming map_timing = time_loads(forest_blob_map_file, rows[0].features);
+    LoadTiming read_timing = time_loads(forest_blob_read_path, rows[0].features);
+    double steady = 1e30;
+    for (int r = 0; r < 5; r++) {
+        double t0 = bench_now_ns();
+        for (size_t i = 0; i < rows.size(); i++) bench_sink = forest_predict(&blob.forest, rows[i].features);
+        steady = std::min(steady, (bench_now_ns() - t0) / rows.size());
+    }
+    std::printf("\nLoad (best of %d)                 load + validate   first predict (median)\n", LOAD_REPEATS);
+    std::printf("  mmap (forest_blob_map_file)   %10.1f us %14.0f ns\n", map_timing.load_ns / 1000, map_timing.first_predict_ns);
+    std::printf("  read (forest_blob_read_path)  %10.1f us %14.0f ns\n", read_timing.load_ns / 1000, read_timing.first_predict_ns);
+    std::printf("  steady-state predict                           %8.1f ns\n\n", steady);
+
+    // Hot swap between two loads of the same model under concurrent readers
+    ForestModelPtr copies[2] = {mapped, forest_blob_read_path(SOLAR_BLOB_PATH, &status)};
+    ForestSlot slot;
+    forest_slot_swap(&slot, copies[0]);
+    std::atomic<bool> stop(false);
+    std::atomic<size_t> wrong(0), predictions(0);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < SWAP_READERS; r++) {
+        readers.push_back(std::thread([&, r]() {
+            size_t count = 0, bad = 0;
+            for (size_t i = r; !stop.load(std::memory_order_relaxed); i = (i + 1) % rows.size(), count++) {
+                bad += forest_slot_predict(&slot, rows[i].features) != expected[i];
+            }
+            wrong += bad;
+            predictions += count;
+        }));
+    }
+    double t0 = bench_now_ns();
+    for (int s = 0; s < SWAP_COUNT; s++) {
+        forest_slot_swap(&slot, copies[(s + 1) & 1]);
+    }
+    double swap_ns = (bench_now_ns() - t0) / SWAP_COUNT;
+    stop = true;
+    for (size_t r = 0; r < readers.size(); r++) readers[r].join();
+
+    std::printf("Hot swap: %d swaps, %.0f ns each, %d readers made %zu predictions, %zu wrong\n",
+                SWAP_COUNT, swap_ns, SWAP_READERS, predictions.load(), wrong.load());
+
+    return (mismatches != 0 || failures != 0 || wrong != 0) ? 1 : 0;
+}
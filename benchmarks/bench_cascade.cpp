@@ -0,0 +1,124 @@
+/*
+ * Solar Panel Fault Detection - Cascade Replay Benchmark
+ *
+ * Replays both datasets in file order through the two-stage cascade
+ * (model_cascade.h: physics prefilter, then the flat forest) and the
+ * forest alone (model_table.h), and reports:
+ *
+ *   - the share of readings answered by the first stage and by the full
+ *     forest
+ *   - ns per reading of both pipelines
+ *   - how often the cascade differs from the forest
+ *   - accuracy against the dataset labels with and without the first
+ *     stage (labels without a model class are left out; Shaded counts
+ *     as Partial_Shading and Dusted as Dust_Accumulation)
+ *
+ * Fails when the cascade differs from the forest on more than
+ * max_disagreement percent of the readings the first stage answers
+ * (default 0.1, i.e. cascade_min_precision = 0.999 in the exporter).
+ *
+ * Build and run (from benchmarks/):
+ *   g++ -O2 -std=c++11 -I../models bench_cascade.cpp -o bench_cascade
+ *   ./bench_cascade [max_disagreement]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "model_cascade.h"
+#include "bench_common.h"
+
+#define BENCH_REPEATS 5
+
+// Dataset labels spelled differently from the model's classes
+static const char* const LABEL_ALIASES[][2] = {
+    {"Shaded", "Partial_Shading"},
+    {"Dusted", "Dust_Accumulation"},
+};
+
+// Model class of a dataset label, -1 when the model has no such class
+static int label_class(const std::string& label) {
+    std::string name = label;
+    for (size_t a = 0; a < sizeof(LABEL_ALIASES) / sizeof(LABEL_ALIASES[0]); a++) {
+        if (name == LABEL_ALIASES[a][0]) name = LABEL_ALIASES[a][1];
+    }
+    for (int c = 0; c < SOLAR_FOREST.num_classes; c++) {
+        if (name == FOREST_CLASS_NAMES[c]) return c;
+    }
+    return -1;
+}
+
+int main(int argc, char** argv) {
+    double max_disagreement = (argc > 1) ? std::atof(argv[1]) : 0.1;
+
+    std::vector<std::string> labels;
+    std::vector<BenchRow> rows = bench_load_csv(SOLAR_DATA_DIR "solar_panel_dataset.csv", BENCH_PANEL_COLUMNS,
+                                                "Fault_Status", &labels);
+    std::vector<BenchRow> telemetry = bench_load_csv(SOLAR_DATA_DIR "solar_data.csv", BENCH_TELEMETRY_COLUMNS,
+                                                     "fault_label", &labels);
+    rows.insert(rows.end(), telemetry.begin(), telemetry.end());
+    if (rows.empty()) return 1;
+    size_t n = rows.size();
+
+    // Which stage answers each reading
+    size_t prefiltered = 0, disagree = 0;
+    size_t labeled = 0, forest_correct = 0, cascade_correct = 0;
+    std::vector<int> forest_out(n), cascade_out(n);
+    for (size_t i = 0; i < n; i++) {
+        const float* x = rows[i].features;
+        forest_out[i] = forest_predict(&SOLAR_FOREST, x);
+        cascade_out[i] = cascade_predict(x);
+
+        if (cascade_prefilter(&SOLAR_CASCADE, x) != CASCADE_FOREST) {
+            prefiltered++;
+        }
+        if (cascade_out[i] != forest_out[i]) disagree++;
+
+        int expected = label_class(labels[i]);
+        if (expected < 0) continue;
+        labeled++;
+        forest_correct += forest_out[i] == expected;
+        cascade_correct += cascade_out[i] == expected;
+    }
+
+    double best_forest = 1e30, best_cascade = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        int sink = 0;
+        double t0 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            sink += forest_predict(&SOLAR_FOREST, rows[i].features);
+        }
+        double t1 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            sink += cascade_predict(rows[i].features);
+        }
+        double t2 = bench_now_ns();
+        bench_sink = sink;
+        if (t1 - t0 < best_forest) best_forest = t1 - t0;
+        if (t2 - t1 < best_cascade) best_cascade = t2 - t1;
+    }
+
+    std::printf("Readings: %zu (both datasets in file order, best of %d runs)\n", n, BENCH_REPEATS);
+    std::printf("  first stage      %6zu (%5.1f%%)\n", prefiltered, 100.0 * prefiltered / n);
+    std::printf("  full forest      %6zu (%5.1f%%)\n", n - prefiltered, 100.0 * (n - prefiltered) / n);
+    std::printf("Latency:\n");
+    std::printf("  forest only      %6.1f ns/reading\n", best_forest / n);
+    std::printf("  cascade          %6.1f ns/reading  (%.2fx)\n", best_cascade / n, best_forest / best_cascade);
+    std::printf("Cascade vs forest: %zu readings differ\n", disagree);
+    if (labeled) {
+        std::printf("Accuracy on %zu labeled readings: forest %.2f%%, cascade %.2f%% (%+.2f points)\n", labeled,
+                    100.0 * forest_correct / labeled, 100.0 * cascade_correct / labeled,
+                    100.0 * ((double)cascade_correct - (double)forest_correct) / labeled);
+    }
+
+    double disagreement = prefiltered ? 100.0 * disagree / prefiltered : 0.0;
+    if (disagreement > max_disagreement) {
+        std::printf("FAIL: the first stage differs from the forest on %.3f%% of the readings it answers "
+                    "(limit %.3f%%)\n", disagreement, max_disagreement);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,206 @@
+/*
+ * Solar Panel Fault Detection - Benchmark Helpers (host only)
+ *
+ * Loads [Voltage, Current, Temperature, Light_Intensity, Efficiency] rows
+ * from the datasets in data/ and their golden classes, and times inference
+ * loops. Datasets without
+ * an efficiency column get panel_efficiency() of the row, as
+ * ml/step3_export_to_esp32.py computes it for the golden classes.
+ */
+
+#ifndef SOLAR_BENCH_COMMON_H
+#define SOLAR_BENCH_COMMON_H
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <stdint.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "panel_efficiency.h"
+
+#ifndef SOLAR_DATA_DIR
+#define SOLAR_DATA_DIR "../data/"
+#endif
+
+#ifndef SOLAR_GOLDEN_DIR
+#define SOLAR_GOLDEN_DIR "golden/"
+#endif
+
+#define BENCH_NUM_FEATURES 5
+
+// One sample: Voltage, Current, Temperature, Light_Intensity, Efficiency
+struct BenchRow {
+    float features[BENCH_NUM_FEATURES];
+};
+
+// Column names of the features in each dataset; NULL: computed with
+// panel_efficiency() from the voltage, current and light columns
+static const char* const BENCH_PANEL_COLUMNS[] = {"Voltage", "Current", "Temperature", "Light_Intensity", "Efficiency"};
+static const char* const BENCH_TELEMETRY_COLUMNS[] = {"voltage_v", "current_a", "temperature_c", "light_lux", NULL};
+
+inline std::vector<std::string> bench_split(const std::string& line) {
+    std::vector<std::string> cells;
+    std::stringstream stream(line);
+    std::string cell;
+    while (std::getline(stream, cell, ',')) {
+        cells.push_back(cell);
+    }
+    return cells;
+}
+
+// Read the feature columns of a CSV file, skipping incomplete rows; with
+// `labels`, also the label_column cell of every row kept
+inline std::vector<BenchRow> bench_load_csv(const std::string& path, const char* const* columns,
+                                            const char* label_column = NULL,
+                                            std::vector<std::string>* labels = NULL) {
+    std::vector<BenchRow> rows;
+    std::ifstream file(path.c_str());
+    std::string line;
+    if (!std::getline(file, line)) {
+        std::fprintf(stderr, "Cannot read %s\n", path.c_str());
+        return rows;
+    }
+
+    std::vector<std::string> header = bench_split(line);
+    int index[BENCH_NUM_FEATURES];
+    for (int f = 0; f < BENCH_NUM_FEATURES; f++) {
+        index[f] = -1;
+        if (!columns[f]) continue;
+        for (size_t c = 0; c < header.size(); c++) {
+            if (header[c] == columns[f]) index[f] = (int)c;
+        }
+        if (index[f] < 0) {
+            std::fprintf(stderr, "%s: missing column %s\n", path.c_str(), columns[f]);
+            return rows;
+        }
+    }
+    int label_index = -1;
+    for (size_t c = 0; labels && c < header.size(); c++) {
+        if (header[c] == label_column) label_index = (int)c;
+    }
+
+    while (std::getline(file, line)) {
+        std::vector<std::string> cells = bench_split(line);
+        BenchRow row;
+        bool complete = true;
+        for (int f = 0; f < BENCH_NUM_FEATURES && complete; f++) {
+            if (!columns[f]) continue;
+            if (index[f] >= (int)cells.size() || cells[index[f]].empty()) {
+                complete = false;
+            } else {
+                row.features[f] = std::strtof(cells[index[f]].c_str(), NULL);
+            }
+        }
+        if (!complete) continue;
+        if (!columns[4]) {
+            row.features[4] = panel_efficiency(row.features[0], row.features[1], row.features[3]);
+        }
+        rows.push_back(row);
+        if (labels) labels->push_back(label_index >= 0 && label_index < (int)cells.size() ? cells[label_index] : "");
+    }
+    return rows;
+}
+
+inline std::vector<BenchRow> bench_load_panel_dataset() {
+    return bench_load_csv(SOLAR_DATA_DIR "solar_panel_dataset.csv", BENCH_PANEL_COLUMNS);
+}
+
+inline std::vector<BenchRow> bench_load_telemetry() {
+    return bench_load_csv(SOLAR_DATA_DIR "solar_data.csv", BENCH_TELEMETRY_COLUMNS);
+}
+
+// Golden classes of one dataset (file name as in data/): `expected` gets
+// golden/<stem>_expected.txt, model.predict() of every row, and `vote` the
+// same with the rows of golden/hard_vote_gaps.txt replaced by the hard
+// vote the exported headers compute. Returns the number of gap rows, or -1
+inline long bench_load_golden(const std::string& dataset, std::vector<int>* expected, std::vector<int>* vote) {
+    std::string path = SOLAR_GOLDEN_DIR + dataset.substr(0, dataset.rfind('.')) + "_expected.txt";
+    std::ifstream file(path.c_str());
+    if (!file) {
+        std::fprintf(stderr, "Cannot read %s\n", path.c_str());
+        return -1;
+    }
+    expected->clear();
+    int c;
+    while (file >> c) {
+        expected->push_back(c);
+    }
+    *vote = *expected;
+
+    const char* gaps_path = SOLAR_GOLDEN_DIR "hard_vote_gaps.txt";
+    std::ifstream gaps_file(gaps_path);
+    if (!gaps_file) {
+        std::fprintf(stderr, "Cannot read %s\n", gaps_path);
+        return -1;
+    }
+    long gaps = 0;
+    std::string line;
+    while (std::getline(gaps_file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::stringstream cells(line);
+        std::string name;
+        size_t row;
+        int predicted, hard_vote;
+        if (!(cells >> name >> row >> predicted >> hard_vote)) {
+            std::fprintf(stderr, "%s: bad line '%s'\n", gaps_path, line.c_str());
+            return -1;
+        }
+        if (name != dataset) continue;
+        if (row >= expected->size() || (*expected)[row] != predicted) {
+            std::fprintf(stderr, "%s: '%s' does not match %s\n", gaps_path, line.c_str(), path.c_str());
+            return -1;
+        }
+        (*vote)[row] = hard_vote;
+        gaps++;
+    }
+    return gaps;
+}
+
+// Repeat rows until there are at least `count` samples
+inline std::vector<BenchRow> bench_repeat(const std::vector<BenchRow>& rows, size_t count) {
+    std::vector<BenchRow> out;
+    if (rows.empty()) return out;
+    out.reserve(count);
+    while (out.size() < count) {
+        out.push_back(rows[out.size() % rows.size()]);
+    }
+    return out;
+}
+
+// Deterministic shuffle, so replayed rows do not arrive grouped by class
+inline void bench_shuffle(std::vector<BenchRow>& rows) {
+    uint32_t state = 12345;
+    for (size_t i = rows.size(); i > 1; i--) {
+        state = state * 1664525u + 1013904223u;
+        size_t j = state % i;
+        BenchRow tmp = rows[i - 1];
+        rows[i - 1] = rows[j];
+        rows[j] = tmp;
+    }
+}
+
+// Row-major rows -> column-major buffer (X[f * n + i])
+inline std::vector<float> bench_columns(const std::vector<BenchRow>& rows) {
+    size_t n = rows.size();
+    std::vector<float> X(BENCH_NUM_FEATURES * n);
+    for (size_t i = 0; i < n; i++) {
+        for (int f = 0; f < BENCH_NUM_FEATURES; f++) {
+            X[f * n + i] = rows[i].features[f];
+        }
+    }
+    return X;
+}
+
+inline double bench_now_ns() {
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Keeps the compiler from dropping unused results
+static volatile int bench_sink;
+
+#endif // SOLAR_BENCH_COMMON_H
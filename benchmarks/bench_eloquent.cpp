@@ -0,0 +1,105 @@
+/*
+ * Solar Panel Fault Detection - Eloquent Header Parity and Cycle Benchmark
+ *
+ * Runs every complete row of data/solar_data.csv through the Eloquent
+ * RandomForest in model.h (double thresholds) and model_float.h (float32
+ * thresholds) and compares both with the golden classes written by
+ * ml/step3_export_to_esp32.py: golden/solar_data_expected.txt, with the
+ * hard vote on the rows listed in golden/hard_vote_gaps.txt. Fails on any
+ * mismatch. Rows are scaled with scale_features() from model_manual.h, as
+ * on the device.
+ *
+ * Build and run (from benchmarks/):
+ *   g++ -O2 -std=c++11 -I../models bench_eloquent.cpp -o bench_eloquent
+ *   ./bench_eloquent
+ */
+
+#include <cstdarg>
+#include <cstdio>
+#include <fstream>
+#include <stdint.h>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+#include "model_manual.h"
+#include "bench_common.h"
+
+// Both headers declare Eloquent::ML::Port::RandomForest
+namespace eloquent_f64 {
+#include "model.h"
+}
+namespace eloquent_f32 {
+#include "model_float.h"
+}
+
+#define BENCH_REPEATS 5
+
+template <class Model>
+static size_t run_model(Model& model, std::vector<BenchRow>& scaled, const std::vector<int>& expected,
+                        double* best_ns, double* best_cycles) {
+    std::vector<int> out(scaled.size());
+    *best_ns = 1e30;
+    *best_cycles = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = bench_now_ns();
+#ifdef BENCH_HAVE_TSC
+        uint64_t c0 = __rdtsc();
+#endif
+        for (size_t i = 0; i < scaled.size(); i++) {
+            out[i] = model.predict(scaled[i].features);
+        }
+#ifdef BENCH_HAVE_TSC
+        double cycles = (double)(__rdtsc() - c0);
+        if (cycles < *best_cycles) *best_cycles = cycles;
+#endif
+        double elapsed = bench_now_ns() - t0;
+        if (elapsed < *best_ns) *best_ns = elapsed;
+    }
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < scaled.size(); i++) {
+        if (out[i] != expected[i]) mismatches++;
+    }
+    return mismatches;
+}
+
+int main() {
+    std::vector<BenchRow> rows = bench_load_telemetry();
+    std::vector<int> predicted, expected;
+    long gaps = bench_load_golden("solar_data.csv", &predicted, &expected);
+    if (gaps < 0) return 1;
+    if (rows.empty() || rows.size() != expected.size()) {
+        std::fprintf(stderr, "%zu rows but %zu expected classes for solar_data.csv\n", rows.size(), expected.size());
+        return 1;
+    }
+
+    std::vector<BenchRow> scaled(rows.size());
+    for (size_t i = 0; i < rows.size(); i++) {
+        scale_features(rows[i].features, scaled[i].features);
+    }
+
+    eloquent_f64::Eloquent::ML::Port::RandomForest f64;
+    eloquent_f32::Eloquent::ML::Port::RandomForest f32;
+    double ns64, cycles64, ns32, cycles32;
+    size_t mismatches64 = run_model(f64, scaled, expected, &ns64, &cycles64);
+    size_t mismatches32 = run_model(f32, scaled, expected, &ns32, &cycles32);
+
+    size_t n = rows.size();
+    std::printf("Rows: %zu (solar_data.csv, best of %d runs), %ld with the hard vote of hard_vote_gaps.txt\n",
+                n, BENCH_REPEATS, gaps);
+#ifdef BENCH_HAVE_TSC
+    std::printf("  model.h (double)         %6.1f ns/sample  %6.1f TSC cycles  mismatches: %zu\n",
+                ns64 / n, cycles64 / n, mismatches64);
+    std::printf("  model_float.h (float32)  %6.1f ns/sample  %6.1f TSC cycles  mismatches: %zu\n",
+                ns32 / n, cycles32 / n, mismatches32);
+#else
+    std::printf("  model.h (double)         %6.1f ns/sample  mismatches: %zu\n", ns64 / n, mismatches64);
+    std::printf("  model_float.h (float32)  %6.1f ns/sample  mismatches: %zu\n", ns32 / n, mismatches32);
+#endif
+
+    return (mismatches64 != 0 || mismatches32 != 0) ? 1 : 0;
+}
@@ -0,0 +1,201 @@
+/*
+ * Solar Panel Fault Detection - Feature Attribution Check and Benchmark
+ *
+ * Runs forest_predict_explain() (forest_runtime.h) over every row of both
+ * datasets with the uncompacted node table and its FOREST_NODE_VALUES
+ * (SOLAR_FOREST_EXPLAIN in model_table.h), and forest_blob_predict_explain()
+ * with models/solar_forest.bin, and checks that:
+ *
+ *   - bias + the sum of the feature contributions equals score for every
+ *     class (within ATTRIBUTION_TOLERANCE)
+ *   - the table's class matches forest_predict(&SOLAR_FOREST)
+ *   - the blob's class matches forest_blob_predict_proba() and its score
+ *     is that proba bit for bit
+ *   - the table's and the blob's scores agree, and the class with the
+ *     highest score is the golden model.predict() class (golden/)
+ *
+ * Then prints the overhead over plain predict() (model_manual.h) and
+ * forest_predict(), and the mean share of each feature in the fault
+ * predictions. Exits non-zero on any failed check.
+ *
+ * Build and run (from benchmarks/):
+ *   g++ -O2 -std=c++11 -I../models bench_explain.cpp -o bench_explain
+ *   ./bench_explain
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "model_manual.h"
+#include "model_table.h"
+#include "forest_blob_loader.h"
+#include "bench_common.h"
+
+#ifndef SOLAR_BLOB_PATH
+#define SOLAR_BLOB_PATH "../models/solar_forest.bin"
+#endif
+
+#define BENCH_REPEATS 5
+#define ATTRIBUTION_TOLERANCE 1e-5f
+#define ERRORS_SHOWN 5
+
+// Largest |bias + sum of contributions - score| over the classes
+static float attribution_error(const ForestExplanation& explanation, int num_features, int num_classes) {
+    float worst = 0.0f;
+    for (int c = 0; c < num_classes; c++) {
+        float sum = explanation.bias[c];
+        for (int f = 0; f < num_features; f++) {
+            sum += explanation.contributions[f][c];
+        }
+        float error = std::fabs(sum - explanation.score[c]);
+        if (error > worst) worst = error;
+    }
+    return worst;
+}
+
+// Class with the highest score (first on ties, as numpy.argmax)
+static int score_argmax(const float* score, int num_classes) {
+    int best = 0;
+    for (int c = 1; c < num_classes; c++) {
+        if (score[c] > score[best]) best = c;
+    }
+    return best;
+}
+
+// Checks one row against both models and its model.predict() class;
+// returns a description of the first failure or NULL
+static const char* check_row(const ForestBlob* blob, const float* x, int expected) {
+    ForestExplanation explanation;
+    int predicted_class = forest_predict_explain(&SOLAR_FOREST_EXPLAIN, FOREST_NODE_VALUES, x, &explanation);
+    if (predicted_class != forest_predict(&SOLAR_FOREST, x)) return "table: class differs from forest_predict()";
+    if (attribution_error(explanation, SOLAR_FOREST.num_features, SOLAR_FOREST.num_classes) > ATTRIBUTION_TOLERANCE) {
+        return "table: contributions do not add up to the score";
+    }
+    if (score_argmax(explanation.score, SOLAR_FOREST.num_classes) != expected) {
+        return "table: highest score is not the model.predict() class";
+    }
+    float table_score[FOREST_MAX_CLASSES];
+    for (int c = 0; c < SOLAR_FOREST.num_classes; c++) {
+        table_score[c] = explanation.score[c];
+    }
+
+    const Forest* forest = &blob->forest;
+    float proba[FOREST_MAX_CLASSES];
+    int blob_class = forest_blob_predict_proba(blob, x, proba);
+    if (forest_blob_predict_explain(blob, x, &explanation) != blob_class) {
+        return "blob: class differs from forest_blob_predict_proba()";
+    }
+    for (int c = 0; c < forest->num_classes; c++) {
+        if (explanation.score[c] != proba[c]) {
+            return "blob: score differs from forest_blob_predict_proba()";
+        }
+        if (std::fabs(explanation.score[c] - table_score[c]) > ATTRIBUTION_TOLERANCE) {
+            return "blob: score differs from the table's";
+        }
+    }
+    if (attribution_error(explanation, forest->num_features, forest->num_classes) > ATTRIBUTION_TOLERANCE) {
+        return "blob: contributions do not add up to the score";
+    }
+    return NULL;
+}
+
+int main() {
+    std::vector<BenchRow> rows = bench_load_panel_dataset();
+    std::vector<BenchRow> telemetry = bench_load_telemetry();
+    rows.insert(rows.end(), telemetry.begin(), telemetry.end());
+    std::vector<int> expected, telemetry_expected, vote;
+    if (bench_load_golden("solar_panel_dataset.csv", &expected, &vote) < 0 ||
+        bench_load_golden("solar_data.csv", &telemetry_expected, &vote) < 0) {
+        return 1;
+    }
+    expected.insert(expected.end(), telemetry_expected.begin(), telemetry_expected.end());
+    if (rows.empty() || rows.size() != expected.size()) {
+        std::fprintf(stderr, "%zu rows but %zu golden classes\n", rows.size(), expected.size());
+        return 1;
+    }
+    size_t n = rows.size();
+
+    ForestBlobStatus status;
+    ForestModelPtr model = forest_blob_read_path(SOLAR_BLOB_PATH, &status);
+    if (!model) {
+        std::printf("%s: %s\n", SOLAR_BLOB_PATH, forest_blob_error(status));
+        return 1;
+    }
+    const ForestBlob* blob = &model->blob;
+    if (!blob->node_proba) {
+        std::printf("%s has no split distributions - re-run ml/step3_export_to_esp32.py\n", SOLAR_BLOB_PATH);
+        return 1;
+    }
+
+    size_t errors = 0;
+    for (size_t i = 0; i < n; i++) {
+        const char* error = check_row(blob, rows[i].features, expected[i]);
+        if (!error) continue;
+        if (errors < ERRORS_SHOWN) std::printf("row %zu: %s\n", i, error);
+        errors++;
+    }
+
+    // Overhead over the plain predictions
+    double best_manual = 1e30, best_plain = 1e30, best_explain = 1e30, best_blob = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        float sink = 0.0f;
+        double t0 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            sink += predict(rows[i].features);
+        }
+        double t1 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            sink += forest_predict(&SOLAR_FOREST, rows[i].features);
+        }
+        double t2 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            ForestExplanation explanation;
+            int c = forest_predict_explain(&SOLAR_FOREST_EXPLAIN, FOREST_NODE_VALUES, rows[i].features, &explanation);
+            sink += c + explanation.contributions[0][c];
+        }
+        double t3 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            ForestExplanation explanation;
+            int c = forest_blob_predict_explain(blob, rows[i].features, &explanation);
+            sink += c + explanation.contributions[0][c];
+        }
+        double t4 = bench_now_ns();
+        bench_sink = (int)sink;
+        if (t1 - t0 < best_manual) best_manual = t1 - t0;
+        if (t2 - t1 < best_plain) best_plain = t2 - t1;
+        if (t3 - t2 < best_explain) best_explain = t3 - t2;
+        if (t4 - t3 < best_blob) best_blob = t4 - t3;
+    }
+
+    // Mean |contribution| to the predicted class over fault predictions
+    double share[FOREST_MAX_FEATURES] = {0};
+    double total = 0.0;
+    size_t faults = 0;
+    for (size_t i = 0; i < n; i++) {
+        ForestExplanation explanation;
+        int c = forest_predict_explain(&SOLAR_FOREST_EXPLAIN, FOREST_NODE_VALUES, rows[i].features, &explanation);
+        if (c == NORMAL_CLASS) continue;
+        faults++;
+        for (int f = 0; f < SOLAR_FOREST.num_features; f++) {
+            share[f] += std::fabs(explanation.contributions[f][c]);
+            total += std::fabs(explanation.contributions[f][c]);
+        }
+    }
+
+    std::printf("Rows: %zu (both datasets, best of %d runs)\n", n, BENCH_REPEATS);
+    std::printf("  predict() (model_manual.h)      %6.1f ns/sample\n", best_manual / n);
+    std::printf("  forest_predict()                %6.1f ns/sample\n", best_plain / n);
+    std::printf("  forest_predict_explain()        %6.1f ns/sample  (%.2fx forest_predict)\n",
+                best_explain / n, best_explain / best_plain);
+    std::printf("  forest_blob_predict_explain()   %6.1f ns/sample\n", best_blob / n);
+    if (faults && total > 0.0) {
+        std::printf("Share of the attribution in %zu fault predictions:\n", faults);
+        for (int f = 0; f < SOLAR_FOREST.num_features; f++) {
+            std::printf("  %-16s %5.1f%%\n", FOREST_FEATURE_NAMES[f], 100.0 * share[f] / total);
+        }
+    }
+    std::printf("Checks: %zu failed rows\n", errors);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,292 @@
+/*
+ * Solar Panel Fault Detection - Forest Growth Benchmark
+ *
+ * How latency and flash grow with the number of trees and their depth,
+ * for the flat node table (forest_runtime.h, 8-byte nodes) and the
+ * compact encoding (forest_compact.h, 4-byte nodes + threshold table).
+ *
+ * The forests are trained here, on all five classes of
+ * data/solar_panel_dataset.csv (Dust_Accumulation included), with the
+ * same recipe as sklearn's RandomForestClassifier: bootstrap rows,
+ * sqrt(features) candidates per split, Gini impurity, midpoint
+ * thresholds. That gives realistic tree shapes without needing Python;
+ * the exporter encodes a real model the same way (export_compact()).
+ * Both encodings must give the same class for every row.
+ *
+ * Build and run (from benchmarks/):
+ *   g++ -O2 -std=c++11 -I../models bench_growth.cpp -o bench_growth
+ *   ./bench_growth
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "forest_runtime.h"
+#include "forest_compact.h"
+#include "bench_common.h"
+
+#define BENCH_REPEATS 3
+#define BENCH_SAMPLES 20000
+#define NUM_FEATURES BENCH_NUM_FEATURES
+// sqrt(NUM_FEATURES) candidates per split, as sklearn rounds it down
+#define SPLIT_CANDIDATES 2
+
+static const int TREE_COUNTS[] = {10, 50, 100, 200, 400};
+static const int DEPTHS[] = {5, 10, 14};
+
+struct Dataset {
+    std::vector<BenchRow> rows;
+    std::vector<int> labels;
+    std::vector<std::string> class_names;   // Sorted, as LabelEncoder
+};
+
+static Dataset load_labeled_dataset() {
+    Dataset data;
+    data.rows = bench_load_panel_dataset();
+
+    std::ifstream file(SOLAR_DATA_DIR "solar_panel_dataset.csv");
+    std::string line;
+    std::getline(file, line);
+    std::vector<std::string> header = bench_split(line);
+    size_t label_col = std::find(header.begin(), header.end(), "Fault_Status") - header.begin();
+
+    std::vector<std::string> names;
+    while (std::getline(file, line)) {
+        std::vector<std::string> cells = bench_split(line);
+        names.push_back(label_col < cells.size() ? cells[label_col] : "");
+    }
+    std::map<std::string, int> index;
+    for (size_t i = 0; i < names.size(); i++) index[names[i]] = 0;
+    for (std::map<std::string, int>::iterator it = index.begin(); it != index.end(); ++it) {
+        it->second = (int)data.class_names.size();
+        data.class_names.push_back(it->first);
+    }
+    for (size_t i = 0; i < names.size(); i++) data.labels.push_back(index[names[i]]);
+    return data;
+}
+
+// Small deterministic generator, so every run trains the same forests
+struct Rng {
+    uint32_t state;
+    uint32_t next() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+};
+
+struct Trainer {
+    const Dataset* data;
+    int num_classes;
+    int max_depth;
+    Rng rng;
+    std::vector<ForestNode> nodes;
+
+    int majority(const std::vector<int>& idx) {
+        std::vector<int> counts(num_classes, 0);
+        for (size_t i = 0; i < idx.size(); i++) counts[data->labels[idx[i]]]++;
+        return (int)(std::max_element(counts.begin(), counts.end()) - counts.begin());
+    }
+
+    static double gini(const std::vector<int>& counts, int n) {
+        double sum = 0;
+        for (size_t c = 0; c < counts.size(); c++) sum += (double)counts[c] * counts[c];
+        return n ? 1.0 - sum / ((double)n * n) : 0.0;
+    }
+
+    void leaf(int value) {
+        ForestNode node = {0.0f, 0, FOREST_LEAF, (uint8_t)value};
+        nodes.push_back(node);
+    }
+
+    void grow(std::vector<int>& idx, int depth) {
+        int n = (int)idx.size();
+        int first = data->labels[idx[0]];
+        bool pure = true;
+        for (int i = 1; i < n && pure; i++) pure = data->labels[idx[i]] == first;
+        if (depth == max_depth || pure || n < 2) {
+            leaf(majority(idx));
+            return;
+        }
+
+        int features[NUM_FEATURES];
+        for (int i = 0; i < NUM_FEATURES; i++) features[i] = i;
+        for (int i = NUM_FEATURES - 1; i > 0; i--) std::swap(features[i], features[rng.next() % (i + 1)]);
+
+        double best_score = 1e30;
+        int best_feature = -1;
+        float best_threshold = 0;
+        for (int k = 0; k < SPLIT_CANDIDATES; k++) {
+            int f = features[k];
+            std::vector<int> order(idx);
+            std::sort(order.begin(), order.end(), [&](int a, int b) {
+                return data->rows[a].features[f] < data->rows[b].features[f];
+            });
+            std::vector<int> left(num_classes, 0), right(num_classes, 0);
+            for (int i = 0; i < n; i++) right[data->labels[order[i]]]++;
+            for (int i = 0; i + 1 < n; i++) {
+                left[data->labels[order[i]]]++;
+                right[data->labels[order[i]]]--;
+                float a = data->rows[order[i]].features[f];
+                float b = data->rows[order[i + 1]].features[f];
+                if (a == b) continue;
+                double score = (i + 1) * gini(left, i + 1) + (n - i - 1) * gini(right, n - i - 1);
+                if (score < best_score) {
+                    float t = a + (b - a) / 2;
+                    best_score = score;
+                    best_feature = f;
+                    best_threshold = (t < b) ? t : a;
+                }
+            }
+        }
+        if (best_feature < 0) {
+            leaf(majority(idx));
+            return;
+        }
+
+        std::vector<int> left_idx, right_idx;
+        for (int i = 0; i < n; i++) {
+            int r = idx[i];
+            if (data->rows[r].features[best_feature] <= best_threshold) left_idx.push_back(r);
+            else right_idx.push_back(r);
+        }
+        size_t split = nodes.size();
+        ForestNode node = {best_threshold, 0, (uint8_t)best_feature, 0};
+        nodes.push_back(node);
+        grow(left_idx, depth + 1);
+        nodes[split].right = (uint16_t)(nodes.size() - split);
+        grow(right_idx, depth + 1);
+    }
+};
+
+struct Model {
+    std::vector<ForestNode> nodes;
+    std::vector<uint32_t> roots;
+
+    // Compact encoding of the same trees
+    std::vector<ForestCompactNode> compact_nodes;
+    std::vector<float> thresholds;
+    std::vector<uint16_t> offsets;
+    CompactForest compact;
+};
+
+static void train(Model& model, const Dataset& data, int num_trees, int max_depth) {
+    Trainer trainer;
+    trainer.data = &data;
+    trainer.num_classes = (int)data.class_names.size();
+    trainer.max_depth = max_depth;
+    trainer.rng.state = 2463534242u + num_trees * 31 + max_depth;
+
+    for (int t = 0; t < num_trees; t++) {
+        std::vector<int> idx(data.rows.size());
+        for (size_t i = 0; i < idx.size(); i++) idx[i] = trainer.rng.next() % data.rows.size();
+        model.roots.push_back((uint32_t)trainer.nodes.size());
+        trainer.grow(idx, 0);
+    }
+    model.nodes.swap(trainer.nodes);
+}
+
+// Same steps as encode_compact() in ml/step3_export_to_esp32.py
+static bool encode(Model& model, const Dataset& data) {
+    std::vector<std::vector<float> > per_feature(NUM_FEATURES);
+    for (size_t i = 0; i < model.nodes.size(); i++) {
+        const ForestNode& node = model.nodes[i];
+        if (node.feature != FOREST_LEAF) per_feature[node.feature].push_back(node.threshold);
+    }
+    model.offsets.push_back(0);
+    for (int f = 0; f < NUM_FEATURES; f++) {
+        std::vector<float>& v = per_feature[f];
+        std::sort(v.begin(), v.end());
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+        if (v.size() > 0x0FFF) return false;
+        model.thresholds.insert(model.thresholds.end(), v.begin(), v.end());
+        model.offsets.push_back((uint16_t)model.thresholds.size());
+    }
+
+    for (size_t i = 0; i < model.nodes.size(); i++) {
+        const ForestNode& node = model.nodes[i];
+        ForestCompactNode c;
+        if (node.feature == FOREST_LEAF) {
+            c.key = FOREST_COMPACT_LEAF | node.value;
+            c.right = 0;
+        } else {
+            const std::vector<float>& v = per_feature[node.feature];
+            int k = (int)(std::lower_bound(v.begin(), v.end(), node.threshold) - v.begin());
+            c.key = (uint16_t)((node.feature << 12) | k);
+            c.right = node.right;
+        }
+        model.compact_nodes.push_back(c);
+    }
+
+    CompactForest forest = {
+        &model.compact_nodes[0], &model.roots[0], &model.thresholds[0], &model.offsets[0],
+        (uint16_t)model.roots.size(), NUM_FEATURES, (uint16_t)data.class_names.size(),
+        NULL, NULL, NULL,
+    };
+    model.compact = forest;
+    return true;
+}
+
+// forest_predict_scaled() with 32-bit roots, so forests past 65535 nodes still run
+static int flat_predict(const Model& model, int num_classes, const float* x) {
+    int votes[FOREST_MAX_CLASSES] = {0};
+    for (size_t t = 0; t < model.roots.size(); t++) {
+        votes[forest_tree_predict(&model.nodes[model.roots[t]], x)]++;
+    }
+    return forest_argmax(votes, num_classes);
+}
+
+int main() {
+    Dataset data = load_labeled_dataset();
+    if (data.rows.empty() || data.rows.size() != data.labels.size()) return 1;
+    int num_classes = (int)data.class_names.size();
+    std::vector<BenchRow> samples = bench_repeat(data.rows, BENCH_SAMPLES);
+    bench_shuffle(samples);
+    size_t n = samples.size();
+
+    std::printf("Classes (%d):", num_classes);
+    for (int c = 0; c < num_classes; c++) std::printf(" %s", data.class_names[c].c_str());
+    std::printf("\n%zu samples, best of %d runs\n\n", n, BENCH_REPEATS);
+    std::printf("trees depth   nodes  thresh | flat bytes  ns/sample | compact bytes  ns/sample | mismatches\n");
+
+    int failed = 0;
+    for (size_t a = 0; a < sizeof(TREE_COUNTS) / sizeof(TREE_COUNTS[0]); a++) {
+        for (size_t b = 0; b < sizeof(DEPTHS) / sizeof(DEPTHS[0]); b++) {
+            Model model;
+            train(model, data, TREE_COUNTS[a], DEPTHS[b]);
+            if (!encode(model, data)) {
+                std::fprintf(stderr, "more than 4095 thresholds on one feature\n");
+                return 1;
+            }
+
+            std::vector<int> flat(n), compact(n);
+            double flat_ns = 1e30, compact_ns = 1e30;
+            for (int r = 0; r < BENCH_REPEATS; r++) {
+                double t0 = bench_now_ns();
+                for (size_t i = 0; i < n; i++) flat[i] = flat_predict(model, num_classes, samples[i].features);
+                double t1 = bench_now_ns();
+                for (size_t i = 0; i < n; i++) compact[i] = compact_forest_predict(&model.compact, samples[i].features);
+                double t2 = bench_now_ns();
+                flat_ns = std::min(flat_ns, (t1 - t0) / n);
+                compact_ns = std::min(compact_ns, (t2 - t1) / n);
+            }
+
+            size_t mismatches = 0;
+            for (size_t i = 0; i < n; i++) mismatches += flat[i] != compact[i];
+            failed |= mismatches != 0;
+
+            size_t nodes = model.nodes.size();
+            size_t flat_bytes = 8 * nodes + 2 * model.roots.size();
+            size_t compact_bytes = 4 * nodes + 4 * model.thresholds.size() + 4 * model.roots.size();
+            std::printf("%5d %5d %7zu %7zu | %10zu %10.1f | %13zu %10.1f | %zu%s\n",
+                        TREE_COUNTS[a], DEPTHS[b], nodes, model.thresholds.size(),
+                        flat_bytes, flat_ns, compact_bytes, compact_ns, mismatches,
+                        nodes > 65535 ? "  (too many nodes for Forest's uint16_t roots)" : "");
+        }
+    }
+    return failed;
+}
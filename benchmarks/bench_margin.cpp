@@ -0,0 +1,175 @@
+/*
+ * Solar Panel Fault Detection - Decision Margin Check and Benchmark
+ *
+ * Runs forest_predict_margin() (forest_runtime.h) over every row of both
+ * datasets with the flat node table (model_table.h) and checks that:
+ *
+ *   - the class matches forest_predict()
+ *   - moving any one feature by just under distance[f], either way,
+ *     leaves every tree in the same leaf
+ *   - moving it by just over distance[f] changes some tree's leaf in at
+ *     least one direction, so the distance is not merely a lower bound
+ *   - vote_margin is the winner's votes minus the runner-up's
+ *
+ * Then prints the overhead over forest_predict(), the vote margin
+ * histogram and how many rows sit farther than 5% of each feature's range
+ * from every threshold (where a sender node could sample slowly).
+ * Exits non-zero on any failed check.
+ *
+ * Build and run (from benchmarks/):
+ *   g++ -O2 -std=c++11 -I../models bench_margin.cpp -o bench_margin
+ *   ./bench_margin
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "model_table.h"
+#include "bench_common.h"
+
+#define BENCH_REPEATS 5
+#define FAR_SHARE_OF_RANGE 0.05f
+#define ERRORS_SHOWN 5
+
+// Leaf of every tree for one input
+static void tree_leaves(const float* x, std::vector<const ForestNode*>& leaves) {
+    leaves.resize(SOLAR_FOREST.num_trees);
+    for (int t = 0; t < SOLAR_FOREST.num_trees; t++) {
+        leaves[t] = forest_tree_leaf(SOLAR_FOREST.nodes + SOLAR_FOREST.roots[t], x);
+    }
+}
+
+static bool same_leaves(const float* x, const std::vector<const ForestNode*>& reference) {
+    std::vector<const ForestNode*> leaves;
+    tree_leaves(x, leaves);
+    for (int t = 0; t < SOLAR_FOREST.num_trees; t++) {
+        if (leaves[t] != reference[t]) return false;
+    }
+    return true;
+}
+
+// Checks one row; returns a description of the first failure or NULL
+static const char* check_row(const float* x, const ForestMargin& margin, int* feature) {
+    *feature = -1;
+    if (margin.class_idx != forest_predict(&SOLAR_FOREST, x)) return "class differs from forest_predict()";
+
+    int votes[FOREST_MAX_CLASSES] = {0};
+    std::vector<const ForestNode*> leaves;
+    tree_leaves(x, leaves);
+    for (int t = 0; t < SOLAR_FOREST.num_trees; t++) {
+        votes[leaves[t]->value]++;
+    }
+    int runner_up = 0;
+    for (int c = 0; c < SOLAR_FOREST.num_classes; c++) {
+        if (c != margin.class_idx && votes[c] > runner_up) runner_up = votes[c];
+    }
+    if (margin.vote_margin != votes[margin.class_idx] - runner_up) return "wrong vote_margin";
+
+    for (int f = 0; f < SOLAR_FOREST.num_features; f++) {
+        *feature = f;
+        float d = margin.distance[f];
+        if (d == FLT_MAX) continue;
+
+        // Steps a little inside and outside the distance, wider than float rounding
+        float slack = 1e-5f * (std::fabs(x[f]) + 1.0f);
+        float inside = d * 0.99f - slack;
+        float outside = d * 1.01f + slack;
+        float moved[FOREST_MAX_FEATURES];
+        for (int g = 0; g < SOLAR_FOREST.num_features; g++) moved[g] = x[g];
+
+        if (inside > 0.0f) {
+            moved[f] = x[f] + inside;
+            if (!same_leaves(moved, leaves)) return "leaf changed inside distance (up)";
+            moved[f] = x[f] - inside;
+            if (!same_leaves(moved, leaves)) return "leaf changed inside distance (down)";
+        }
+
+        moved[f] = x[f] + outside;
+        bool up_changed = !same_leaves(moved, leaves);
+        moved[f] = x[f] - outside;
+        bool down_changed = !same_leaves(moved, leaves);
+        if (!up_changed && !down_changed) return "no leaf changes just past distance";
+    }
+    return NULL;
+}
+
+int main() {
+    std::vector<BenchRow> rows = bench_load_panel_dataset();
+    std::vector<BenchRow> telemetry = bench_load_telemetry();
+    rows.insert(rows.end(), telemetry.begin(), telemetry.end());
+    if (rows.empty()) return 1;
+    size_t n = rows.size();
+
+    std::vector<ForestMargin> margins(n);
+    for (size_t i = 0; i < n; i++) {
+        forest_predict_margin(&SOLAR_FOREST, rows[i].features, &margins[i]);
+    }
+
+    size_t errors = 0;
+    for (size_t i = 0; i < n; i++) {
+        int feature;
+        const char* error = check_row(rows[i].features, margins[i], &feature);
+        if (!error) continue;
+        if (errors < ERRORS_SHOWN) {
+            std::printf("row %zu: %s%s%s\n", i, error, feature >= 0 ? " - " : "",
+                        feature >= 0 ? FOREST_FEATURE_NAMES[feature] : "");
+        }
+        errors++;
+    }
+
+    // Overhead over forest_predict()
+    double best_plain = 1e30, best_margin = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        int sink = 0;
+        double t0 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            sink += forest_predict(&SOLAR_FOREST, rows[i].features);
+        }
+        double t1 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            ForestMargin margin;
+            sink += forest_predict_margin(&SOLAR_FOREST, rows[i].features, &margin);
+            sink += margin.vote_margin;
+        }
+        double t2 = bench_now_ns();
+        bench_sink = sink;
+        if (t1 - t0 < best_plain) best_plain = t1 - t0;
+        if (t2 - t1 < best_margin) best_margin = t2 - t1;
+    }
+
+    // Rows far from every threshold, relative to each feature's range
+    float lo[FOREST_MAX_FEATURES], hi[FOREST_MAX_FEATURES];
+    for (int f = 0; f < SOLAR_FOREST.num_features; f++) {
+        lo[f] = hi[f] = rows[0].features[f];
+    }
+    for (size_t i = 0; i < n; i++) {
+        for (int f = 0; f < SOLAR_FOREST.num_features; f++) {
+            if (rows[i].features[f] < lo[f]) lo[f] = rows[i].features[f];
+            if (rows[i].features[f] > hi[f]) hi[f] = rows[i].features[f];
+        }
+    }
+    std::vector<size_t> histogram(SOLAR_FOREST.num_trees + 1, 0);
+    size_t far = 0;
+    for (size_t i = 0; i < n; i++) {
+        histogram[margins[i].vote_margin]++;
+        bool all_far = true;
+        for (int f = 0; f < SOLAR_FOREST.num_features; f++) {
+            if (margins[i].distance[f] < FAR_SHARE_OF_RANGE * (hi[f] - lo[f])) all_far = false;
+        }
+        if (all_far) far++;
+    }
+
+    std::printf("Rows: %zu (both datasets, best of %d runs)\n", n, BENCH_REPEATS);
+    std::printf("  forest_predict()         %6.1f ns/sample\n", best_plain / n);
+    std::printf("  forest_predict_margin()  %6.1f ns/sample\n", best_margin / n);
+    std::printf("Vote margin:\n");
+    for (size_t m = 0; m < histogram.size(); m++) {
+        if (histogram[m]) std::printf("  %2zu  %6zu rows (%5.1f%%)\n", m, histogram[m], 100.0 * histogram[m] / n);
+    }
+    std::printf("Farther than %.0f%% of every feature's range from all thresholds: %zu rows (%.1f%%)\n",
+                FAR_SHARE_OF_RANGE * 100, far, 100.0 * far / n);
+    std::printf("Checks: %zu failed rows\n", errors);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * Solar Panel Fault Detection - Arduino Nano Integer Forest Check
+ *
+ * Proves that the integer forest of model_nano.h gives the same class as
+ * the float forest of model_table.h for every possible reading, where
+ * reading q of feature f is the float q * NANO_FEATURE_LSB[f].
+ *
+ * Both forests are step functions of each reading that only change
+ * between q and q + 1 at a split, so checking every combination of
+ * 0, 65535 and the readings on both sides of each integer threshold and
+ * each float crossing (found here by binary search in native float math)
+ * covers all 2^64 inputs. The dataset rows are then replayed as rounded
+ * readings and timed.
+ *
+ * Build and run (from benchmarks/):
+ *   g++ -O2 -std=c++11 -I../models bench_nano.cpp -o bench_nano
+ *   ./bench_nano
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "model_nano.h"
+#include "model_table.h"
+#include "bench_common.h"
+
+#define BENCH_REPEATS 5
+#define NANO_READING_MAX 0xFFFF
+
+// The float model's input for reading q of feature f
+static float nano_value(int f, uint32_t q) {
+    return (float)q * NANO_FEATURE_LSB[f];
+}
+
+static bool float_goes_left(const ForestNode* node, uint32_t q) {
+    float x = nano_value(node->feature, q);
+    if (SOLAR_FOREST.scaler_mean) {
+        x = (x - SOLAR_FOREST.scaler_mean[node->feature]) / SOLAR_FOREST.scaler_std[node->feature];
+    }
+    return x <= node->threshold;
+}
+
+// Readings on both sides of every place where either forest can change
+static std::vector<std::vector<uint16_t> > boundary_readings() {
+    std::vector<std::vector<uint16_t> > points(NANO_NUM_FEATURES);
+    for (int f = 0; f < NANO_NUM_FEATURES; f++) {
+        points[f].push_back(0);
+        points[f].push_back(NANO_READING_MAX);
+    }
+
+    size_t num_nano = sizeof(NANO_NODES) / sizeof(NANO_NODES[0]);
+    for (size_t i = 0; i < num_nano; i++) {
+        const NanoNode& node = NANO_NODES[i];
+        if (node.feature == NANO_LEAF) continue;
+        points[node.feature].push_back(node.threshold);
+        points[node.feature].push_back(node.threshold + 1);
+    }
+
+    size_t num_float = sizeof(FOREST_NODES) / sizeof(FOREST_NODES[0]);
+    for (size_t i = 0; i < num_float; i++) {
+        const ForestNode* node = &FOREST_NODES[i];
+        if (node->feature == FOREST_LEAF) continue;
+        // Last reading that goes left (the value is monotonic in q)
+        uint32_t lo = 0, hi = NANO_READING_MAX + 1;
+        if (!float_goes_left(node, 0)) continue;
+        while (hi - lo > 1) {
+            uint32_t mid = (lo + hi) / 2;
+            if (float_goes_left(node, mid)) lo = mid;
+            else hi = mid;
+        }
+        points[node->feature].push_back((uint16_t)lo);
+        if (lo < NANO_READING_MAX) points[node->feature].push_back((uint16_t)(lo + 1));
+    }
+
+    for (int f = 0; f < NANO_NUM_FEATURES; f++) {
+        std::sort(points[f].begin(), points[f].end());
+        points[f].erase(std::unique(points[f].begin(), points[f].end()), points[f].end());
+    }
+    return points;
+}
+
+static int float_predict(const uint16_t* readings) {
+    float x[NANO_NUM_FEATURES];
+    for (int f = 0; f < NANO_NUM_FEATURES; f++) {
+        x[f] = nano_value(f, readings[f]);
+    }
+    return forest_predict(&SOLAR_FOREST, x);
+}
+
+// Nearest reading of a raw sensor value
+static uint16_t to_reading(int f, float x) {
+    float q = std::floor(x / NANO_FEATURE_LSB[f] + 0.5f);
+    return (uint16_t)std::min(std::max(q, 0.0f), (float)NANO_READING_MAX);
+}
+
+int main() {
+    // Every cell of every feature's step function, in all combinations
+    std::vector<std::vector<uint16_t> > points = boundary_readings();
+    size_t combos = 1;
+    for (int f = 0; f < NANO_NUM_FEATURES; f++) combos *= points[f].size();
+
+    size_t mismatches = 0;
+    uint16_t readings[NANO_NUM_FEATURES];
+    for (size_t k = 0; k < combos; k++) {
+        size_t rest = k;
+        for (int f = 0; f < NANO_NUM_FEATURES; f++) {
+            readings[f] = points[f][rest % points[f].size()];
+            rest /= points[f].size();
+        }
+        mismatches += nano_forest_predict(&SOLAR_NANO_FOREST, readings) != float_predict(readings);
+    }
+    std::printf("Boundary readings per feature:");
+    for (int f = 0; f < NANO_NUM_FEATURES; f++) std::printf(" %zu", points[f].size());
+    std::printf("\nAll %zu combinations: %zu mismatches\n\n", combos, mismatches);
+
+    // Dataset rows as the Nano would read them
+    std::vector<BenchRow> rows = bench_load_panel_dataset();
+    std::vector<BenchRow> telemetry = bench_load_telemetry();
+    rows.insert(rows.end(), telemetry.begin(), telemetry.end());
+    if (rows.empty()) return 1;
+
+    size_t n = rows.size();
+    std::vector<uint16_t> quantized(n * NANO_NUM_FEATURES);
+    size_t rounding_changes = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint16_t* q = &quantized[i * NANO_NUM_FEATURES];
+        for (int f = 0; f < NANO_NUM_FEATURES; f++) q[f] = to_reading(f, rows[i].features[f]);
+        mismatches += nano_forest_predict(&SOLAR_NANO_FOREST, q) != float_predict(q);
+        rounding_changes += float_predict(q) != forest_predict(&SOLAR_FOREST, rows[i].features);
+    }
+
+    double nano_ns = 1e30, float_ns = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        int sum = 0;
+        double t0 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            sum += nano_forest_predict(&SOLAR_NANO_FOREST, &quantized[i * NANO_NUM_FEATURES]);
+        }
+        double t1 = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            sum += forest_predict(&SOLAR_FOREST, rows[i].features);
+        }
+        double t2 = bench_now_ns();
+        bench_sink = sum;
+        nano_ns = std::min(nano_ns, (t1 - t0) / n);
+        float_ns = std::min(float_ns, (t2 - t1) / n);
+    }
+
+    std::printf("%zu dataset rows as readings, best of %d runs\n", n, BENCH_REPEATS);
+    std::printf("  nano_forest_predict()  %6.1f ns/sample\n", nano_ns);
+    std::printf("  forest_predict()       %6.1f ns/sample\n", float_ns);
+    std::printf("  rounding to readings changes %zu classes vs the raw floats\n", rounding_changes);
+    std::printf("Total mismatches: %zu\n", mismatches);
+    return mismatches != 0;
+}
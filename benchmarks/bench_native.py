@@ -0,0 +1,152 @@
+"""
+=============================================================================
+🔆 SOLAR PANEL FAULT DETECTION - Native vs sklearn Backend Latency
+=============================================================================
+Times the backend's prediction hot path both ways on the dataset rows:
+
+  per record   one call per reading (the old predict_fault() path:
+               scaler.transform + predict + predict_proba)
+  per batch    one call per /api/gateway-data sized payload
+
+for the native library (backend/native) and for the sklearn model the
+blob was exported from (ml/*.joblib). Fails when a native batch disagrees
+with per-record calls, or, with sklearn installed, when a native class
+differs from sklearn's predict().
+
+Run (from benchmarks/, after building backend/native/libsolar_forest.so):
+    python3 bench_native.py
+=============================================================================
+"""
+
+import csv
+import os
+import sys
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(HERE)
+sys.path.insert(0, os.path.join(ROOT, 'backend'))
+
+from native.solar_forest import load_native_forest  # noqa: E402
+
+# Columns of [Voltage, Current, Temperature, Light_Intensity, Efficiency];
+# None: efficiency computed as the backend does (calculate_efficiency)
+DATASETS = [
+    ('solar_panel_dataset.csv', ['Voltage', 'Current', 'Temperature', 'Light_Intensity', 'Efficiency']),
+    ('solar_data.csv', ['voltage_v', 'current_a', 'temperature_c', 'light_lux', None]),
+]
+BATCH_SIZES = [1, 8, 32, 128]
+RECORD_LIMIT = 2000     # Per-record timing rows (sklearn is slow per call)
+REPEATS = 5
+
+
+def calculate_efficiency(voltage, current, light):
+    """backend/main.py calculate_efficiency() (kept here to avoid importing the app)."""
+    solar_input = light * 0.0079 * 1.6
+    if solar_input > 0:
+        return round(min(25, max(0, voltage * current / solar_input * 100)), 2)
+    return 0.0
+
+
+def load_rows():
+    """Feature rows of both datasets, in blob feature order."""
+    rows = []
+    for name, columns in DATASETS:
+        with open(os.path.join(ROOT, 'data', name)) as f:
+            for record in csv.DictReader(f):
+                try:
+                    row = [float(record[c]) for c in columns if c is not None]
+                except (KeyError, TypeError, ValueError):
+                    continue
+                if len(row) < len(columns):
+                    row.append(calculate_efficiency(row[0], row[1], row[3]))
+                rows.append(row)
+    return rows
+
+
+def best_of(fn, count):
+    """Best wall time of fn() over REPEATS runs, in microseconds per item."""
+    best = float('inf')
+    for _ in range(REPEATS):
+        t0 = time.perf_counter()
+        fn()
+        best = min(best, time.perf_counter() - t0)
+    return best / count * 1e6
+
+
+def batches(rows, size):
+    return [rows[i:i + size] for i in range(0, len(rows), size)]
+
+
+def format_us(value):
+    """Column cell for a timing; n/a when the path was not measured."""
+    return f"{value:12.2f}" if value is not None else f"{'n/a':>12s}"
+
+
+def load_sklearn():
+    """(model, scaler, numpy) the blob was exported from, or None without sklearn."""
+    try:
+        import joblib
+        import numpy as np
+        model = joblib.load(os.path.join(ROOT, 'ml', 'solar_fault_rf_model.joblib'))
+        scaler = joblib.load(os.path.join(ROOT, 'ml', 'solar_fault_scaler.joblib'))
+        return model, scaler, np
+    except Exception as e:
+        print(f"⚠️ sklearn path skipped: {e}")
+        return None
+
+
+def main():
+    forest, error = load_native_forest()
+    if forest is None:
+        print(f"❌ {error}")
+        return 1
+    rows = load_rows()
+    record_rows = rows[:RECORD_LIMIT]
+    print(f"Native forest: {forest.blob_path}, model version {forest.model_version}")
+    print(f"Rows: {len(rows)} ({len(record_rows)} for per-record timing)\n")
+
+    # Batches agree with per-record calls
+    classes, _ = forest.predict_batch(rows)
+    single = [forest.predict(row)[0] for row in rows]
+    batch_mismatches = sum(a != b for a, b in zip(classes, single))
+    print(f"Native batch vs per-record: {batch_mismatches} mismatches")
+
+    failures = batch_mismatches
+    sklearn = load_sklearn()
+    if sklearn:
+        model, scaler, np = sklearn
+        expected = model.predict(scaler.transform(np.array(rows)))
+        mismatches = sum(int(a) != int(b) for a, b in zip(classes, expected))
+        print(f"Native vs sklearn predict(): {mismatches} mismatches")
+        failures += mismatches
+    else:
+        print("Native vs sklearn predict(): not checked (sklearn not installed)")
+    print()
+
+    print(f"{'':24s}{'native':>12s}{'sklearn':>12s}   (us per record)")
+    native = best_of(lambda: [forest.predict(row) for row in record_rows], len(record_rows))
+    reference = None
+    if sklearn:
+        def sklearn_record():
+            for row in record_rows:
+                x = scaler.transform(np.array([row]))
+                model.predict(x)
+                model.predict_proba(x)
+        reference = best_of(sklearn_record, len(record_rows))
+    print(f"{'per record':24s}{native:12.2f}{format_us(reference)}")
+
+    for size in BATCH_SIZES:
+        chunks = batches(rows, size)
+        native = best_of(lambda: [forest.predict_batch(chunk) for chunk in chunks], len(rows))
+        reference = None
+        if sklearn:
+            arrays = [np.array(chunk) for chunk in chunks]
+            reference = best_of(lambda: [model.predict_proba(scaler.transform(x)) for x in arrays], len(rows))
+        print(f"{f'batch of {size}':24s}{native:12.2f}{format_us(reference)}")
+
+    return 1 if failures else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
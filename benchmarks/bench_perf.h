@@ -0,0 +1,75 @@
+/*
+ * Solar Panel Fault Detection - Hardware Counters for the Host Benchmarks
+ *
+ * Thin wrapper over perf_event_open(). A counter that the kernel does not
+ * allow (containers, VMs, perf_event_paranoid > 1) or that the platform
+ * lacks reads -1, and the benchmarks print n/a for it.
+ */
+
+#ifndef SOLAR_BENCH_PERF_H
+#define SOLAR_BENCH_PERF_H
+
+#include <cstring>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#define PERF_COUNT_HW_CPU_CYCLES 0
+#define PERF_COUNT_HW_INSTRUCTIONS 1
+#define PERF_COUNT_HW_CACHE_REFERENCES 2
+#define PERF_COUNT_HW_CACHE_MISSES 3
+#define PERF_COUNT_HW_BRANCH_MISSES 5
+#endif
+
+// Hardware counter, fd < 0 when unavailable
+struct Counter {
+    int fd;
+};
+
+inline Counter counter_open(uint64_t config) {
+    Counter counter = {-1};
+#if defined(__linux__)
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    counter.fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    (void)config;
+#endif
+    return counter;
+}
+
+inline void counter_start(Counter counter) {
+#if defined(__linux__)
+    if (counter.fd < 0) return;
+    ioctl(counter.fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(counter.fd, PERF_EVENT_IOC_ENABLE, 0);
+#else
+    (void)counter;
+#endif
+}
+
+// Events since counter_start(), -1 when unavailable
+inline double counter_stop(Counter counter) {
+#if defined(__linux__)
+    if (counter.fd < 0) return -1;
+    ioctl(counter.fd, PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t value = 0;
+    if (read(counter.fd, &value, sizeof(value)) != (ssize_t)sizeof(value)) return -1;
+    return (double)value;
+#else
+    (void)counter;
+    return -1;
+#endif
+}
+
+#endif // SOLAR_BENCH_PERF_H
@@ -0,0 +1,187 @@
+/*
+ * Solar Panel Fault Detection - Soft Voting Parity Check and Benchmark
+ *
+ * Runs soft_forest_predict_proba() (forest_soft.h, model_soft.h) over
+ * every row of both datasets and compares it with the joblib model:
+ *
+ *   - acc[c] / soft_forest_total() against golden/<dataset>_proba.txt
+ *     (model.predict_proba()), within one quantization step
+ *   - the class against golden/<dataset>_expected.txt (model.predict());
+ *     a different class is only accepted when the two best golden
+ *     probabilities are within two quantization steps, where rounding the
+ *     leaf distributions can swap them
+ *
+ * Rows in golden/leaf_gaps.txt are counted but not compared: their float32
+ * readings, scaled as on the device, reach another leaf than sklearn's
+ * float64 inputs in some tree, so their probabilities legitimately differ.
+ *
+ * Reports how often the soft vote and the hard vote (predict(),
+ * model_manual.h) disagree with model.predict(), and the cost of soft
+ * voting over predict(). Exits non-zero on any failed check.
+ *
+ * Build and run (from benchmarks/):
+ *   g++ -O2 -std=c++11 -I../models bench_soft.cpp -o bench_soft
+ *   ./bench_soft
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "model_manual.h"
+#include "model_soft.h"
+#include "bench_common.h"
+
+#define BENCH_REPEATS 5
+#define ERRORS_SHOWN 5
+
+// One dataset with its golden classes and probabilities
+struct SoftSet {
+    const char* name;
+    std::vector<BenchRow> rows;
+    std::vector<int> expected;      // model.predict()
+    std::vector<int> vote;          // hard vote (hard_vote_gaps.txt applied)
+    std::vector<float> proba;       // model.predict_proba(), SOFT_NUM_CLASSES per row
+    std::vector<char> leaf_gap;     // listed in golden/leaf_gaps.txt
+};
+
+static bool load_proba(const std::string& dataset, std::vector<float>* proba) {
+    std::string path = SOLAR_GOLDEN_DIR + dataset.substr(0, dataset.rfind('.')) + "_proba.txt";
+    std::ifstream file(path.c_str());
+    if (!file) {
+        std::fprintf(stderr, "Cannot read %s\n", path.c_str());
+        return false;
+    }
+    float p;
+    while (file >> p) {
+        proba->push_back(p);
+    }
+    return true;
+}
+
+// Marks the rows of golden/leaf_gaps.txt ("<dataset> <row>")
+static bool load_leaf_gaps(SoftSet* sets, int num_sets) {
+    const char* path = SOLAR_GOLDEN_DIR "leaf_gaps.txt";
+    std::ifstream file(path);
+    if (!file) {
+        std::fprintf(stderr, "Cannot read %s\n", path);
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::stringstream cells(line);
+        std::string name;
+        size_t row;
+        if (!(cells >> name >> row)) {
+            std::fprintf(stderr, "%s: bad line '%s'\n", path, line.c_str());
+            return false;
+        }
+        for (int s = 0; s < num_sets; s++) {
+            if (name == sets[s].name && row < sets[s].leaf_gap.size()) sets[s].leaf_gap[row] = 1;
+        }
+    }
+    return true;
+}
+
+int main() {
+    SoftSet sets[2];
+    sets[0].name = "solar_panel_dataset.csv";
+    sets[0].rows = bench_load_panel_dataset();
+    sets[1].name = "solar_data.csv";
+    sets[1].rows = bench_load_telemetry();
+
+    const float step = 1.0f / SOLAR_SOFT_FOREST.proba_scale;
+    const float tolerance = step + 1e-6f;   // plus the golden files' 6 digits
+    const uint32_t total = soft_forest_total(&SOLAR_SOFT_FOREST);
+
+    for (int s = 0; s < 2; s++) {
+        SoftSet& set = sets[s];
+        if (bench_load_golden(set.name, &set.expected, &set.vote) < 0 || !load_proba(set.name, &set.proba)) {
+            return 1;
+        }
+        if (set.rows.empty() || set.rows.size() != set.expected.size() ||
+            set.proba.size() != set.rows.size() * SOFT_NUM_CLASSES) {
+            std::fprintf(stderr, "%s: %zu rows, %zu golden classes, %zu golden probabilities\n", set.name,
+                         set.rows.size(), set.expected.size(), set.proba.size());
+            return 1;
+        }
+        set.leaf_gap.assign(set.rows.size(), 0);
+    }
+    if (!load_leaf_gaps(sets, 2)) return 1;
+
+    size_t n = 0, compared = 0, failed = 0, soft_gaps = 0, hard_gaps = 0, rounding_swaps = 0;
+    float max_error = 0.0f;
+    for (int s = 0; s < 2; s++) {
+        const SoftSet& set = sets[s];
+        n += set.rows.size();
+        for (size_t i = 0; i < set.rows.size(); i++) {
+            if (set.vote[i] != set.expected[i]) hard_gaps++;
+            if (set.leaf_gap[i]) continue;
+            compared++;
+
+            const float* golden = &set.proba[i * SOFT_NUM_CLASSES];
+            uint32_t acc[SOFT_NUM_CLASSES];
+            int soft_class = soft_forest_predict_proba(&SOLAR_SOFT_FOREST, set.rows[i].features, acc);
+
+            const char* error = NULL;
+            for (int c = 0; c < SOFT_NUM_CLASSES; c++) {
+                float diff = std::fabs((float)acc[c] / total - golden[c]);
+                if (diff > max_error) max_error = diff;
+                if (diff > tolerance) error = "probability differs by more than one quantization step";
+            }
+            if (soft_class != set.expected[i]) {
+                soft_gaps++;
+                float best = golden[set.expected[i]];
+                if (best - golden[soft_class] <= 2.0f * step) {
+                    rounding_swaps++;
+                } else if (!error) {
+                    error = "class differs from model.predict() away from a rounding tie";
+                }
+            }
+            if (error) {
+                if (failed < ERRORS_SHOWN) std::printf("%s row %zu: %s\n", set.name, i, error);
+                failed++;
+            }
+        }
+    }
+
+    // Cost of soft voting over the hard vote
+    double best_hard = 1e30, best_soft = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        int sink = 0;
+        double t0 = bench_now_ns();
+        for (int s = 0; s < 2; s++) {
+            for (size_t i = 0; i < sets[s].rows.size(); i++) {
+                sink += predict(sets[s].rows[i].features);
+            }
+        }
+        double t1 = bench_now_ns();
+        for (int s = 0; s < 2; s++) {
+            for (size_t i = 0; i < sets[s].rows.size(); i++) {
+                sink += soft_forest_predict(&SOLAR_SOFT_FOREST, sets[s].rows[i].features);
+            }
+        }
+        double t2 = bench_now_ns();
+        bench_sink = sink;
+        if (t1 - t0 < best_hard) best_hard = t1 - t0;
+        if (t2 - t1 < best_soft) best_soft = t2 - t1;
+    }
+
+    std::printf("Rows: %zu (both datasets, best of %d runs)\n", n, BENCH_REPEATS);
+    std::printf("  predict() (hard vote)          %6.1f ns/sample\n", best_hard / n);
+    std::printf("  soft_forest_predict()          %6.1f ns/sample  (%.2fx)\n", best_soft / n, best_soft / best_hard);
+    std::printf("Compared with model.predict_proba(): %zu rows (%zu in leaf_gaps.txt skipped)\n", compared,
+                n - compared);
+    std::printf("Disagreement with model.predict():\n");
+    std::printf("  soft vote (%d-bit)             %6zu of %zu rows (%.3f%%), %zu at rounding ties\n",
+                FOREST_SOFT_BITS, soft_gaps, compared, 100.0 * soft_gaps / compared, rounding_swaps);
+    std::printf("  hard vote                      %6zu of %zu rows (%.3f%%)\n", hard_gaps, n, 100.0 * hard_gaps / n);
+    std::printf("Max |probability error|: %.6f (quantization step %.6f)\n", max_error, step);
+    std::printf("Checks: %zu failed rows\n", failed);
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,427 @@
+/*
+ * Solar Panel Fault Detection - Inference Microbenchmark Suite
+ *
+ * Times every inference entry point of the generated headers on a Linux
+ * host, no board attached:
+ *
+ *   scale_features()                 model_manual.h
+ *   predict_tree_0 .. predict_tree_N model_manual.h (TREE_FUNCTIONS)
+ *   predict(), predict_early_exit(), predict_batch(), is_fault()
+ *                                    (predict_early_exit() only with
+ *                                    -DPREDICT_EARLY_EXIT)
+ *   RandomForest::predict            model.h (Eloquent) and model_float.h
+ *
+ * Fixtures are the rows of data/solar_panel_dataset.csv, shuffled, plus
+ * the four test vectors of verify_export() in ml/step3_export_to_esp32.py.
+ * For each entry point it prints ns per sample, cycles, instructions,
+ * cache misses and branch misses per sample (n/a without perf counters),
+ * and how its predictions spread over the classes.
+ *
+ * Regression thresholds are relative, so they hold across clock speeds
+ * and hosts: every pass of an entry point follows a pass of a fixed
+ * reference loop (reference_pass(), a hash chain over the same samples
+ * that no header change affects), and each entry point is scored as its
+ * best ns over the best reference ns of the whole run. Passes run in
+ * rounds over all entry points (measure_all()). Best-of times are
+ * used on both sides because single passes on a shared host vary by up
+ * to 50 %. baseline/bench_suite.txt holds these ratios and the host they
+ * were recorded on; a run fails when a ratio exceeds
+ * baseline * (1 + tolerance) + BASELINE_SLACK. Ratios differ somewhat
+ * between CPU models, so on another CPU than the baseline's the margins
+ * are doubled. --record rewrites the baseline. Also fails when the
+ * model_manual.h entry points disagree. Run it on an otherwise idle core:
+ * other jobs time-sliced onto the same core preempt the longer passes
+ * more often than the reference's, and no margin covers that.
+ *
+ * Build and run (from benchmarks/):
+ *   g++ -O2 -std=c++11 -I../models bench_suite.cpp -o bench_suite
+ *   ./bench_suite [--record] [--tolerance 0.25] [--samples N]
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "model_manual.h"
+#include "bench_common.h"
+#include "bench_perf.h"
+
+// Both headers declare Eloquent::ML::Port::RandomForest
+namespace eloquent_f64 {
+#include "model.h"
+}
+namespace eloquent_f32 {
+#include "model_float.h"
+}
+
+#define BENCH_REPEATS 5
+#define BASELINE_FILE "baseline/bench_suite.txt"
+// Absolute margin on the ratios, for entry points a few ns long whose
+// timer and loop overhead noise is large relative to their ratio
+#define BASELINE_SLACK 0.05
+#define REFERENCE_ROUNDS 4
+
+// VERIFY_TEST_CASES in ml/step3_export_to_esp32.py
+static const float TEST_VECTORS[][BENCH_NUM_FEATURES] = {
+    {20.0f, 5.0f, 35.0f, 1000.0f, 18.0f},   // Normal
+    {12.0f, 2.5f, 45.0f, 300.0f, 8.0f},     // Partial Shading
+    {16.5f, 4.0f, 45.0f, 550.0f, 13.0f},    // Dust Accumulation
+    {22.0f, 0.05f, 30.0f, 900.0f, 1.0f},    // Open Circuit
+    {1.5f, 8.0f, 70.0f, 800.0f, 1.5f},      // Short Circuit
+};
+#define NUM_TEST_VECTORS (sizeof(TEST_VECTORS) / sizeof(TEST_VECTORS[0]))
+
+// Samples in the layouts the entry points take
+struct Fixture {
+    std::vector<BenchRow> raw;
+    std::vector<BenchRow> scaled;     // scale_features() of raw
+    std::vector<float> columns;       // raw, column-major for predict_batch()
+    size_t fixtures;                  // Leading rows that are distinct fixtures
+};
+
+// One timed pass writes a class (or any int for non-classifiers) per sample
+struct Entry {
+    std::string name;
+    bool classifies;
+    void (*run)(const Fixture& fixture, int tree, int* out);
+    int tree;
+};
+
+struct Result {
+    double ns;
+    double cycles;
+    double instructions;
+    double cache_misses;
+    double branch_misses;
+};
+
+// Fixed reference work: REFERENCE_ROUNDS FNV-1a rounds over the feature
+// bits of every sample, chained from sample to sample. One dependent
+// multiply after another, so its time follows the clock speed alone and
+// does not depend on any generated header
+static void reference_pass(const Fixture& fixture, int* out) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < fixture.raw.size(); i++) {
+        for (int round = 0; round < REFERENCE_ROUNDS; round++) {
+            for (int f = 0; f < BENCH_NUM_FEATURES; f++) {
+                uint32_t bits;
+                std::memcpy(&bits, &fixture.raw[i].features[f], sizeof(bits));
+                hash = (hash ^ bits) * 16777619u;
+            }
+        }
+        out[i] = (int)(hash >> 31);
+    }
+}
+
+static void run_scale(const Fixture& fixture, int, int* out) {
+    for (size_t i = 0; i < fixture.raw.size(); i++) {
+        float scaled[NUM_FEATURES];
+        scale_features(const_cast<float*>(fixture.raw[i].features), scaled);
+        out[i] = scaled[0] > 0.0f;
+    }
+}
+
+static void run_tree(const Fixture& fixture, int tree, int* out) {
+    const std::vector<BenchRow>& rows = RAW_THRESHOLDS ? fixture.raw : fixture.scaled;
+    TreeFunction predict_tree = TREE_FUNCTIONS[tree];
+    for (size_t i = 0; i < rows.size(); i++) {
+        out[i] = predict_tree(rows[i].features);
+    }
+}
+
+static void run_predict(const Fixture& fixture, int, int* out) {
+    for (size_t i = 0; i < fixture.raw.size(); i++) {
+        out[i] = predict(const_cast<float*>(fixture.raw[i].features));
+    }
+}
+
+#ifdef PREDICT_EARLY_EXIT
+static void run_early_exit(const Fixture& fixture, int, int* out) {
+    for (size_t i = 0; i < fixture.raw.size(); i++) {
+        out[i] = predict_early_exit(const_cast<float*>(fixture.raw[i].features));
+    }
+}
+#endif
+
+static void run_batch(const Fixture& fixture, int, int* out) {
+    predict_batch(&fixture.columns[0], fixture.raw.size(), out);
+}
+
+static void run_is_fault(const Fixture& fixture, int, int* out) {
+    for (size_t i = 0; i < fixture.raw.size(); i++) {
+        out[i] = is_fault(const_cast<float*>(fixture.raw[i].features));
+    }
+}
+
+template <class Model>
+static void run_eloquent(const Fixture& fixture, int* out) {
+    Model model;
+    for (size_t i = 0; i < fixture.scaled.size(); i++) {
+        out[i] = model.predict(const_cast<float*>(fixture.scaled[i].features));
+    }
+}
+
+static void run_eloquent_f64(const Fixture& fixture, int, int* out) {
+    run_eloquent<eloquent_f64::Eloquent::ML::Port::RandomForest>(fixture, out);
+}
+
+static void run_eloquent_f32(const Fixture& fixture, int, int* out) {
+    run_eloquent<eloquent_f32::Eloquent::ML::Port::RandomForest>(fixture, out);
+}
+
+// One timed pass of an entry point, totals over all samples
+static Result measure(const Entry& entry, const Fixture& fixture, std::vector<int>& out) {
+    static Counter cycles = counter_open(PERF_COUNT_HW_CPU_CYCLES);
+    static Counter instructions = counter_open(PERF_COUNT_HW_INSTRUCTIONS);
+    static Counter cache_misses = counter_open(PERF_COUNT_HW_CACHE_MISSES);
+    static Counter branch_misses = counter_open(PERF_COUNT_HW_BRANCH_MISSES);
+    counter_start(cycles);
+    counter_start(instructions);
+    counter_start(cache_misses);
+    counter_start(branch_misses);
+    double t0 = bench_now_ns();
+    entry.run(fixture, entry.tree, &out[0]);
+    double elapsed = bench_now_ns() - t0;
+    Result pass = {elapsed, counter_stop(cycles), counter_stop(instructions),
+                   counter_stop(cache_misses), counter_stop(branch_misses)};
+    return pass;
+}
+
+// Best of BENCH_REPEATS rounds, per sample; counters from the best pass.
+// A round runs every entry point once, each right after a reference pass,
+// so a burst of host noise costs one round of several entry points rather
+// than every pass of one. *reference_ns gets the best reference pass
+static std::vector<Result> measure_all(const std::vector<Entry>& entries, const Fixture& fixture,
+                                       std::vector<int>& out, double* reference_ns) {
+    const Result none = {1e30, -1, -1, -1, -1};
+    std::vector<Result> best(entries.size(), none);
+    double n = (double)fixture.raw.size();
+    *reference_ns = 1e30;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        for (size_t e = 0; e < entries.size(); e++) {
+            double t0 = bench_now_ns();
+            reference_pass(fixture, &out[0]);
+            *reference_ns = std::min(*reference_ns, (bench_now_ns() - t0) / n);
+            Result pass = measure(entries[e], fixture, out);
+            if (pass.ns < best[e].ns) best[e] = pass;
+        }
+    }
+    for (size_t e = 0; e < entries.size(); e++) {
+        double* values[] = {&best[e].ns, &best[e].cycles, &best[e].instructions, &best[e].cache_misses,
+                            &best[e].branch_misses};
+        for (size_t v = 0; v < sizeof(values) / sizeof(values[0]); v++) {
+            if (*values[v] >= 0) *values[v] /= n;
+        }
+    }
+    return best;
+}
+
+static void print_count(double value, const char* format) {
+    if (value >= 0) std::printf(format, value);
+    else std::printf("%10s", "n/a");
+}
+
+// Share of each class among the distinct fixtures
+static void print_distribution(const std::vector<int>& out, size_t fixtures) {
+    int counts[NUM_CLASSES] = {0};
+    for (size_t i = 0; i < fixtures; i++) {
+        if (out[i] >= 0 && out[i] < NUM_CLASSES) counts[out[i]]++;
+    }
+    for (int c = 0; c < NUM_CLASSES; c++) {
+        std::printf(" %5.1f", 100.0 * counts[c] / fixtures);
+    }
+}
+
+static std::string cpu_model() {
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.compare(0, 10, "model name") == 0) {
+            size_t colon = line.find(':');
+            if (colon != std::string::npos) return line.substr(line.find_first_not_of(' ', colon + 1));
+        }
+    }
+    return "unknown";
+}
+
+// Ratio to the reference by entry name; *cpu receives the recording CPU
+static std::map<std::string, double> load_baseline(std::string* cpu) {
+    std::map<std::string, double> baseline;
+    std::ifstream file(BASELINE_FILE);
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.compare(0, 6, "# cpu:") == 0) {
+            *cpu = line.substr(line.find_first_not_of(' ', 6));
+        } else if (!line.empty() && line[0] != '#') {
+            size_t space = line.find(' ');
+            if (space != std::string::npos) baseline[line.substr(0, space)] = std::atof(line.c_str() + space);
+        }
+    }
+    return baseline;
+}
+
+static bool save_baseline(const std::vector<Entry>& entries, const std::vector<Result>& results,
+                          const std::string& cpu, double reference_ns) {
+    std::FILE* file = std::fopen(BASELINE_FILE, "w");
+    if (!file) return false;
+    std::fprintf(file, "# bench_suite.cpp baseline: ns per sample over the reference loop's (best of %d)\n",
+                 BENCH_REPEATS);
+    std::fprintf(file, "# cpu: %s\n", cpu.c_str());
+    std::fprintf(file, "# compiler: %s, g++ -O2 -std=c++11\n", __VERSION__);
+    std::fprintf(file, "# reference loop: %.2f ns per sample when recorded\n", reference_ns);
+    for (size_t e = 0; e < entries.size(); e++) {
+        std::fprintf(file, "%s %.3f  # %.2f ns\n", entries[e].name.c_str(), results[e].ns / reference_ns,
+                     results[e].ns);
+    }
+    return std::fclose(file) == 0;
+}
+
+int main(int argc, char** argv) {
+    bool record = false;
+    double tolerance = 0.25;
+    size_t samples = 200000;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--record") == 0) {
+            record = true;
+        } else if (std::strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--samples") == 0 && i + 1 < argc) {
+            samples = (size_t)std::atol(argv[++i]);
+        } else {
+            std::fprintf(stderr, "usage: %s [--record] [--tolerance 0.25] [--samples N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    std::vector<BenchRow> dataset = bench_load_panel_dataset();
+    if (dataset.empty()) return 1;
+    bench_shuffle(dataset);
+    for (size_t v = 0; v < NUM_TEST_VECTORS; v++) {
+        BenchRow row;
+        std::memcpy(row.features, TEST_VECTORS[v], sizeof(row.features));
+        dataset.push_back(row);
+    }
+
+    Fixture fixture;
+    fixture.fixtures = dataset.size();
+    fixture.raw = bench_repeat(dataset, std::max(samples, dataset.size()));
+    fixture.scaled = fixture.raw;
+    for (size_t i = 0; i < fixture.raw.size(); i++) {
+        scale_features(fixture.raw[i].features, fixture.scaled[i].features);
+    }
+    fixture.columns = bench_columns(fixture.raw);
+
+    std::vector<Entry> entries;
+    Entry scale = {"scale_features", false, run_scale, 0};
+    entries.push_back(scale);
+    for (int t = 0; t < NUM_TREE_FUNCTIONS; t++) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "predict_tree_%d", t);
+        Entry tree = {name, true, run_tree, t};
+        entries.push_back(tree);
+    }
+    const Entry forest_entries[] = {
+        {"predict", true, run_predict, 0},
+#ifdef PREDICT_EARLY_EXIT
+        {"predict_early_exit", true, run_early_exit, 0},
+#endif
+        {"predict_batch", true, run_batch, 0},
+        {"is_fault", false, run_is_fault, 0},
+        {"eloquent_predict", true, run_eloquent_f64, 0},
+        {"eloquent_predict_float", true, run_eloquent_f32, 0},
+    };
+    entries.insert(entries.end(), forest_entries, forest_entries + sizeof(forest_entries) / sizeof(forest_entries[0]));
+
+    std::string cpu = cpu_model();
+    std::printf("CPU: %s\n", cpu.c_str());
+    std::printf("Samples: %zu per pass (%zu dataset rows + %zu test vectors, best of %d passes)\n\n",
+                fixture.raw.size(), fixture.fixtures - NUM_TEST_VECTORS, NUM_TEST_VECTORS, BENCH_REPEATS);
+    std::printf("%-24s %8s %10s %10s %10s %10s   class share %%", "entry point", "ns", "cycles", "instr",
+                "cache miss", "br miss");
+    for (int c = 0; c < NUM_CLASSES; c++) std::printf(" %5.5s", CLASS_NAMES[c]);
+    std::printf("\n");
+
+    std::vector<int> out(fixture.raw.size());
+    std::vector<int> reference(fixture.raw.size());
+    double reference_ns;
+    std::vector<Result> results = measure_all(entries, fixture, out, &reference_ns);
+    size_t disagreements = 0;
+    for (size_t e = 0; e < entries.size(); e++) {
+        const Result& r = results[e];
+        entries[e].run(fixture, entries[e].tree, &out[0]);
+        std::printf("%-24s %8.2f", entries[e].name.c_str(), r.ns);
+        print_count(r.cycles, " %10.1f");
+        print_count(r.instructions, " %10.1f");
+        print_count(r.cache_misses, " %10.4f");
+        print_count(r.branch_misses, " %10.3f");
+        if (entries[e].classifies) {
+            std::printf("   %13s", "");
+            print_distribution(out, fixture.fixtures);
+        }
+        std::printf("\n");
+
+        // The model_manual.h forest entry points must agree with predict()
+        const std::string& name = entries[e].name;
+        if (name == "predict") reference = out;
+        size_t mismatches = 0;
+        if (name == "predict_early_exit" || name == "predict_batch") {
+            for (size_t i = 0; i < out.size(); i++) mismatches += out[i] != reference[i];
+        } else if (name == "is_fault") {
+            for (size_t i = 0; i < out.size(); i++) mismatches += out[i] != (reference[i] != NORMAL_CLASS);
+        }
+        if (mismatches) std::printf("  %s: %zu disagreements with predict()\n", name.c_str(), mismatches);
+        disagreements += mismatches;
+    }
+
+    std::printf("\nTest vectors (predict):");
+    for (size_t v = 0; v < NUM_TEST_VECTORS; v++) {
+        std::printf(" %s", CLASS_NAMES[reference[fixture.fixtures - NUM_TEST_VECTORS + v]]);
+    }
+    std::printf("\n");
+
+    std::printf("Reference loop: %.2f ns per sample (best of %zu passes)\n", reference_ns,
+                (size_t)BENCH_REPEATS * entries.size());
+
+    int regressions = 0;
+    if (record) {
+        if (!save_baseline(entries, results, cpu, reference_ns)) {
+            std::fprintf(stderr, "Cannot write %s\n", BASELINE_FILE);
+            return 1;
+        }
+        std::printf("Recorded %s\n", BASELINE_FILE);
+    } else {
+        std::string baseline_cpu;
+        std::map<std::string, double> baseline = load_baseline(&baseline_cpu);
+        if (baseline.empty()) {
+            std::printf("No baseline (%s), run with --record\n", BASELINE_FILE);
+        } else {
+            double margin = tolerance, slack = BASELINE_SLACK;
+            if (baseline_cpu != cpu) {
+                margin *= 2;
+                slack *= 2;
+                std::printf("Baseline recorded on \"%s\", margins doubled\n", baseline_cpu.c_str());
+            }
+            std::printf("Regression check against %s (ratio to reference, tolerance %.0f%% + %.2f):\n",
+                        BASELINE_FILE, margin * 100, slack);
+            for (size_t e = 0; e < entries.size(); e++) {
+                std::map<std::string, double>::const_iterator it = baseline.find(entries[e].name);
+                if (it == baseline.end()) continue;
+                double limit = it->second * (1 + margin) + slack;
+                double ratio = results[e].ns / reference_ns;
+                if (ratio > limit) {
+                    std::printf("  %-24s %8.3f > %.3f (baseline %.3f)  REGRESSION\n",
+                                entries[e].name.c_str(), ratio, limit, it->second);
+                    regressions++;
+                }
+            }
+            if (regressions == 0) std::printf("  all %zu entry points within limits\n", entries.size());
+        }
+    }
+
+    return (disagreements != 0 || regressions != 0) ? 1 : 0;
+}
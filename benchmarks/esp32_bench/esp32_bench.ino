@@ -0,0 +1,140 @@
+/*
+ * =============================================================================
+ * ESP32 Inference Benchmark - Solar Panel Fault Detection
+ * =============================================================================
+ *
+ * Times each generated model backend on the board and checks that all of
+ * them agree with predict() from model_manual.h. Results are printed on
+ * the serial monitor at 115200 baud.
+ *
+ * Setup:
+ * - Copy these headers from models/ into this sketch folder:
+ *   model_manual.h, model_table.h, forest_runtime.h,
+ *   model_quickscorer.h, forest_quickscorer.h, model_lut.h, forest_lut.h,
+ *   model_compact.h, forest_compact.h, model.h, model_float.h
+ * - Build with the default ESP32 board settings (240 MHz)
+ * - To time predict_early_exit() too, uncomment PREDICT_EARLY_EXIT below
+ *
+ * =============================================================================
+ */
+
+// #define PREDICT_EARLY_EXIT
+#include "model_manual.h"
+#include "model_table.h"
+#include "model_quickscorer.h"
+#include "model_lut.h"
+#include "model_compact.h"
+
+// model.h (double thresholds) and model_float.h (float32 thresholds) both
+// declare Eloquent::ML::Port::RandomForest
+#include <cstdarg>
+namespace eloquent_f64 {
+#include "model.h"
+}
+namespace eloquent_f32 {
+#include "model_float.h"
+}
+
+#define SERIAL_BAUD_RATE    115200
+#define BENCH_ITERATIONS    2000
+
+// Same inputs as verify_export() in ml/step3_export_to_esp32.py,
+// plus a few rows from data/solar_panel_dataset.csv
+const float TEST_VECTORS[][NUM_FEATURES] = {
+    {20.0, 5.0, 35.0, 1000.0, 18.0},      // Normal
+    {12.0, 2.5, 45.0, 300.0, 8.0},        // Partial Shading
+    {16.5, 4.0, 45.0, 550.0, 13.0},       // Dust Accumulation
+    {22.0, 0.05, 30.0, 900.0, 1.0},       // Open Circuit
+    {1.5, 8.0, 70.0, 800.0, 1.5},         // Short Circuit
+    {17.72, 5.12, 37.77, 487.73, 11.74},
+    {23.8, 0.31, 28.77, 905.76, 1.84},
+};
+const int NUM_TEST_VECTORS = sizeof(TEST_VECTORS) / sizeof(TEST_VECTORS[0]);
+
+int runManual(const float* x) { return predict(const_cast<float*>(x)); }
+#ifdef PREDICT_EARLY_EXIT
+int runEarlyExit(const float* x) { return predict_early_exit(const_cast<float*>(x)); }
+#endif
+int runTable(const float* x) { return forest_predict(&SOLAR_FOREST, x); }
+int runQuickScorer(const float* x) { return quickscorer_predict(&SOLAR_QUICKSCORER, x); }
+#if LUT_AVAILABLE
+int runLut(const float* x) { return lut_predict(x); }
+#endif
+int runCompact(const float* x) { return compact_forest_predict(&SOLAR_COMPACT_FOREST, x); }
+
+eloquent_f64::Eloquent::ML::Port::RandomForest eloquentDouble;
+eloquent_f32::Eloquent::ML::Port::RandomForest eloquentFloat;
+
+// The Eloquent models take scaled features
+int runEloquentDouble(const float* x) {
+    float scaled[NUM_FEATURES];
+    scale_features(const_cast<float*>(x), scaled);
+    return eloquentDouble.predict(scaled);
+}
+int runEloquentFloat(const float* x) {
+    float scaled[NUM_FEATURES];
+    scale_features(const_cast<float*>(x), scaled);
+    return eloquentFloat.predict(scaled);
+}
+
+/**
+ * Time one backend over all test vectors and compare with predict()
+ */
+void benchmarkBackend(const char* name, int (*run)(const float*)) {
+    volatile int sink = 0;
+    int mismatches = 0;
+
+    for (int v = 0; v < NUM_TEST_VECTORS; v++) {
+        if (run(TEST_VECTORS[v]) != runManual(TEST_VECTORS[v])) {
+            mismatches++;
+        }
+    }
+
+    uint32_t start = ESP.getCycleCount();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        sink += run(TEST_VECTORS[i % NUM_TEST_VECTORS]);
+    }
+    uint32_t cycles = ESP.getCycleCount() - start;
+
+    float cyclesPerPredict = (float)cycles / BENCH_ITERATIONS;
+    Serial.print("   ");
+    Serial.print(name);
+    Serial.print(": ");
+    Serial.print(cyclesPerPredict, 0);
+    Serial.print(" cycles (");
+    Serial.print(cyclesPerPredict / getCpuFrequencyMhz(), 2);
+    Serial.print(" us), mismatches: ");
+    Serial.println(mismatches);
+}
+
+void setup() {
+    Serial.begin(SERIAL_BAUD_RATE);
+    delay(1000);
+
+    Serial.println();
+    Serial.println("📊 Inference benchmark (cycles per predict)");
+    Serial.print("   CPU: ");
+    Serial.print(getCpuFrequencyMhz());
+    Serial.println(" MHz");
+
+    benchmarkBackend("if-else (predict)", runManual);
+#ifdef PREDICT_EARLY_EXIT
+    benchmarkBackend("if-else early exit", runEarlyExit);
+#endif
+    benchmarkBackend("flat table", runTable);
+    benchmarkBackend("quickscorer", runQuickScorer);
+#if LUT_AVAILABLE
+    benchmarkBackend("dense lut", runLut);
+#else
+    Serial.println("   dense lut: unavailable (model_lut.h: table too large)");
+#endif
+    benchmarkBackend("compact nodes", runCompact);
+    benchmarkBackend("eloquent model.h (double)", runEloquentDouble);
+    benchmarkBackend("eloquent model_float.h", runEloquentFloat);
+
+    Serial.println("✅ Benchmark complete");
+}
+
+void loop() {
+    delay(1000);
+}
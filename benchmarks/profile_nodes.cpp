@@ -0,0 +1,67 @@
+/*
+ * Solar Panel Fault Detection - Node Profile Recorder
+ *
+ * Replays every row of both datasets through the flat node table
+ * (model_table.h) with forest_profile_predict() and writes how often each
+ * node was reached to profile/node_visits.txt. The exporter reads that
+ * file (CONFIG['node_profile']) to put the hot side of every split first
+ * in model_manual.h. The fingerprint ties the counts to the node table
+ * they were recorded on; the exporter ignores a profile of another model.
+ *
+ * Build and run (from benchmarks/):
+ *   g++ -O2 -std=c++11 -I../models profile_nodes.cpp -o profile_nodes
+ *   ./profile_nodes
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "model_table.h"
+#include "forest_blob.h"
+#include "bench_common.h"
+
+#define PROFILE_FILE "profile/node_visits.txt"
+
+int main() {
+    std::vector<BenchRow> rows = bench_load_panel_dataset();
+    std::vector<BenchRow> telemetry = bench_load_telemetry();
+    rows.insert(rows.end(), telemetry.begin(), telemetry.end());
+    if (rows.empty()) return 1;
+
+    const size_t num_nodes = sizeof(FOREST_NODES) / sizeof(FOREST_NODES[0]);
+    std::vector<uint32_t> visits(num_nodes, 0);
+    for (size_t i = 0; i < rows.size(); i++) {
+        forest_profile_predict(&SOLAR_FOREST, rows[i].features, &visits[0]);
+    }
+
+    // Field by field, so the bytes do not depend on struct padding
+    std::vector<uint8_t> bytes;
+    for (size_t i = 0; i < num_nodes; i++) {
+        uint8_t record[8];
+        std::memcpy(record, &FOREST_NODES[i].threshold, 4);
+        record[4] = (uint8_t)(FOREST_NODES[i].right & 0xFF);
+        record[5] = (uint8_t)(FOREST_NODES[i].right >> 8);
+        record[6] = FOREST_NODES[i].feature;
+        record[7] = FOREST_NODES[i].value;
+        bytes.insert(bytes.end(), record, record + 8);
+    }
+
+    FILE* out = std::fopen(PROFILE_FILE, "w");
+    if (!out) {
+        std::fprintf(stderr, "Cannot write %s\n", PROFILE_FILE);
+        return 1;
+    }
+    std::fprintf(out, "# Node visits recorded by benchmarks/profile_nodes.cpp\n");
+    std::fprintf(out, "# rows: %zu\n", rows.size());
+    std::fprintf(out, "# nodes: %zu\n", num_nodes);
+    std::fprintf(out, "# fingerprint: %08x\n", forest_crc32(&bytes[0], bytes.size()));
+    for (size_t i = 0; i < num_nodes; i++) {
+        std::fprintf(out, "%u\n", visits[i]);
+    }
+    std::fclose(out);
+
+    std::printf("%zu rows x %d trees replayed, %zu node counts written to %s\n",
+                rows.size(), SOLAR_FOREST.num_trees, num_nodes, PROFILE_FILE);
+    return 0;
+}
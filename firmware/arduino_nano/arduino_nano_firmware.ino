@@ -3,8 +3,11 @@
  * 
  * This firmware allows the Arduino Nano to:
  * 1. Read sensor data from analog pins
- * 2. Send data via USB serial to the computer
- * 3. The ML prediction is done on the computer (Python backend)
+ * 2. Classify each reading on the Nano itself (model_nano.h, integer only)
+ * 3. Send data and the fault class via USB serial to the computer
+ * 
+ * Setup: copy models/model_nano.h and models/forest_nano.h into this
+ * sketch folder (regenerate them with ml/step3_export_to_esp32.py).
  * 
  * Hardware Connections:
  * - Voltage Sensor: A0 (with voltage divider for 0-30V range)
@@ -15,10 +18,12 @@
  * 
  * Serial Protocol:
  * - Baud Rate: 115200
- * - Output Format: JSON {"v":voltage,"i":current,"t":temp,"l":light}
+ * - Output Format: JSON {"v":voltage,"i":current,"t":temp,"l":light,"e":efficiency,"fault":name}
  * - Commands: "START", "STOP", "STATUS", "CALIB"
  */
 
+#include "model_nano.h"
+
 // Pin Definitions
 #define VOLTAGE_PIN A0
 #define CURRENT_PIN A1
@@ -46,13 +51,21 @@ const float LDR_MAX_LUX = 1500.0;
 const int NUM_SAMPLES = 20;
 const unsigned long SAMPLE_INTERVAL = 500;  // ms
 
+// The model works on readings in 1/NANO_ADC_SCALE ADC counts; these
+// constants are folded at compile time, so no float math runs per sample
+const uint16_t ACS712_ZERO_READING = ACS712_ZERO / VREF * ADC_MAX * NANO_ADC_SCALE + 0.5;
+const uint16_t VOLTAGE_MAX_READING = 30.0 / (VREF / ADC_MAX * VOLTAGE_DIVIDER_RATIO) * NANO_ADC_SCALE;
+const uint16_t CURRENT_MAX_READING = 12.0 * ACS712_SENSITIVITY / VREF * ADC_MAX * NANO_ADC_SCALE;
+const uint16_t TEMP_MAX_READING = 100.0 * LM35_SCALE / VREF * ADC_MAX * NANO_ADC_SCALE;
+
 // State
 bool isMonitoring = false;
 unsigned long lastSampleTime = 0;
-float voltage = 0, current = 0, temperature = 0, light = 0;
+uint16_t readings[NANO_NUM_FEATURES] = {0};  // Voltage, current, temperature, light, efficiency
+uint8_t faultClass = 0;
 
-// Smoothing (exponential moving average)
-const float ALPHA = 0.3;  // Smoothing factor (0-1, higher = less smooth)
+// Smoothing (exponential moving average, ALPHA in 1/256 steps)
+const uint16_t ALPHA = 77;  // Smoothing factor (0.3, higher = less smooth)
 
 void setup() {
     Serial.begin(115200);
@@ -71,7 +84,7 @@ void setup() {
         delay(100);
     }
     
-    Serial.println("{\"status\":\"ready\",\"device\":\"Arduino Nano\",\"version\":\"1.0\"}");
+    Serial.println("{\"status\":\"ready\",\"device\":\"Arduino Nano\",\"version\":\"1.1\"}");
 }
 
 void loop() {
@@ -118,6 +131,20 @@ void loop() {
     }
 }
 
+// Average of NUM_SAMPLES ADC counts, in 1/NANO_ADC_SCALE counts
+uint16_t averageReading(long sum) {
+    return (uint16_t)((sum * NANO_ADC_SCALE + NUM_SAMPLES / 2) / NUM_SAMPLES);
+}
+
+uint16_t smooth(uint16_t previous, uint16_t reading) {
+    return (uint16_t)(((uint32_t)ALPHA * reading + (uint32_t)(256 - ALPHA) * previous + 128) >> 8);
+}
+
+// Physical value of a reading (volts, amps, degC, lux), for the serial output only
+float physical(uint8_t feature) {
+    return readings[feature] * pgm_read_float(&NANO_FEATURE_LSB[feature]);
+}
+
 void readSensors() {
     // Take multiple samples and average
     long vSum = 0, iSum = 0, tSum = 0, lSum = 0;
@@ -130,38 +157,51 @@ void readSensors() {
         delayMicroseconds(100);
     }
     
-    // Calculate raw values
-    float vRaw = (vSum / (float)NUM_SAMPLES) * (VREF / ADC_MAX) * VOLTAGE_DIVIDER_RATIO;
-    float iRaw = ((iSum / (float)NUM_SAMPLES) * (VREF / ADC_MAX) - ACS712_ZERO) / ACS712_SENSITIVITY;
-    float tRaw = (tSum / (float)NUM_SAMPLES) * (VREF / ADC_MAX) / LM35_SCALE;
-    float lRaw = (lSum / (float)NUM_SAMPLES) / ADC_MAX * LDR_MAX_LUX;
+    // ACS712 reads either side of its zero point; the model wants the magnitude
+    uint16_t iAvg = averageReading(iSum);
+    uint16_t iRaw = iAvg > ACS712_ZERO_READING ? iAvg - ACS712_ZERO_READING : ACS712_ZERO_READING - iAvg;
     
     // Apply exponential smoothing
-    voltage = ALPHA * vRaw + (1 - ALPHA) * voltage;
-    current = ALPHA * abs(iRaw) + (1 - ALPHA) * current;  // abs() because ACS712 can read negative
-    temperature = ALPHA * tRaw + (1 - ALPHA) * temperature;
-    light = ALPHA * lRaw + (1 - ALPHA) * light;
+    readings[0] = smooth(readings[0], averageReading(vSum));
+    readings[1] = smooth(readings[1], iRaw);
+    readings[2] = smooth(readings[2], averageReading(tSum));
+    readings[3] = smooth(readings[3], averageReading(lSum));  // Full scale is LDR_MAX_LUX
+    
+    // Clamp to valid ranges (LM35 and LDR cannot read below zero here)
+    readings[0] = min(readings[0], VOLTAGE_MAX_READING);
+    readings[1] = min(readings[1], CURRENT_MAX_READING);
+    readings[2] = min(readings[2], TEMP_MAX_READING);
+    
+    // Efficiency is derived from the voltage, current and light readings
+#ifdef NANO_EFFICIENCY_FEATURE
+    readings[NANO_EFFICIENCY_FEATURE] = nano_efficiency_reading(readings);
+#endif
     
-    // Clamp to valid ranges
-    voltage = constrain(voltage, 0, 30);
-    current = constrain(current, 0, 12);
-    temperature = constrain(temperature, -10, 100);
-    light = constrain(light, 0, 1500);
+    // Classify on the device (integer-only forest in PROGMEM)
+    faultClass = nano_forest_predict(&SOLAR_NANO_FOREST, readings);
 }
 
 void sendData() {
     // Send JSON formatted data
     Serial.print("{");
     Serial.print("\"v\":");
-    Serial.print(voltage, 2);
+    Serial.print(physical(0), 2);
     Serial.print(",\"i\":");
-    Serial.print(current, 2);
+    Serial.print(physical(1), 2);
     Serial.print(",\"t\":");
-    Serial.print(temperature, 1);
+    Serial.print(physical(2), 1);
     Serial.print(",\"l\":");
-    Serial.print(light, 0);
+    Serial.print(physical(3), 0);
     Serial.print(",\"p\":");
-    Serial.print(voltage * current, 2);
+    Serial.print(physical(0) * physical(1), 2);
+#ifdef NANO_EFFICIENCY_FEATURE
+    Serial.print(",\"e\":");
+    Serial.print(physical(NANO_EFFICIENCY_FEATURE), 2);
+#endif
+    Serial.print(",\"fault\":\"");
+    Serial.print((const __FlashStringHelper*)pgm_read_word(&NANO_CLASS_NAMES[faultClass]));
+    Serial.print("\",\"c\":");
+    Serial.print(faultClass);
     Serial.print(",\"ts\":");
     Serial.print(millis());
     Serial.println("}");
@@ -31,6 +31,7 @@
 
 // Include the ML model
 #include "model_manual.h"
+#include "panel_efficiency.h"
 
 // =============================================================================
 // CONFIGURATION
@@ -66,11 +67,13 @@ float temperature = 0.0;
 float lightIntensity = 0.0;
 
 // Current prediction
-int currentFaultClass = 0;
+int currentFaultClass = NORMAL_CLASS;
 String currentFaultName = "Normal";
+PredictionResult currentResult = {};
 
 // Simulation variables
-int simulationMode = 0;  // 0=Normal, 1=Partial_Shading, 2=Open_Circuit, 3=Short_Circuit
+int simulationMode = 0;  // 0=Normal, 1=Open_Circuit, 2=Partial_Shading, 3=Short_Circuit
+const char* SIM_MODE_NAMES[] = {"Normal", "Open_Circuit", "Partial_Shading", "Short_Circuit"};
 unsigned long lastSimChange = 0;
 bool autoSimulation = false;
 
@@ -149,7 +152,7 @@ void loop() {
         lastSimChange = currentTime;
         simulationMode = (simulationMode + 1) % 4;
         Serial.print("Auto-sim: Switching to mode ");
-        Serial.println(CLASS_NAMES[simulationMode]);
+        Serial.println(SIM_MODE_NAMES[simulationMode]);
     }
     
     delay(10);
@@ -257,11 +260,13 @@ void runPrediction() {
         voltage,
         current,
         temperature,
-        lightIntensity
+        lightIntensity,
+        panel_efficiency(voltage, current, lightIntensity)
     };
     
-    // Get prediction from model
-    currentFaultClass = predict(features);
+    // Get prediction from model (one pass: class, votes and fault flag)
+    currentResult = predict_result(features);
+    currentFaultClass = currentResult.class_idx;
     currentFaultName = String(CLASS_NAMES[currentFaultClass]);
 }
 
@@ -270,24 +275,23 @@ void runPrediction() {
 // =============================================================================
 void updateOutputs() {
     // Check if fault detected
-    bool isFault = (currentFaultClass != 0);  // 0 = Normal
+    bool isFault = currentResult.is_fault;
     
     if (isFault) {
         // Fault detected
         digitalWrite(FAULT_LED_PIN, HIGH);
         digitalWrite(NORMAL_LED_PIN, LOW);
         
-        // Different buzzer patterns for different faults
-        switch (currentFaultClass) {
-            case 3:  // Short_Circuit - Critical
-                digitalWrite(BUZZER_PIN, HIGH);
-                break;
-            case 1:  // Open_Circuit
-                digitalWrite(BUZZER_PIN, (millis() / 200) % 2);
-                break;
-            case 2:  // Partial_Shading
-                digitalWrite(BUZZER_PIN, (millis() / 500) % 2);
-                break;
+        // Different buzzer patterns for different faults (class indices
+        // follow the model's label encoder, so match on the name)
+        if (currentFaultName == "Short_Circuit") {         // Critical
+            digitalWrite(BUZZER_PIN, HIGH);
+        } else if (currentFaultName == "Open_Circuit") {
+            digitalWrite(BUZZER_PIN, (millis() / 200) % 2);
+        } else if (currentFaultName == "Partial_Shading") {
+            digitalWrite(BUZZER_PIN, (millis() / 500) % 2);
+        } else {                                            // Dust_Accumulation
+            digitalWrite(BUZZER_PIN, (millis() / 1000) % 2);
         }
     } else {
         // Normal operation
@@ -317,7 +321,7 @@ void handleSerialCommands() {
             if (mode >= 0 && mode <= 3) {
                 simulationMode = mode;
                 Serial.print("OK:SIM_MODE=");
-                Serial.println(CLASS_NAMES[mode]);
+                Serial.println(SIM_MODE_NAMES[mode]);
             }
         }
         else if (command.startsWith("AUTO:")) {
@@ -366,7 +370,10 @@ void sendPrediction() {
     Serial.print("PRED:");
     Serial.print(currentFaultClass);
     Serial.print(",");
-    Serial.println(currentFaultName);
+    Serial.print(currentFaultName);
+    Serial.print(",");
+    // Confidence: share of trees voting for the predicted class
+    Serial.println(100.0f * currentResult.votes[currentFaultClass] / NUM_TREES, 1);
 }
 
 // =============================================================================
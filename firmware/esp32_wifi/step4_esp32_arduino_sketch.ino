@@ -26,6 +26,7 @@
 
 // Include the ML model (generated from Python)
 #include "model_manual.h"
+#include "panel_efficiency.h"
 
 // =============================================================================
 // PIN DEFINITIONS
@@ -54,7 +55,7 @@
 // GLOBAL VARIABLES
 // =============================================================================
 unsigned long lastReadTime = 0;
-int currentFaultStatus = 0;  // 0 = Normal
+int currentFaultStatus = NORMAL_CLASS;
 int consecutiveFaults = 0;   // Count consecutive fault readings
 const int FAULT_THRESHOLD = 3;  // Require 3 consecutive faults before alert
 
@@ -74,7 +75,7 @@ float readCurrent();
 float readTemperature();
 float readLightIntensity();
 void processFaultDetection();
-void handleFaultStatus(int faultType);
+void handleFaultStatus(const PredictionResult& result);
 void printSensorData();
 void blinkLED(int pin, int times, int delayMs);
 
@@ -293,29 +294,33 @@ float readLightIntensity() {
  * Process sensor data through the Random Forest model
  */
 void processFaultDetection() {
-    // Prepare feature array [Voltage, Current, Temperature, Light_Intensity]
+    // Prepare feature array [Voltage, Current, Temperature, Light_Intensity, Efficiency]
     float features[NUM_FEATURES] = {
         voltage,
         current,
         temperature,
-        lightIntensity
+        lightIntensity,
+        panel_efficiency(voltage, current, lightIntensity)
     };
     
-    // Get prediction from ML model
-    int prediction = predict(features);
-    currentFaultStatus = prediction;
+    // Get prediction from ML model (one pass: class, votes and fault flag)
+    PredictionResult result = predict_result(features);
+    currentFaultStatus = result.class_idx;
     
     // Handle fault status
-    handleFaultStatus(prediction);
+    handleFaultStatus(result);
 }
 
 /**
  * Handle the detected fault status
- * @param faultType: 0=Normal, 1=Open_Circuit, 2=Partial_Shading, 3=Short_Circuit
+ * @param result: prediction for the current reading
+ *        class_idx indexes CLASS_NAMES (the model's label encoder order)
  */
-void handleFaultStatus(int faultType) {
+void handleFaultStatus(const PredictionResult& result) {
+    int faultType = result.class_idx;
+    
     // Check if it's a fault (anything other than Normal)
-    if (is_fault((float[]){voltage, current, temperature, lightIntensity})) {
+    if (result.is_fault) {
         consecutiveFaults++;
         
         // Only trigger alert after consecutive faults (debouncing)
@@ -325,34 +330,31 @@ void handleFaultStatus(int faultType) {
             digitalWrite(NORMAL_LED_PIN, LOW);
             
             // Sound buzzer based on fault severity
-            switch (faultType) {
-                case 3: // Short_Circuit - most critical
-                    // Continuous buzzer
-                    digitalWrite(BUZZER_PIN, HIGH);
-                    break;
-                    
-                case 1: // Open_Circuit - critical
-                    // Intermittent beep
-                    digitalWrite(BUZZER_PIN, HIGH);
-                    delay(100);
-                    digitalWrite(BUZZER_PIN, LOW);
-                    break;
-                    
-                case 2: // Partial_Shading - warning
-                    // Short beep
-                    digitalWrite(BUZZER_PIN, HIGH);
-                    delay(50);
-                    digitalWrite(BUZZER_PIN, LOW);
-                    break;
-                    
-                default:
-                    break;
+            const char* faultName = CLASS_NAMES[faultType];
+            if (strcmp(faultName, "Short_Circuit") == 0) {
+                // Most critical: continuous buzzer
+                digitalWrite(BUZZER_PIN, HIGH);
+            } else if (strcmp(faultName, "Open_Circuit") == 0) {
+                // Critical: intermittent beep
+                digitalWrite(BUZZER_PIN, HIGH);
+                delay(100);
+                digitalWrite(BUZZER_PIN, LOW);
+            } else if (strcmp(faultName, "Partial_Shading") == 0) {
+                // Warning: short beep
+                digitalWrite(BUZZER_PIN, HIGH);
+                delay(50);
+                digitalWrite(BUZZER_PIN, LOW);
             }
             
             // Print fault alert
             Serial.println("🚨 ═══════════════════════════════════════════════════");
             Serial.print("🚨 FAULT DETECTED: ");
-            Serial.println(CLASS_NAMES[faultType]);
+            Serial.print(CLASS_NAMES[faultType]);
+            Serial.print(" (");
+            Serial.print(result.votes[faultType]);
+            Serial.print("/");
+            Serial.print(NUM_TREES);
+            Serial.println(" trees)");
             Serial.println("🚨 ═══════════════════════════════════════════════════");
         }
     } else {
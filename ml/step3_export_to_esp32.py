@@ -11,13 +11,32 @@ IMPORTANT: Install micromlgen before running:
     pip install micromlgen
 
 If micromlgen doesn't work, this script also includes a manual export method.
+
+A plain run writes the headers the firmware, backend and benchmarks build
+against (model.h, model_float.h, model_manual.h, model_table.h,
+model_nano.h, solar_forest.bin, the golden files). The other backends and
+the autotuned model_best.h are written only when asked for:
+    python step3_export_to_esp32.py --all
+    python step3_export_to_esp32.py --help
+Exporting the same model twice writes the same files, except the
+host-specific model_best.h and autotune_report.txt.
 =============================================================================
 """
 
 import numpy as np
 import joblib
 import os
-from datetime import datetime
+import argparse
+import bisect
+import csv
+import hashlib
+import itertools
+import platform
+import random
+import struct
+import subprocess
+import tempfile
+import zlib
 
 # Try to import micromlgen
 try:
@@ -41,10 +60,197 @@ CONFIG = {
     'model_path': os.path.join(MODELS_DIR, 'solar_fault_rf_model.joblib'),
     'scaler_path': os.path.join(MODELS_DIR, 'solar_fault_scaler.joblib'),
     'label_encoder_path': os.path.join(MODELS_DIR, 'solar_fault_label_encoder.joblib'),
+    'feature_names_path': os.path.join(MODELS_DIR, 'solar_fault_feature_names.joblib'),
     'output_header': os.path.join(MODELS_DIR, 'model.h'),
-    'output_header_manual': os.path.join(MODELS_DIR, 'model_manual.h')
+    'output_header_manual': os.path.join(MODELS_DIR, 'model_manual.h'),
+    'output_header_table': os.path.join(MODELS_DIR, 'model_table.h'),
+    'output_header_quickscorer': os.path.join(MODELS_DIR, 'model_quickscorer.h'),
+    'output_header_float': os.path.join(MODELS_DIR, 'model_float.h'),
+    'output_header_constexpr': os.path.join(MODELS_DIR, 'model_constexpr.h'),
+    'output_header_lut': os.path.join(MODELS_DIR, 'model_lut.h'),
+    'output_header_soft': os.path.join(MODELS_DIR, 'model_soft.h'),
+    'output_header_compact': os.path.join(MODELS_DIR, 'model_compact.h'),
+    'output_header_nano': os.path.join(MODELS_DIR, 'model_nano.h'),
+    'output_header_cascade': os.path.join(MODELS_DIR, 'model_cascade.h'),
+    # Versioned binary model for forest_blob.h (loaded at runtime, no rebuild)
+    'output_blob': os.path.join(MODELS_DIR, 'solar_forest.bin'),
+    # Stored in the blob header; bump it for every retrained model
+    'blob_model_version': 1,
+    # model.predict() class per row of each dataset (same order as 'datasets'),
+    # read by benchmarks/bench_vote_parity.cpp; solar_data_expected.txt also by
+    # bench_eloquent.cpp
+    'golden_predictions': [
+        os.path.join(BASE_DIR, 'benchmarks', 'golden', 'solar_panel_dataset_expected.txt'),
+        os.path.join(BASE_DIR, 'benchmarks', 'golden', 'solar_data_expected.txt'),
+    ],
+    # model.predict_proba() per row of each dataset (same order), read by
+    # benchmarks/bench_soft.cpp
+    'golden_probabilities': [
+        os.path.join(BASE_DIR, 'benchmarks', 'golden', 'solar_panel_dataset_proba.txt'),
+        os.path.join(BASE_DIR, 'benchmarks', 'golden', 'solar_data_proba.txt'),
+    ],
+    # Scaler the golden classes were computed with, checked against model_manual.h
+    'golden_scaler': os.path.join(BASE_DIR, 'benchmarks', 'golden', 'scaler.txt'),
+    # Rows where the trees' hard majority vote (what the headers compute)
+    # differs from model.predict(), which averages the leaf distributions
+    'golden_vote_gaps': os.path.join(BASE_DIR, 'benchmarks', 'golden', 'hard_vote_gaps.txt'),
+    # Rows where float32 readings scaled as on the device reach another leaf
+    # than predict_proba() in some tree (their probabilities differ)
+    'golden_leaf_gaps': os.path.join(BASE_DIR, 'benchmarks', 'golden', 'leaf_gaps.txt'),
+    # Node visit counts from benchmarks/profile_nodes.cpp; replayed in Python
+    # when missing or recorded on another model, None keeps sklearn's order
+    'node_profile': os.path.join(BASE_DIR, 'benchmarks', 'profile', 'node_visits.txt'),
+    # Hot side share above which a split also gets a FOREST_LIKELY() hint
+    'pgo_likely_share': 0.9,
+    # Map split thresholds back to raw sensor units so inference skips the scaler
+    'fold_scaler': True,
+    # Tree order for predict_early_exit(), built only with -DPREDICT_EARLY_EXIT:
+    # 'decisive' (learned from the datasets), 'index' (0..N-1) or an explicit
+    # list of tree indices
+    'tree_order': 'decisive',
+    # Drop unreachable and redundant splits, merge duplicate trees (compact_forest)
+    'compact_trees': True,
+    # Largest dense class table for model_lut.h; for bigger forests the
+    # dense lut backend is unavailable (LUT_AVAILABLE 0, no lut_predict())
+    'lut_max_bytes': 8192,
+    # Leaf distribution precision for model_soft.h: 8 (uint8_t) or 16 (uint16_t)
+    'soft_vote_bits': 8,
+    # Copies of the usage guide (generate_esp32_usage_guide)
+    'output_guides': [
+        os.path.join(BASE_DIR, 'ESP32_USAGE_GUIDE.txt'),
+        os.path.join(BASE_DIR, 'firmware', 'esp32_wifi', 'ESP32_USAGE_GUIDE.txt'),
+    ],
+    # Compiler used to measure code size (e.g. xtensa-esp32-elf-g++ for
+    # device numbers); skipped when it is not installed
+    'size_compiler': 'g++',
+    # Backend autotuning (model_best.h): target to pick the fastest backend
+    # for, within the flash budget. 'host' compiles and times every backend
+    # here; other targets use their cycle table (cycles per operation,
+    # estimates - calibrate with benchmarks/esp32_bench) and measure flash
+    # with their compiler, or with the host compiler when it is missing
+    'autotune_target': 'host',
+    'flash_budget': 16384,
+    'output_header_best': os.path.join(MODELS_DIR, 'model_best.h'),
+    'autotune_report': os.path.join(MODELS_DIR, 'autotune_report.txt'),
+    'autotune_targets': {
+        'host': {'compiler': 'g++'},
+        # Xtensa LX6 with FPU at 240 MHz, code and tables through the flash cache
+        'esp32': {
+            'compiler': 'xtensa-esp32-elf-g++', 'mhz': 240,
+            'cycles': {'call': 40, 'class': 4, 'split': 8, 'node': 14, 'compact_node': 12,
+                       'tree': 4, 'qs_condition': 10, 'qs_tree': 12,
+                       'bin_compare': 6, 'lookup': 6},
+        },
+        # ATmega328P at 16 MHz, software float (about 60 cycles per compare)
+        'avr': {
+            'compiler': 'avr-g++', 'mhz': 16,
+            'cycles': {'call': 60, 'class': 8, 'split': 70, 'node': 90, 'compact_node': 16,
+                       'tree': 6, 'qs_condition': 80, 'qs_tree': 40,
+                       'bin_compare': 70, 'lookup': 8},
+        },
+    },
+    # Arduino Nano front end (firmware/arduino_nano): 10-bit ADC on a 5 V
+    # reference, readings kept as 1/scale ADC counts in uint16_t, and the
+    # physical units per volt at the pin of each sensor (voltage divider,
+    # ACS712 A/V, LM35 degC/V, LDR lux/V). Efficiency has no sensor: the
+    # Nano derives it from the other readings in 1/efficiency_steps percent
+    'nano_adc': {
+        'vref': 5.0,
+        'adc_max': 1023.0,
+        'scale': 64,
+        'units_per_volt': {
+            'Voltage': 11.0,
+            'Current': 1 / 0.185,
+            'Temperature': 1 / 0.01,
+            'Light_Intensity': 1500.0 / 5.0,
+        },
+        'efficiency_steps': 1024,
+    },
+    # Cascade first stage (model_cascade.h): a leaf answers without the
+    # forest only when at least this share of its dataset rows get the same
+    # class from the forest; candidate thresholds are this many quantiles
+    # per input
+    'cascade_min_precision': 0.999,
+    'cascade_bins': 32,
+    'datasets': [
+        os.path.join(BASE_DIR, 'data', 'solar_panel_dataset.csv'),
+        os.path.join(BASE_DIR, 'data', 'solar_data.csv'),
+    ]
+}
+
+# Sample readings used by verify_export() and the compile-time checks
+# (ml/step2_train_random_forest.py test cases)
+VERIFY_TEST_CASES = [
+    {'Voltage': 20.0, 'Current': 5.0, 'Temperature': 35.0, 'Light_Intensity': 1000.0,
+     'Efficiency': 18.0},   # Normal
+    {'Voltage': 12.0, 'Current': 2.5, 'Temperature': 45.0, 'Light_Intensity': 300.0,
+     'Efficiency': 8.0},    # Partial Shading
+    {'Voltage': 16.5, 'Current': 4.0, 'Temperature': 45.0, 'Light_Intensity': 550.0,
+     'Efficiency': 13.0},   # Dust Accumulation
+    {'Voltage': 22.0, 'Current': 0.05, 'Temperature': 30.0, 'Light_Intensity': 900.0,
+     'Efficiency': 1.0},    # Open Circuit
+    {'Voltage': 1.5, 'Current': 8.0, 'Temperature': 70.0, 'Light_Intensity': 800.0,
+     'Efficiency': 1.5},    # Short Circuit
+]
+
+# Column of each model feature in each dataset (same order as
+# CONFIG['datasets']); features without a column are computed by
+# DERIVED_FEATURES from the others
+DATASET_COLUMNS = [
+    {'Voltage': 'Voltage', 'Current': 'Current', 'Temperature': 'Temperature',
+     'Light_Intensity': 'Light_Intensity', 'Efficiency': 'Efficiency'},
+    {'Voltage': 'voltage_v', 'Current': 'current_a', 'Temperature': 'temperature_c',
+     'Light_Intensity': 'light_lux'},
+]
+
+# backend/main.py calculate_efficiency(): lux * 0.0079 W/m2 over a 1.6 m2
+# panel, in percent, clipped to what a silicon panel can reach
+EFFICIENCY_SCALE = 0.0079 * 1.6 / 100
+EFFICIENCY_MAX = 25.0
+
+
+def panel_efficiency(voltage, current, light):
+    """
+    Efficiency in percent from float32 readings, exactly as
+    panel_efficiency() in models/panel_efficiency.h computes it on the
+    device (calculate_efficiency() without the rounding).
+    """
+    solar_input = to_float32(light * to_float32(EFFICIENCY_SCALE))
+    if solar_input <= 0.0:
+        return 0.0
+    efficiency = to_float32(to_float32(voltage * current) / solar_input)
+    return min(max(efficiency, 0.0), EFFICIENCY_MAX)
+
+
+# Features a dataset or device may not measure, computed from the float32
+# readings of the others ({feature name: value})
+DERIVED_FEATURES = {
+    'Efficiency': lambda r: panel_efficiency(r['Voltage'], r['Current'], r['Light_Intensity']),
 }
 
+# Model inputs in column order, set by load_artifacts() from
+# CONFIG['feature_names_path'] and checked against the model and scaler
+FEATURE_NAMES = []
+
+
+class ExportCheckError(Exception):
+    """
+    An exported forest disagrees with the model it was exported from.
+    Raised before the failing export is written, so a failed run never
+    leaves a wrong header behind.
+    """
+
+
+def generated_line():
+    """
+    Header comment line naming the model the file was exported from. A
+    digest instead of a date, so exporting the same model twice writes the
+    same files.
+    """
+    with open(CONFIG['model_path'], 'rb') as f:
+        digest = hashlib.sha256(f.read()).hexdigest()
+    return f" * Generated from {os.path.basename(CONFIG['model_path'])} (sha256 {digest[:16]})"
+
 
 def load_artifacts():
     """Load all trained model artifacts."""
@@ -56,9 +262,24 @@ def load_artifacts():
     model = joblib.load(CONFIG['model_path'])
     scaler = joblib.load(CONFIG['scaler_path'])
     label_encoder = joblib.load(CONFIG['label_encoder_path'])
+    feature_names = [str(name) for name in joblib.load(CONFIG['feature_names_path'])]
+    
+    # Every exporter indexes features and classes by position, so the
+    # artifacts must describe the same model
+    n_classes = len(label_encoder.classes_)
+    if not (model.n_features_in_ == len(scaler.mean_) == len(feature_names)):
+        raise ValueError(f"Feature count mismatch: model {model.n_features_in_}, "
+                         f"scaler {len(scaler.mean_)}, feature names {len(feature_names)}")
+    if [int(c) for c in model.classes_] != list(range(n_classes)):
+        raise ValueError(f"Model classes {list(model.classes_)} are not the "
+                         f"{n_classes} label encoder indices")
+    for name in feature_names:
+        if name not in DERIVED_FEATURES and any(name not in columns for columns in DATASET_COLUMNS):
+            raise ValueError(f"No dataset column for feature {name} (DATASET_COLUMNS)")
+    FEATURE_NAMES[:] = feature_names
     
     print(f"✅ Model loaded: {model.n_estimators} trees, max_depth={model.max_depth}")
-    print(f"✅ Scaler loaded: {len(scaler.mean_)} features")
+    print(f"✅ Features: {FEATURE_NAMES}")
     print(f"✅ Labels: {list(label_encoder.classes_)}")
     
     return model, scaler, label_encoder
@@ -82,6 +303,12 @@ def export_with_micromlgen(model):
         # Port the model to C code
         c_code = port(model)
         
+        # micromlgen counts votes in uint8_t, which wraps past 255 trees
+        if len(model.estimators_) > 255:
+            c_code = c_code.replace('uint8_t votes[', 'uint16_t votes[')
+            c_code = c_code.replace('uint8_t maxVotes', 'uint16_t maxVotes')
+            print("   Vote counters widened to uint16_t (more than 255 trees)")
+        
         # Save to header file
         with open(CONFIG['output_header'], 'w') as f:
             f.write(c_code)
@@ -96,7 +323,8 @@ def export_with_micromlgen(model):
         return False
 
 
-def export_manual(model, scaler, label_encoder):
+def export_manual(model, scaler, label_encoder, trees, raw_thresholds=False, tree_order=None,
+                  weights=None, visits=None):
     """
     Manual export of Random Forest to C code.
     This is a backup method that creates a simplified but functional model.
@@ -105,17 +333,27 @@ def export_manual(model, scaler, label_encoder):
     1. Scaler parameters (mean, std)
     2. Decision tree structure for each tree
     3. Voting logic
+    
+    `trees` are flat trees (flatten_forest). With raw_thresholds they come
+    from fold_scaler() and predict() compares raw readings directly.
+    `tree_order` is the evaluation order of predict_early_exit(), and
+    `weights` the votes of each tree after compact_forest() merged
+    duplicates (default: one each). `visits` (load_node_profile) puts the
+    more visited child of every split first, so the hot path falls through.
     """
     
     print("\n" + "=" * 70)
     print("🔧 MANUAL EXPORT TO C CODE")
     print("=" * 70)
     
-    feature_names = ['Voltage', 'Current', 'Temperature', 'Light_Intensity']
+    feature_names = FEATURE_NAMES
     class_names = list(label_encoder.classes_)
     n_classes = len(class_names)
     n_features = len(feature_names)
-    n_trees = model.n_estimators
+    n_trees = len(trees)
+    if weights is None:
+        weights = [1] * n_trees
+    n_votes = sum(weights)
     
     # Start building C code
     c_code = []
@@ -123,8 +361,14 @@ def export_manual(model, scaler, label_encoder):
     # Header comment
     c_code.append("/*")
     c_code.append(" * Solar Panel Fault Detection - Random Forest Model")
-    c_code.append(f" * Generated: {datetime.now().strftime('%Y-%m-%d %H:%M:%S')}")
-    c_code.append(f" * Trees: {n_trees}, Max Depth: {model.max_depth}")
+    c_code.append(generated_line())
+    c_code.append(f" * Trees: {n_votes}, Max Depth: {model.max_depth}")
+    if n_votes != n_trees:
+        c_code.append(f" * Distinct trees: {n_trees} (duplicates vote with a weight)")
+    if raw_thresholds:
+        c_code.append(" * Thresholds: raw sensor units (StandardScaler folded in)")
+    if visits is not None:
+        c_code.append(" * Branch order: hot side first (node profile)")
     c_code.append(" * ")
     c_code.append(" * Classes:")
     for i, name in enumerate(class_names):
@@ -136,12 +380,36 @@ def export_manual(model, scaler, label_encoder):
     c_code.append("#ifndef SOLAR_FAULT_MODEL_H")
     c_code.append("#define SOLAR_FAULT_MODEL_H")
     c_code.append("")
+    c_code.append("#include <stddef.h>")
+    c_code.append("#include <stdint.h>")
+    c_code.append("")
     
     # Constants
     c_code.append(f"#define NUM_FEATURES {n_features}")
     c_code.append(f"#define NUM_CLASSES {n_classes}")
-    c_code.append(f"#define NUM_TREES {n_trees}")
+    c_code.append(f"#define NUM_TREES {n_votes}")
+    c_code.append("")
+    c_code.append("// 1: trees compare raw readings (scaler folded in), 0: scaled features")
+    c_code.append(f"#define RAW_THRESHOLDS {1 if raw_thresholds else 0}")
+    c_code.append("")
+    normal_idx = class_names.index('Normal')
+    c_code.append("// Class index of 'Normal' (every other class is a fault)")
+    c_code.append(f"#define NORMAL_CLASS {normal_idx}")
     c_code.append("")
+    if not raw_thresholds:
+        c_code.append("// Samples scaled and scored together by predict_batch()")
+        c_code.append("#ifndef PREDICT_BATCH_BLOCK")
+        c_code.append("#define PREDICT_BATCH_BLOCK 32")
+        c_code.append("#endif")
+        c_code.append("")
+    if visits is not None:
+        c_code.append("// Branch hint for splits where the profile shows one side is nearly always taken")
+        c_code.append("#if defined(__GNUC__)")
+        c_code.append("#define FOREST_LIKELY(x) __builtin_expect(!!(x), 1)")
+        c_code.append("#else")
+        c_code.append("#define FOREST_LIKELY(x) (x)")
+        c_code.append("#endif")
+        c_code.append("")
     
     # Class names as strings
     c_code.append("// Fault type names")
@@ -179,39 +447,58 @@ def export_manual(model, scaler, label_encoder):
     c_code.append("}")
     c_code.append("")
     
+    # The trees read features[f] of one sample through a Row: a feature
+    # row (const float*), or a sample of a column-major batch
+    c_code.append("// Trees read feature f of one sample as features[f], from a feature row")
+    c_code.append("// (const float*) or from one sample of a column-major batch:")
+    if raw_thresholds:
+        c_code.append("// sample i of column-major X (X[f * n + i]), read in place")
+        c_code.append("struct ColumnRow {")
+        c_code.append("    const float* sample;   // X + i")
+        c_code.append("    size_t n;")
+        c_code.append("    float operator[](int f) const { return sample[f * n]; }")
+        c_code.append("};")
+    else:
+        c_code.append("// one sample of the scaled block (column stride PREDICT_BATCH_BLOCK)")
+        c_code.append("struct BlockRow {")
+        c_code.append("    const float* sample;")
+        c_code.append("    float operator[](int f) const { return sample[f * PREDICT_BATCH_BLOCK]; }")
+        c_code.append("};")
+    c_code.append("")
+    
     # Generate each decision tree
-    for tree_idx, tree in enumerate(model.estimators_):
+    for tree_idx, nodes in enumerate(trees):
         c_code.append(f"// Decision Tree {tree_idx}")
-        c_code.append(f"int predict_tree_{tree_idx}(float* features) {{")
-        
-        # Get tree structure
-        tree_ = tree.tree_
-        feature = tree_.feature
-        threshold = tree_.threshold
-        children_left = tree_.children_left
-        children_right = tree_.children_right
-        value = tree_.value
+        c_code.append("template <typename Row>")
+        c_code.append(f"int predict_tree_{tree_idx}(Row features) {{")
         
         # Generate recursive tree traversal as if-else statements
-        def tree_to_code(node, indent=1):
+        def tree_to_code(i, indent=1):
             indent_str = "    " * indent
+            node = nodes[i]
             
             # Leaf node
-            if children_left[node] == children_right[node]:
-                # Get the majority class
-                class_counts = value[node][0]
-                predicted_class = np.argmax(class_counts)
-                return [f"{indent_str}return {predicted_class};"]
+            if node['feature'] == FOREST_LEAF:
+                return [f"{indent_str}return {node['value']};"]
             
-            # Internal node
-            code = []
-            feat_idx = feature[node]
-            thresh = threshold[node]
+            # Internal node (threshold is already exact float32, see flatten_tree)
+            condition = f"features[{node['feature']}] <= {c_float(node['threshold'])}"
+            first, second = i + 1, i + node['right']
+            if visits is not None:
+                hot, cold = visits[tree_idx][first], visits[tree_idx][second]
+                if cold > hot:
+                    # !(x <= t) keeps NaN on the right child
+                    condition = f"!({condition})"
+                    first, second = second, first
+                    hot, cold = cold, hot
+                if hot and hot >= CONFIG['pgo_likely_share'] * (hot + cold):
+                    condition = f"FOREST_LIKELY({condition})"
             
-            code.append(f"{indent_str}if (features[{feat_idx}] <= {thresh:.6f}f) {{")
-            code.extend(tree_to_code(children_left[node], indent + 1))
+            code = []
+            code.append(f"{indent_str}if ({condition}) {{")
+            code.extend(tree_to_code(first, indent + 1))
             code.append(f"{indent_str}}} else {{")
-            code.extend(tree_to_code(children_right[node], indent + 1))
+            code.extend(tree_to_code(second, indent + 1))
             code.append(f"{indent_str}}}")
             
             return code
@@ -220,23 +507,9 @@ def export_manual(model, scaler, label_encoder):
         c_code.append("}")
         c_code.append("")
     
-    # Main prediction function
-    c_code.append("// Main prediction function - returns class index")
-    c_code.append("int predict(float* raw_features) {")
-    c_code.append("    // Scale features")
-    c_code.append("    float scaled[NUM_FEATURES];")
-    c_code.append("    scale_features(raw_features, scaled);")
-    c_code.append("    ")
-    c_code.append("    // Vote counting")
-    c_code.append("    int votes[NUM_CLASSES] = {0};")
-    c_code.append("    ")
-    c_code.append("    // Get prediction from each tree")
-    
-    for i in range(n_trees):
-        c_code.append(f"    votes[predict_tree_{i}(scaled)]++;")
-    
-    c_code.append("    ")
-    c_code.append("    // Find majority vote")
+    # Majority vote
+    c_code.append("// Find majority vote (ties go to the lowest class index)")
+    c_code.append("int majority_vote(const int* votes) {")
     c_code.append("    int max_votes = 0;")
     c_code.append("    int predicted_class = 0;")
     c_code.append("    for (int i = 0; i < NUM_CLASSES; i++) {")
@@ -245,11 +518,226 @@ def export_manual(model, scaler, label_encoder):
     c_code.append("            predicted_class = i;")
     c_code.append("        }")
     c_code.append("    }")
-    c_code.append("    ")
     c_code.append("    return predicted_class;")
     c_code.append("}")
     c_code.append("")
     
+    # All trees for one sample
+    c_code.append("// Add each tree's vote for one sample to votes[NUM_CLASSES]")
+    c_code.append("template <typename Row>")
+    c_code.append("void vote_trees(Row features, int* votes) {")
+    for i in range(n_trees):
+        if weights[i] == 1:
+            c_code.append(f"    votes[predict_tree_{i}(features)]++;")
+        else:
+            c_code.append(f"    votes[predict_tree_{i}(features)] += {weights[i]};")
+    c_code.append("}")
+    c_code.append("")
+    
+    # Function table for per-tree inspection and benchmarks
+    c_code.append("// Each tree on its own (before vote weights), for inspection and benchmarks")
+    c_code.append("typedef int (*TreeFunction)(const float* features);")
+    c_code.append(f"#define NUM_TREE_FUNCTIONS {n_trees}")
+    c_code.append("const TreeFunction TREE_FUNCTIONS[NUM_TREE_FUNCTIONS] = {")
+    for i in range(n_trees):
+        c_code.append(f"    predict_tree_{i}<const float*>,")
+    c_code.append("};")
+    c_code.append("")
+    
+    # Main prediction function
+    c_code.append("// Count each tree's vote for one sample of raw readings")
+    c_code.append("void count_votes(float* raw_features, int* votes) {")
+    c_code.append("    for (int c = 0; c < NUM_CLASSES; c++) {")
+    c_code.append("        votes[c] = 0;")
+    c_code.append("    }")
+    if raw_thresholds:
+        c_code.append("    // Thresholds are in raw units: no scaling needed")
+        c_code.append("    vote_trees<const float*>(raw_features, votes);")
+    else:
+        c_code.append("    // Scale features")
+        c_code.append("    float scaled[NUM_FEATURES];")
+        c_code.append("    scale_features(raw_features, scaled);")
+        c_code.append("    vote_trees<const float*>(scaled, votes);")
+    c_code.append("}")
+    c_code.append("")
+    
+    c_code.append("// Main prediction function - returns class index")
+    c_code.append("int predict(float* raw_features) {")
+    c_code.append("    int votes[NUM_CLASSES];")
+    c_code.append("    count_votes(raw_features, votes);")
+    c_code.append("    return majority_vote(votes);")
+    c_code.append("}")
+    c_code.append("")
+    
+    # Everything about one sample from a single traversal
+    c_code.append("// Everything one run of the forest says about a sample")
+    c_code.append("struct PredictionResult {")
+    c_code.append("    int class_idx;            // Predicted class (same as predict())")
+    c_code.append("    int votes[NUM_CLASSES];   // Trees voting for each class")
+    c_code.append("    int margin;               // Winner's votes minus the runner-up's")
+    c_code.append("    int is_fault;             // 1 if class_idx is not NORMAL_CLASS")
+    c_code.append("};")
+    c_code.append("")
+    c_code.append("// Predict once and keep the votes - use instead of calling predict(),")
+    c_code.append("// is_fault() and predict_class_name() on the same sample")
+    c_code.append("PredictionResult predict_result(float* raw_features) {")
+    c_code.append("    PredictionResult result;")
+    c_code.append("    count_votes(raw_features, result.votes);")
+    c_code.append("    result.class_idx = majority_vote(result.votes);")
+    c_code.append("    ")
+    c_code.append("    int runner_up = 0;")
+    c_code.append("    for (int i = 0; i < NUM_CLASSES; i++) {")
+    c_code.append("        if (i != result.class_idx && result.votes[i] > runner_up) {")
+    c_code.append("            runner_up = result.votes[i];")
+    c_code.append("        }")
+    c_code.append("    }")
+    c_code.append("    result.margin = result.votes[result.class_idx] - runner_up;")
+    c_code.append("    result.is_fault = (result.class_idx != NORMAL_CLASS) ? 1 : 0;")
+    c_code.append("    return result;")
+    c_code.append("}")
+    c_code.append("")
+    
+    # Early exit: stop as soon as the remaining trees cannot change the winner.
+    # Opt-in: slower than predict() on the host, and its counters are state
+    if tree_order is None:
+        tree_order = list(range(n_trees))
+    c_code.append("// predict_early_exit() and its counters, only with -DPREDICT_EARLY_EXIT")
+    c_code.append("// (or #define PREDICT_EARLY_EXIT before including this header). Off by")
+    c_code.append("// default: it is slower than predict() on the host, the vote checks cost")
+    c_code.append("// more than the trees they skip (benchmarks/bench_backends.cpp: 56.5")
+    c_code.append("// against 48.3 ns per sample, 1-vCPU Xeon, g++ 12 -O2)")
+    c_code.append("#ifdef PREDICT_EARLY_EXIT")
+    c_code.append("")
+    c_code.append("// 1 if no class can still overtake the leader with `remaining` trees left")
+    c_code.append("int vote_decided(const int* votes, int remaining) {")
+    c_code.append("    int leader = majority_vote(votes);")
+    c_code.append("    int lead = votes[leader];")
+    c_code.append("    int decided = 1;")
+    c_code.append("    // Branch-free: the exit point already varies from sample to sample")
+    c_code.append("    for (int i = 0; i < NUM_CLASSES; i++) {")
+    c_code.append("        int best = votes[i] + remaining;")
+    c_code.append("        decided &= (i == leader) | (best < lead) | ((best == lead) & (i > leader));")
+    c_code.append("    }")
+    c_code.append("    return decided;")
+    c_code.append("}")
+    c_code.append("")
+    c_code.append("// Evaluation order of predict_early_exit()")
+    c_code.append("const uint8_t TREE_ORDER[] = {")
+    c_code.append("    " + ", ".join(str(t) for t in tree_order))
+    c_code.append("};")
+    c_code.append("")
+    c_code.append("// Counters for predict_early_exit() (set to zero to reset)")
+    c_code.append("struct EarlyExitStats {")
+    c_code.append("    unsigned long predictions;     // Calls to predict_early_exit()")
+    c_code.append("    unsigned long trees_skipped;   // Trees not evaluated because the winner was fixed")
+    c_code.append("};")
+    c_code.append("EarlyExitStats early_exit_stats = {0, 0};")
+    c_code.append("")
+    c_code.append("// Same class as predict(), but trees run in TREE_ORDER and evaluation")
+    c_code.append("// stops once the majority can no longer change")
+    c_code.append("int predict_early_exit(float* raw_features) {")
+    if raw_thresholds:
+        c_code.append("    const float* features = raw_features;")
+    else:
+        c_code.append("    float scaled[NUM_FEATURES];")
+        c_code.append("    scale_features(raw_features, scaled);")
+        c_code.append("    const float* features = scaled;")
+    c_code.append("    int votes[NUM_CLASSES] = {0};")
+    c_code.append("    early_exit_stats.predictions++;")
+    c_code.append("    ")
+    evaluated = 0
+    for tree_idx in tree_order:
+        if weights[tree_idx] == 1:
+            c_code.append(f"    votes[predict_tree_{tree_idx}(features)]++;")
+        else:
+            c_code.append(f"    votes[predict_tree_{tree_idx}(features)] += {weights[tree_idx]};")
+        evaluated += weights[tree_idx]
+        remaining = n_votes - evaluated
+        # The leader needs at least `remaining` votes to be safe, so earlier checks never pass
+        if remaining > 0 and evaluated >= remaining:
+            c_code.append(f"    if (vote_decided(votes, {remaining})) {{")
+            c_code.append(f"        early_exit_stats.trees_skipped += {remaining};")
+            c_code.append("        return majority_vote(votes);")
+            c_code.append("    }")
+    c_code.append("    return majority_vote(votes);")
+    c_code.append("}")
+    c_code.append("")
+    c_code.append("#endif // PREDICT_EARLY_EXIT")
+    c_code.append("")
+    
+    # Batch prediction over column-major input
+    if raw_thresholds:
+        # Raw thresholds read X in place: no block to fill
+        c_code.append("// Batch vote counts - X is column-major (X[f * n + i]),")
+        c_code.append("// votes receives NUM_CLASSES counts per sample (votes[i * NUM_CLASSES + c])")
+        c_code.append("void predict_batch_votes(const float* X, size_t n, int* votes) {")
+        c_code.append("    for (size_t i = 0; i < n; i++) {")
+        c_code.append("        int* sample_votes = votes + i * NUM_CLASSES;")
+        c_code.append("        for (int c = 0; c < NUM_CLASSES; c++) {")
+        c_code.append("            sample_votes[c] = 0;")
+        c_code.append("        }")
+        c_code.append("        ColumnRow row = {X + i, n};")
+        c_code.append("        vote_trees(row, sample_votes);")
+        c_code.append("    }")
+        c_code.append("}")
+        c_code.append("")
+        c_code.append("// Batch prediction - X is column-major (X[f * n + i]), out receives n class indices")
+        c_code.append("void predict_batch(const float* X, size_t n, int* out) {")
+        c_code.append("    for (size_t i = 0; i < n; i++) {")
+        c_code.append("        int votes[NUM_CLASSES] = {0};")
+        c_code.append("        ColumnRow row = {X + i, n};")
+        c_code.append("        vote_trees(row, votes);")
+        c_code.append("        out[i] = majority_vote(votes);")
+        c_code.append("    }")
+        c_code.append("}")
+        c_code.append("")
+    else:
+        c_code.append("// Scale samples [start, start + count) of column-major X (X[f * n + i])")
+        c_code.append("// into a column-major block, one contiguous column at a time")
+        c_code.append("void scale_block(const float* X, size_t n, size_t start, int count, float* scaled) {")
+        c_code.append("    for (int f = 0; f < NUM_FEATURES; f++) {")
+        c_code.append("        const float* column = X + f * n + start;")
+        c_code.append("        float* out = scaled + f * PREDICT_BATCH_BLOCK;")
+        c_code.append("        for (int i = 0; i < count; i++) {")
+        c_code.append("            out[i] = (column[i] - SCALER_MEAN[f]) / SCALER_STD[f];")
+        c_code.append("        }")
+        c_code.append("    }")
+        c_code.append("}")
+        c_code.append("")
+        c_code.append("// Batch vote counts - X is column-major (X[f * n + i]),")
+        c_code.append("// votes receives NUM_CLASSES counts per sample (votes[i * NUM_CLASSES + c])")
+        c_code.append("void predict_batch_votes(const float* X, size_t n, int* votes) {")
+        c_code.append("    float scaled[NUM_FEATURES * PREDICT_BATCH_BLOCK];")
+        c_code.append("    for (size_t start = 0; start < n; start += PREDICT_BATCH_BLOCK) {")
+        c_code.append("        int count = (n - start < PREDICT_BATCH_BLOCK) ? (int)(n - start) : PREDICT_BATCH_BLOCK;")
+        c_code.append("        scale_block(X, n, start, count, scaled);")
+        c_code.append("        for (int i = 0; i < count; i++) {")
+        c_code.append("            int* sample_votes = votes + (start + i) * NUM_CLASSES;")
+        c_code.append("            for (int c = 0; c < NUM_CLASSES; c++) {")
+        c_code.append("                sample_votes[c] = 0;")
+        c_code.append("            }")
+        c_code.append("            BlockRow row = {scaled + i};")
+        c_code.append("            vote_trees(row, sample_votes);")
+        c_code.append("        }")
+        c_code.append("    }")
+        c_code.append("}")
+        c_code.append("")
+        c_code.append("// Batch prediction - X is column-major (X[f * n + i]), out receives n class indices")
+        c_code.append("void predict_batch(const float* X, size_t n, int* out) {")
+        c_code.append("    float scaled[NUM_FEATURES * PREDICT_BATCH_BLOCK];")
+        c_code.append("    for (size_t start = 0; start < n; start += PREDICT_BATCH_BLOCK) {")
+        c_code.append("        int count = (n - start < PREDICT_BATCH_BLOCK) ? (int)(n - start) : PREDICT_BATCH_BLOCK;")
+        c_code.append("        scale_block(X, n, start, count, scaled);")
+        c_code.append("        for (int i = 0; i < count; i++) {")
+        c_code.append("            int votes[NUM_CLASSES] = {0};")
+        c_code.append("            BlockRow row = {scaled + i};")
+        c_code.append("            vote_trees(row, votes);")
+        c_code.append("            out[start + i] = majority_vote(votes);")
+        c_code.append("        }")
+        c_code.append("    }")
+        c_code.append("}")
+        c_code.append("")
+    
     # Convenience function to get class name
     c_code.append("// Get the class name string from prediction")
     c_code.append("const char* predict_class_name(float* raw_features) {")
@@ -262,11 +750,8 @@ def export_manual(model, scaler, label_encoder):
     c_code.append("// Check if there's a fault (returns 1 if fault, 0 if normal)")
     c_code.append("int is_fault(float* raw_features) {")
     c_code.append("    int prediction = predict(raw_features);")
-    c_code.append("    // Class 0 is 'Normal' - return 1 if NOT normal")
-    
-    # Find the index of 'Normal' class
-    normal_idx = list(label_encoder.classes_).index('Normal')
-    c_code.append(f"    return (prediction != {normal_idx}) ? 1 : 0;")
+    c_code.append("    // Return 1 if NOT normal")
+    c_code.append("    return (prediction != NORMAL_CLASS) ? 1 : 0;")
     c_code.append("}")
     c_code.append("")
     
@@ -285,114 +770,3338 @@ def export_manual(model, scaler, label_encoder):
     return output_file
 
 
-def verify_export(model, scaler, label_encoder):
-    """Verify the exported model matches Python predictions."""
-    
+# =============================================================================
+# FLAT NODE TABLE EXPORT (forest_runtime.h)
+# =============================================================================
+FOREST_LEAF = 0xFF
+
+
+def to_float32(value):
+    """Round a Python float to the nearest float32 (what the C compiler does)."""
+    return struct.unpack('<f', struct.pack('<f', value))[0]
+
+
+def float32_threshold(value):
+    """
+    Largest float32 that is <= value.
+
+    sklearn casts inputs to float32 and compares them against float64
+    thresholds. For any float32 x:  x <= value  <=>  x <= float32_threshold(value),
+    so a float-only runtime makes exactly the same decisions.
+    """
+    f = to_float32(value)
+    if f > value:
+        bits = struct.unpack('<I', struct.pack('<f', f))[0]
+        if f > 0:
+            bits -= 1
+        elif f < 0:
+            bits += 1
+        else:
+            bits = 0x80000001  # smallest negative float32
+        f = struct.unpack('<f', struct.pack('<I', bits))[0]
+    return f
+
+
+def c_float(value):
+    """Format a float32 value as a C float literal that round-trips exactly."""
+    text = f"{value:.9g}"
+    if not any(c in text for c in '.en'):
+        text += '.0'
+    return text + 'f'
+
+
+def flatten_tree(tree):
+    """
+    Flatten one sklearn tree into pre-order node records.
+
+    The left child of a split is always the next record and `right` is the
+    distance from the split to its right child, matching ForestNode in
+    forest_runtime.h. `split` keeps the original float64 threshold and
+    every node keeps the class distribution of the training samples that
+    reach it in `proba` (leaves for soft voting, all nodes for attribution).
+    """
+    tree_ = tree.tree_
+    nodes = []
+
+    def visit(node):
+        idx = len(nodes)
+        left = tree_.children_left[node]
+        right = tree_.children_right[node]
+
+        # Leaf node
+        if left == right:
+            counts = [float(c) for c in tree_.value[node][0]]
+            nodes.append({
+                'feature': FOREST_LEAF,
+                'threshold': 0.0,
+                'split': 0.0,
+                'right': 0,
+                'value': int(np.argmax(tree_.value[node][0])),
+                'proba': [c / sum(counts) for c in counts],
+            })
+            return
+
+        # Internal node
+        counts = [float(c) for c in tree_.value[node][0]]
+        nodes.append({
+            'feature': int(tree_.feature[node]),
+            'threshold': float32_threshold(float(tree_.threshold[node])),
+            'split': float(tree_.threshold[node]),
+            'right': 0,
+            'value': 0,
+            'proba': [c / sum(counts) for c in counts],
+        })
+        visit(left)
+        nodes[idx]['right'] = len(nodes) - idx
+        visit(right)
+
+    visit(0)
+    return nodes
+
+
+def flatten_forest(model):
+    """Flatten every tree of the forest (see flatten_tree)."""
+    return [flatten_tree(tree) for tree in model.estimators_]
+
+
+def float32_key(value):
+    """Map a float32 to an integer that sorts the same way (NaN excluded)."""
+    bits = struct.unpack('<I', struct.pack('<f', value))[0]
+    return bits ^ 0xFFFFFFFF if bits & 0x80000000 else bits | 0x80000000
+
+
+def float32_from_key(key):
+    """Inverse of float32_key()."""
+    bits = key & 0x7FFFFFFF if key & 0x80000000 else key ^ 0xFFFFFFFF
+    return struct.unpack('<f', struct.pack('<I', bits))[0]
+
+
+def device_scale(x, mean, std):
+    """One feature scaled exactly like the C code: (x - mean) / std in float32."""
+    return to_float32(to_float32(x - mean) / std)
+
+
+def fold_threshold(threshold, mean, std):
+    """
+    Raw-unit threshold r for a scaled split `x_scaled <= threshold`.
+
+    device_scale() is monotonic, so the raw inputs that go left are all
+    float32 x <= r, where r is the largest float32 that still scales to
+    <= threshold. Binary search over the float32 ordering finds it, which
+    makes `x <= r` bit-exact with the scaled comparison for every input.
+    """
+    lo = float32_key(float('-inf'))   # always goes left
+    hi = float32_key(float('inf'))    # always goes right
+    while hi - lo > 1:
+        mid = (lo + hi) // 2
+        if device_scale(float32_from_key(mid), mean, std) <= threshold:
+            lo = mid
+        else:
+            hi = mid
+    raw = float32_from_key(lo)
+
+    assert device_scale(raw, mean, std) <= threshold
+    assert device_scale(float32_from_key(lo + 1), mean, std) > threshold
+    return raw
+
+
+def fold_scaler(trees, scaler):
+    """
+    Copy flat trees with every threshold mapped back into raw sensor units
+    (volts, amps, degC, lux), so inference can skip the StandardScaler.
+    `split` keeps the original sklearn threshold in scaled units.
+    """
+    means, stds = device_scaler(scaler)
+    folded = []
+    for nodes in trees:
+        folded_nodes = []
+        for node in nodes:
+            node = dict(node)
+            if node['feature'] != FOREST_LEAF:
+                f = node['feature']
+                node['threshold'] = fold_threshold(node['threshold'], means[f], stds[f])
+            folded_nodes.append(node)
+        folded.append(folded_nodes)
+    return folded
+
+
+def flat_tree_leaf(nodes, x):
+    """Python mirror of forest_tree_leaf() - x must hold float32 values."""
+    i = 0
+    while nodes[i]['feature'] != FOREST_LEAF:
+        node = nodes[i]
+        i += 1 if x[node['feature']] <= node['threshold'] else node['right']
+    return nodes[i]
+
+
+def walk_flat_tree(nodes, x):
+    """Python mirror of forest_tree_predict() - x must hold float32 values."""
+    return flat_tree_leaf(nodes, x)['value']
+
+
+def sklearn_tree_class(tree, x):
+    """Leaf class of one sklearn tree, walked with its float64 thresholds."""
+    tree_ = tree.tree_
+    node = 0
+    while tree_.children_left[node] != tree_.children_right[node]:
+        if x[tree_.feature[node]] <= tree_.threshold[node]:
+            node = tree_.children_left[node]
+        else:
+            node = tree_.children_right[node]
+    return int(np.argmax(tree_.value[node][0]))
+
+
+def sklearn_tree_proba(tree, x):
+    """Normalized class distribution of the leaf one sklearn tree reaches."""
+    tree_ = tree.tree_
+    node = 0
+    while tree_.children_left[node] != tree_.children_right[node]:
+        if x[tree_.feature[node]] <= tree_.threshold[node]:
+            node = tree_.children_left[node]
+        else:
+            node = tree_.children_right[node]
+    counts = [float(c) for c in tree_.value[node][0]]
+    return [c / sum(counts) for c in counts]
+
+
+def sklearn_proba(model, x):
+    """Mean leaf distribution over the trees, as RandomForestClassifier.predict_proba()."""
+    proba = [0.0] * len(model.classes_)
+    for tree in model.estimators_:
+        for c, p in enumerate(sklearn_tree_proba(tree, x)):
+            proba[c] += p
+    return [p / len(model.estimators_) for p in proba]
+
+
+def sklearn_vote(model, x):
+    """Hard majority vote of the sklearn trees, as the exported headers vote."""
+    votes = [0] * len(model.classes_)
+    for tree in model.estimators_:
+        votes[sklearn_tree_class(tree, x)] += 1
+    return int(np.argmax(votes))
+
+
+def forest_limits_assert(forest_name, n_features, n_classes):
+    """static_assert lines keeping a table within the runtime's stack buffers.
+
+    The forest_*.h runtimes size their scaled-feature and vote arrays with
+    FOREST_MAX_FEATURES and FOREST_MAX_CLASSES (forest_runtime.h), so a
+    larger model must fail to compile instead of writing past them.
+    """
+    return [
+        f"static_assert({n_features} <= FOREST_MAX_FEATURES && {n_classes} <= FOREST_MAX_CLASSES,",
+        f'              "{forest_name}: define FOREST_MAX_FEATURES >= {n_features} and '
+        f'FOREST_MAX_CLASSES >= {n_classes}");',
+        "",
+    ]
+
+
+def export_flat_table(model, scaler, label_encoder, trees, raw_thresholds=False, explain_trees=None):
+    """
+    Export the forest as a flat node table for forest_runtime.h.
+
+    Every tree becomes a run of 8-byte ForestNode records, and one shared
+    loop walks them, so flash use is a few bytes per node instead of a
+    compiled branch per node. With raw_thresholds the Forest carries no
+    scaler and forest_predict() feeds raw readings straight to the trees.
+
+    `explain_trees` are the trees as sklearn built them (before compaction,
+    which merges leaves with different distributions); they go out as a
+    second table, SOLAR_FOREST_EXPLAIN, with every node's normalized
+    tree_.value in FOREST_NODE_VALUES, so forest_predict_explain() scores
+    are predict_proba().
+    """
+
     print("\n" + "=" * 70)
-    print("🧪 VERIFYING EXPORT")
+    print("🔧 FLAT NODE TABLE EXPORT")
     print("=" * 70)
-    
-    test_cases = [
-        [20.0, 5.0, 35.0, 1000.0],   # Normal
-        [10.0, 2.0, 45.0, 800.0],    # Partial Shading
-        [22.0, 0.05, 30.0, 900.0],   # Open Circuit
-        [1.0, 8.0, 65.0, 700.0],     # Short Circuit
-    ]
-    
-    print("\nPython model predictions (for verification):")
-    print("-" * 50)
-    
-    for i, features in enumerate(test_cases):
-        X = np.array([features])
-        X_scaled = scaler.transform(X)
-        prediction = model.predict(X_scaled)[0]
-        label = label_encoder.inverse_transform([prediction])[0]
-        
-        print(f"Test {i+1}: V={features[0]:5.1f}, I={features[1]:4.2f}, "
-              f"T={features[2]:4.1f}, L={features[3]:6.1f}")
-        print(f"        Prediction: {prediction} ({label})")
-        print()
-    
-    print("✅ Use these values to verify ESP32 predictions match!")
 
+    class_names = list(label_encoder.classes_)
+    feature_names = FEATURE_NAMES
+    n_nodes = sum(len(nodes) for nodes in trees)
 
-def generate_esp32_usage_guide():
-    """Generate documentation for using the model on ESP32."""
-    
-    guide = """
-================================================================================
-ESP32 USAGE GUIDE - Solar Panel Fault Detection Model
-================================================================================
+    c_code = []
 
-INSTALLATION STEPS:
--------------------
-1. Copy 'model.h' (or 'model_manual.h') to your Arduino project folder
-2. Include it in your sketch: #include "model.h"
-3. Call predict() with your sensor readings
+    # Header comment
+    c_code.append("/*")
+    c_code.append(" * Solar Panel Fault Detection - Random Forest Model (flat node table)")
+    c_code.append(generated_line())
+    c_code.append(f" * Trees: {len(trees)}, Max Depth: {model.max_depth}, Nodes: {n_nodes} ({n_nodes * 8} bytes)")
+    if raw_thresholds:
+        c_code.append(" * Thresholds: raw sensor units (StandardScaler folded in)")
+    c_code.append(" * ")
+    c_code.append(" * Classes:")
+    for i, name in enumerate(class_names):
+        c_code.append(f" *   {i}: {name}")
+    c_code.append(" * ")
+    c_code.append(" * Usage: int fault_type = forest_predict(&SOLAR_FOREST, features);")
+    c_code.append(" */")
+    c_code.append("")
 
-USAGE EXAMPLE:
---------------
-```cpp
-#include "model.h"
+    c_code.append("#ifndef SOLAR_FAULT_MODEL_TABLE_H")
+    c_code.append("#define SOLAR_FAULT_MODEL_TABLE_H")
+    c_code.append("")
+    c_code.append('#include "forest_runtime.h"')
+    c_code.append("")
 
-void loop() {
-    // Read sensors (replace with actual sensor code)
-    float voltage = readVoltage();
-    float current = readCurrent();
-    float temperature = readTemperature();
-    float light = readLight();
-    
-    // Create feature array [Voltage, Current, Temperature, Light_Intensity]
-    float features[4] = {voltage, current, temperature, light};
-    
-    // Get prediction (returns 0-3)
-    int fault_type = predict(features);
-    
-    // Get human-readable name
-    const char* fault_name = CLASS_NAMES[fault_type];
-    
-    // Check if any fault
-    if (is_fault(features)) {
-        // Turn on fault LED
-        digitalWrite(FAULT_LED, HIGH);
-    }
-}
-```
+    c_code.append("// Fault type names")
+    c_code.append("const char* const FOREST_CLASS_NAMES[] = {")
+    for name in class_names:
+        c_code.append(f'    "{name}",')
+    c_code.append("};")
+    c_code.append("")
 
-CLASS MAPPING:
---------------
-0 = Normal
-1 = Open_Circuit  
-2 = Partial_Shading
-3 = Short_Circuit
+    c_code.append("// Feature names (for debugging)")
+    c_code.append("const char* const FOREST_FEATURE_NAMES[] = {")
+    for name in feature_names:
+        c_code.append(f'    "{name}",')
+    c_code.append("};")
+    c_code.append("")
 
-MEMORY USAGE (APPROXIMATE):
----------------------------
-- Code size: ~5-15 KB (depends on tree complexity)
-- RAM usage: ~200-500 bytes
-- Suitable for ESP32 (520KB RAM, 4MB Flash)
+    # Scaler parameters (same literals as model_manual.h)
+    if not raw_thresholds:
+        c_code.append("// StandardScaler parameters")
+        c_code.append("const float FOREST_SCALER_MEAN[] = {")
+        c_code.append("    " + ", ".join([f"{m:.6f}f" for m in scaler.mean_]))
+        c_code.append("};")
+        c_code.append("")
+        c_code.append("const float FOREST_SCALER_STD[] = {")
+        c_code.append("    " + ", ".join([f"{s:.6f}f" for s in scaler.scale_]))
+        c_code.append("};")
+        c_code.append("")
 
-TIPS FOR ESP32:
----------------
-1. Use float instead of double for ESP32 efficiency
-2. Model is already optimized with limited trees and depth
-3. Prediction takes ~1-5ms on ESP32 @ 240MHz
-4. Consider using FreeRTOS task for continuous monitoring
+    def append_forest(forest_name, nodes_name, roots_name, forest_trees):
+        c_code.append(f"const ForestNode {nodes_name}[] = {{")
+        for tree_idx, nodes in enumerate(forest_trees):
+            c_code.append(f"    // Tree {tree_idx}")
+            for node in nodes:
+                if node['feature'] == FOREST_LEAF:
+                    c_code.append(f"    {{ 0.0f, 0, FOREST_LEAF, {node['value']} }},")
+                else:
+                    c_code.append(f"    {{ {c_float(node['threshold'])}, {node['right']}, "
+                                  f"{node['feature']}, 0 }},")
+        c_code.append("};")
+        c_code.append("")
 
-================================================================================
-"""
-    
-    with open('ESP32_USAGE_GUIDE.txt', 'w') as f:
-        f.write(guide)
-    
-    print("\n✅ Usage guide saved to: ESP32_USAGE_GUIDE.txt")
+        tree_roots = []
+        offset = 0
+        for nodes in forest_trees:
+            tree_roots.append(offset)
+            offset += len(nodes)
+        c_code.append("// Root node of each tree")
+        c_code.append(f"const uint16_t {roots_name}[] = {{")
+        c_code.append("    " + ", ".join(str(r) for r in tree_roots))
+        c_code.append("};")
+        c_code.append("")
+
+        c_code.append(f"const Forest {forest_name} = {{")
+        c_code.append(f"    {nodes_name},")
+        c_code.append(f"    {roots_name},")
+        c_code.append(f"    {len(forest_trees)},   // num_trees")
+        c_code.append(f"    {len(feature_names)},    // num_features")
+        c_code.append(f"    {len(class_names)},    // num_classes")
+        if raw_thresholds:
+            c_code.append("    NULL,   // scaler_mean: folded into thresholds")
+            c_code.append("    NULL,   // scaler_std")
+        else:
+            c_code.append("    FOREST_SCALER_MEAN,")
+            c_code.append("    FOREST_SCALER_STD,")
+        c_code.append("    FOREST_CLASS_NAMES,")
+        c_code.append("};")
+        c_code.extend(forest_limits_assert(forest_name, len(feature_names), len(class_names)))
+
+    # Node table
+    c_code.append("// Node table: { threshold, right, feature, value }")
+    append_forest('SOLAR_FOREST', 'FOREST_NODES', 'FOREST_ROOTS', trees)
+
+    # sklearn's own trees and node distributions, for forest_predict_explain()
+    explain_nodes = 0
+    if explain_trees and all('proba' in node for nodes in explain_trees for node in nodes):
+        explain_nodes = sum(len(nodes) for nodes in explain_trees)
+        c_code.append("// The trees before compaction (same votes as SOLAR_FOREST), for")
+        c_code.append("// forest_predict_explain(&SOLAR_FOREST_EXPLAIN, FOREST_NODE_VALUES, ...);")
+        c_code.append("// unused tables are dropped by the linker")
+        append_forest('SOLAR_FOREST_EXPLAIN', 'FOREST_EXPLAIN_NODES', 'FOREST_EXPLAIN_ROOTS', explain_trees)
+
+        c_code.append("// Class distribution at each node (sklearn's tree_.value, normalized;")
+        c_code.append("// num_classes per node, same order as FOREST_EXPLAIN_NODES)")
+        c_code.append("#define FOREST_HAVE_NODE_VALUES 1")
+        c_code.append("const float FOREST_NODE_VALUES[] = {")
+        for tree_idx, nodes in enumerate(explain_trees):
+            c_code.append(f"    // Tree {tree_idx}")
+            for node in nodes:
+                c_code.append("    " + ", ".join(c_float(to_float32(p)) for p in node['proba']) + ",")
+        c_code.append("};")
+        c_code.append("")
+
+    c_code.append("#endif // SOLAR_FAULT_MODEL_TABLE_H")
+
+    output_file = CONFIG['output_header_table']
+    with open(output_file, 'w') as f:
+        f.write('\n'.join(c_code) + '\n')
+
+    print(f"✅ Flat table export complete: {output_file}")
+    print(f"   Nodes: {n_nodes} ({n_nodes * 8} bytes of table)")
+    if explain_nodes:
+        print(f"   Attribution table: {explain_nodes} nodes ({explain_nodes * 8} bytes + "
+              f"{explain_nodes * len(class_names) * 4} bytes of node values)")
+    print(f"   File size: {os.path.getsize(output_file)} bytes")
+
+    return output_file
+
+
+def feature_row(readings):
+    """
+    FEATURE_NAMES values from {feature name: reading}. Readings are kept
+    as given; features missing from `readings` come from DERIVED_FEATURES
+    over the float32 readings, as the device computes them.
+    """
+    device = {name: to_float32(v) for name, v in readings.items()}
+    return [readings[name] if name in readings else DERIVED_FEATURES[name](device)
+            for name in FEATURE_NAMES]
+
+
+def load_dataset_rows(path, columns):
+    """Read FEATURE_NAMES rows from one dataset (columns: DATASET_COLUMNS entry)."""
+    rows = []
+    if not os.path.exists(path):
+        return rows
+    with open(path, newline='') as f:
+        for record in csv.DictReader(f):
+            try:
+                rows.append(feature_row({name: float(record[c]) for name, c in columns.items()
+                                         if name in FEATURE_NAMES}))
+            except (KeyError, TypeError, ValueError):
+                continue  # incomplete row
+    return rows
+
+
+def load_feature_rows():
+    """Read FEATURE_NAMES rows from every dataset."""
+    rows = []
+    for path, columns in zip(CONFIG['datasets'], DATASET_COLUMNS):
+        rows.extend(load_dataset_rows(path, columns))
+    return rows
+
+
+def device_scaler(scaler):
+    """Scaler parameters exactly as the C headers store them (six decimals, float32)."""
+    means = [to_float32(float(f"{m:.6f}")) for m in scaler.mean_]
+    stds = [to_float32(float(f"{s:.6f}")) for s in scaler.scale_]
+    return means, stds
+
+
+def load_scaled_rows(scaler):
+    """Dataset rows scaled the way the device does it (float32 math)."""
+    means, stds = device_scaler(scaler)
+    scaled = []
+    for raw in load_feature_rows():
+        scaled.append([device_scale(to_float32(raw[i]), means[i], stds[i])
+                       for i in range(len(raw))])
+    return scaled
+
+
+def load_model_inputs(scaler, raw_thresholds):
+    """Dataset rows as the exported trees see them: raw float32 or scaled."""
+    if raw_thresholds:
+        return [[to_float32(v) for v in raw] for raw in load_feature_rows()]
+    return load_scaled_rows(scaler)
+
+
+def verify_flat_table(model, scaler, trees, raw_thresholds=False):
+    """
+    Check that the flat trees make the same decision as the sklearn tree
+    for every tree and every dataset row. sklearn always sees the scaled
+    row; with raw_thresholds the flat trees see the raw row, which checks
+    the folded thresholds bit for bit against the scaled path.
+    """
+
+    print("\n" + "=" * 70)
+    print("🧪 VERIFYING FLAT TABLE" + (" (RAW THRESHOLDS)" if raw_thresholds else ""))
+    print("=" * 70)
+
+    rows = load_scaled_rows(scaler)
+    inputs = load_model_inputs(scaler, raw_thresholds)
+    mismatches = 0
+
+    for x, x_model in zip(rows, inputs):
+        for tree, nodes in zip(model.estimators_, trees):
+            if walk_flat_tree(nodes, x_model) != sklearn_tree_class(tree, x):
+                mismatches += 1
+
+    checks = len(rows) * len(trees)
+    if mismatches:
+        raise ExportCheckError(f"{mismatches} of {checks} leaf decisions differ from the sklearn trees")
+    print(f"✅ {len(rows)} rows x {len(trees)} trees: all {checks} leaf decisions match")
+
+
+# =============================================================================
+# TREE COMPACTION
+# =============================================================================
+def compact_tree(nodes):
+    """
+    Rebuild one flat tree without dead structure.
+
+    A split whose outcome is already fixed by the splits above it on the
+    same feature is replaced by the child that is always taken, and a split
+    whose two subtrees are identical (e.g. both leaves of the same class)
+    is replaced by that subtree. Both rules hold for every input, NaN
+    included: NaN fails every `<=` and always goes right, so it only ever
+    reaches right branches, which stay right.
+    """
+    def node_key(node):
+        return (node['feature'], node['threshold'], node['right'], node['value'])
+
+    def build(i, bounds):
+        node = nodes[i]
+        if node['feature'] == FOREST_LEAF:
+            return [dict(node)]
+
+        # Inputs reaching here satisfy low < x[f] <= high
+        f, t = node['feature'], node['threshold']
+        low, high = bounds.get(f, (float('-inf'), float('inf')))
+        if t >= high:
+            return build(i + 1, bounds)
+        if t <= low:
+            return build(i + node['right'], bounds)
+
+        left = build(i + 1, {**bounds, f: (low, t)})
+        right = build(i + node['right'], {**bounds, f: (t, high)})
+        if [node_key(n) for n in left] == [node_key(n) for n in right]:
+            return left
+
+        split = dict(node)
+        split['right'] = len(left) + 1
+        return [split] + left + right
+
+    return build(0, {})
+
+
+def compact_forest(trees, scaler, n_classes, raw_thresholds=False):
+    """
+    Shrink the forest without changing any prediction.
+
+    Every tree goes through compact_tree(), then trees that became
+    identical are merged into one tree that votes with a weight. Prints the
+    node and byte savings and checks the votes on every dataset row.
+    Returns (trees, weights).
+    """
+
+    print("\n" + "=" * 70)
+    print("🔧 TREE COMPACTION")
+    print("=" * 70)
+
+    compacted, weights, keys = [], [], []
+    for nodes in trees:
+        nodes = compact_tree(nodes)
+        key = [(n['feature'], n['threshold'], n['right'], n['value']) for n in nodes]
+        if key in keys:
+            weights[keys.index(key)] += 1
+            continue
+        keys.append(key)
+        compacted.append(nodes)
+        weights.append(1)
+
+    def count(forest):
+        n_nodes = sum(len(nodes) for nodes in forest)
+        n_splits = sum(1 for nodes in forest for n in nodes if n['feature'] != FOREST_LEAF)
+        return n_nodes, n_splits
+
+    nodes_before, splits_before = count(trees)
+    nodes_after, splits_after = count(compacted)
+    print(f"✅ Trees: {len(trees)} -> {len(compacted)} distinct (weights: {weights})")
+    print(f"   Nodes: {nodes_before} -> {nodes_after}, splits (if/else branches): "
+          f"{splits_before} -> {splits_after}")
+    print(f"   Flat table: {nodes_before * 8} -> {nodes_after * 8} bytes "
+          f"({(nodes_before - nodes_after) * 8} bytes saved)")
+
+    # Every compacted tree picks the same leaf class as its original on
+    # every dataset row, and on rows moved onto each side of every threshold
+    rows = load_model_inputs(scaler, raw_thresholds)
+    probes = list(rows)
+    for nodes in trees:
+        for node in nodes:
+            if node['feature'] == FOREST_LEAF:
+                continue
+            for value in (node['threshold'], next_float32(node['threshold']), float('nan')):
+                for x in rows[::len(rows) // 200 + 1]:
+                    probe = list(x)
+                    probe[node['feature']] = value
+                    probes.append(probe)
+
+    mismatches = 0
+    for original in trees:
+        key = [(n['feature'], n['threshold'], n['right'], n['value']) for n in compact_tree(original)]
+        nodes = compacted[keys.index(key)]
+        mismatches += sum(walk_flat_tree(original, x) != walk_flat_tree(nodes, x) for x in probes)
+    if mismatches:
+        raise ExportCheckError(f"{mismatches} leaf classes changed by compaction")
+    print(f"✅ Leaf classes identical on {len(probes)} inputs "
+          f"({len(rows)} dataset rows + threshold probes)")
+
+    return compacted, weights
+
+
+def expand_weighted(trees, weights):
+    """One copy of each tree per vote, for backends without tree weights."""
+    return [nodes for nodes, w in zip(trees, weights) for _ in range(w)]
+
+
+# =============================================================================
+# NODE PROFILE (profile-guided branch order)
+# =============================================================================
+def flat_table_fingerprint(trees):
+    """CRC-32 of FOREST_NODES as model_table.h stores it (see profile_nodes.cpp)."""
+    data = b''
+    for nodes in trees:
+        for node in nodes:
+            if node['feature'] == FOREST_LEAF:
+                data += struct.pack('<fHBB', 0.0, 0, FOREST_LEAF, node['value'])
+            else:
+                data += struct.pack('<fHBB', node['threshold'], node['right'], node['feature'], 0)
+    return zlib.crc32(data)
+
+
+def load_node_profile(trees, weights, scaler, raw_thresholds=False):
+    """
+    Visit count of every node, per distinct tree, for export_manual().
+
+    Uses CONFIG['node_profile'] when it was recorded on this exact node
+    table (benchmarks/profile_nodes.cpp replaying both datasets through
+    the runtime); otherwise replays the same rows here.
+    """
+
+    print("\n" + "=" * 70)
+    print("🔧 NODE PROFILE")
+    print("=" * 70)
+
+    if CONFIG['node_profile'] is None:
+        print("⚠️  Node profile disabled, keeping the trained branch order")
+        return None
+
+    table = expand_weighted(trees, weights)
+    n_nodes = sum(len(nodes) for nodes in table)
+    path = CONFIG['node_profile']
+    counts = None
+
+    if os.path.exists(path):
+        header, values = {}, []
+        with open(path) as f:
+            for line in f:
+                if line.startswith('#'):
+                    key, _, value = line[1:].partition(':')
+                    header[key.strip()] = value.strip()
+                elif line.strip():
+                    values.append(int(line))
+        fingerprint = f"{flat_table_fingerprint(table):08x}"
+        if header.get('fingerprint') == fingerprint and len(values) == n_nodes:
+            counts = values
+            print(f"✅ Node visits from {path} ({header.get('rows')} rows)")
+        else:
+            print(f"⚠️  {path} was recorded on another node table, replaying the datasets instead")
+
+    if counts is None:
+        counts = [0] * n_nodes
+        rows = load_model_inputs(scaler, raw_thresholds)
+        for x in rows:
+            offset = 0
+            for nodes in table:
+                i = 0
+                counts[offset] += 1
+                while nodes[i]['feature'] != FOREST_LEAF:
+                    node = nodes[i]
+                    i += 1 if x[node['feature']] <= node['threshold'] else node['right']
+                    counts[offset + i] += 1
+                offset += len(nodes)
+        print(f"✅ Node visits replayed on {len(rows)} dataset rows")
+
+    # First copy of each distinct tree (copies are adjacent in the table)
+    visits = []
+    offset = 0
+    for nodes, w in zip(trees, weights):
+        visits.append(counts[offset:offset + len(nodes)])
+        offset += len(nodes) * w
+
+    splits = flipped = hot_total = total = 0
+    for nodes, tree_visits in zip(trees, visits):
+        for i, node in enumerate(nodes):
+            if node['feature'] == FOREST_LEAF:
+                continue
+            left, right = tree_visits[i + 1], tree_visits[i + node['right']]
+            splits += 1
+            flipped += right > left
+            hot_total += max(left, right)
+            total += left + right
+    print(f"   {flipped} of {splits} splits have the right child hotter and are flipped")
+    print(f"   Hot side taken on {100.0 * hot_total / max(total, 1):.1f}% of split visits")
+
+    return visits
+
+
+# =============================================================================
+# EARLY EXIT TREE ORDER (predict_early_exit)
+# =============================================================================
+def vote_decided(votes, remaining):
+    """Python mirror of vote_decided() in model_manual.h."""
+    leader = int(np.argmax(votes))
+    for i, v in enumerate(votes):
+        best = v + remaining
+        if i != leader and (best > votes[leader] or (best == votes[leader] and i < leader)):
+            return False
+    return True
+
+
+def early_exit_vote(classes, order, n_classes, weights):
+    """Early-exit vote over per-tree classes - returns (class, tree votes evaluated)."""
+    votes = [0] * n_classes
+    remaining = sum(weights)
+    for tree_idx in order:
+        votes[classes[tree_idx]] += weights[tree_idx]
+        remaining -= weights[tree_idx]
+        if vote_decided(votes, remaining):
+            break
+    return int(np.argmax(votes)), sum(weights) - remaining
+
+
+def choose_tree_order(trees, scaler, n_classes, raw_thresholds=False, weights=None):
+    """
+    Pick the evaluation order for predict_early_exit() (CONFIG['tree_order']).
+
+    'decisive' builds the order greedily over the dataset rows: each next
+    tree is the one that fixes the winner for the most rows, and among
+    equals the one that most often votes for the final winner on rows not
+    yet fixed. Prints the average trees evaluated and checks that early
+    exit returns the full vote on every row.
+    """
+
+    print("\n" + "=" * 70)
+    print("🔧 EARLY EXIT TREE ORDER")
+    print("=" * 70)
+
+    n_trees = len(trees)
+    if weights is None:
+        weights = [1] * n_trees
+    n_votes = sum(weights)
+    rows = load_model_inputs(scaler, raw_thresholds)
+    classes = [[walk_flat_tree(nodes, x) for nodes in trees] for x in rows]
+    final = []
+    for row_classes in classes:
+        votes = [0] * n_classes
+        for c, w in zip(row_classes, weights):
+            votes[c] += w
+        final.append(int(np.argmax(votes)))
+
+    setting = CONFIG['tree_order']
+    if setting == 'index':
+        order = list(range(n_trees))
+    elif setting == 'decisive':
+        order = []
+        votes = [[0] * n_classes for _ in rows]
+        decided = [False] * len(rows)
+        left = n_votes
+        while len(order) < n_trees:
+            best_key, best_tree = None, None
+            for tree_idx in range(n_trees):
+                if tree_idx in order:
+                    continue
+                w = weights[tree_idx]
+                remaining = left - w
+                newly_decided = agreeing = 0
+                for r, row_classes in enumerate(classes):
+                    if decided[r]:
+                        continue
+                    c = row_classes[tree_idx]
+                    agreeing += w * (c == final[r])
+                    votes[r][c] += w
+                    newly_decided += vote_decided(votes[r], remaining)
+                    votes[r][c] -= w
+                key = (newly_decided, agreeing)
+                if best_key is None or key > best_key:
+                    best_key, best_tree = key, tree_idx
+            order.append(best_tree)
+            left -= weights[best_tree]
+            for r, row_classes in enumerate(classes):
+                if not decided[r]:
+                    votes[r][row_classes[best_tree]] += weights[best_tree]
+                    decided[r] = vote_decided(votes[r], left)
+    else:
+        order = [int(t) for t in setting]
+        if sorted(order) != list(range(n_trees)):
+            raise ValueError(f"tree_order must list every tree once: {setting}")
+
+    mismatches = 0
+    evaluated = {'index': 0, 'chosen': 0}
+    for row_classes, expected in zip(classes, final):
+        for name, tree_order in (('index', list(range(n_trees))), ('chosen', order)):
+            predicted, count = early_exit_vote(row_classes, tree_order, n_classes, weights)
+            evaluated[name] += count
+            mismatches += predicted != expected
+
+    n_rows = max(len(rows), 1)
+    print(f"✅ Tree order ({setting}): {order}")
+    print(f"   Trees evaluated per row: {evaluated['chosen'] / n_rows:.2f} of {n_votes} "
+          f"(index order: {evaluated['index'] / n_rows:.2f})")
+    if mismatches:
+        raise ExportCheckError(f"Early exit differs from the full vote {mismatches} times")
+    print(f"✅ Early exit matches the full vote on all {len(rows)} dataset rows")
+
+    return order
+
+
+# =============================================================================
+# QUICKSCORER BITVECTOR EXPORT (forest_quickscorer.h)
+# =============================================================================
+def build_quickscorer(trees, n_features):
+    """
+    Turn flat trees into QuickScorer conditions.
+
+    Leaves of each tree are numbered left to right. Every split becomes a
+    condition (threshold, tree, mask) whose mask clears the leaves of its
+    left subtree: if the test fails (x > threshold) those leaves cannot be
+    reached. Conditions are grouped by feature and sorted by threshold, so
+    at inference the failed tests for a feature are a prefix of its list.
+    """
+    conditions = [[] for _ in range(n_features)]
+    leaf_values = []
+
+    for tree_idx, nodes in enumerate(trees):
+        # Pre-order visits leaves left to right
+        leaf_ids = {}
+        for i, node in enumerate(nodes):
+            if node['feature'] == FOREST_LEAF:
+                leaf_ids[i] = len(leaf_ids)
+        leaf_values.append([nodes[i]['value'] for i in sorted(leaf_ids)])
+
+        for i, node in enumerate(nodes):
+            if node['feature'] == FOREST_LEAF:
+                continue
+            left_bits = 0
+            for j in range(i + 1, i + node['right']):
+                if j in leaf_ids:
+                    left_bits |= 1 << leaf_ids[j]
+            conditions[node['feature']].append((node['threshold'], tree_idx, left_bits))
+
+    for feature_conditions in conditions:
+        feature_conditions.sort(key=lambda c: c[0])
+
+    max_leaves = max(len(values) for values in leaf_values)
+    mask_bits = 32 if max_leaves <= 32 else 64
+    full = (1 << mask_bits) - 1
+    conditions = [[(t, tree, full & ~bits) for t, tree, bits in feature_conditions]
+                  for feature_conditions in conditions]
+
+    return {
+        'conditions': conditions,
+        'leaf_values': leaf_values,
+        'max_leaves': max_leaves,
+        'mask_bits': mask_bits,
+    }
+
+
+def quickscorer_tree_classes(qs, x):
+    """Python mirror of quickscorer_predict_scaled() - per-tree leaf classes."""
+    full = (1 << qs['mask_bits']) - 1
+    leaves = [full] * len(qs['leaf_values'])
+    for feature, feature_conditions in enumerate(qs['conditions']):
+        for threshold, tree, mask in feature_conditions:
+            if x[feature] <= threshold:
+                break
+            leaves[tree] &= mask
+    classes = []
+    for tree, bits in enumerate(leaves):
+        exit_leaf = (bits & -bits).bit_length() - 1
+        classes.append(qs['leaf_values'][tree][exit_leaf])
+    return classes
+
+
+def export_quickscorer(model, scaler, label_encoder, trees, raw_thresholds=False):
+    """
+    Export the forest for the QuickScorer bitvector runtime.
+
+    Instead of walking each tree, inference scans the sorted thresholds of
+    each feature and ANDs per-tree leaf bitmasks; the exit leaf of a tree is
+    the lowest bit left set. Needs at most 64 leaves per tree.
+    """
+
+    print("\n" + "=" * 70)
+    print("🔧 QUICKSCORER BITVECTOR EXPORT")
+    print("=" * 70)
+
+    class_names = list(label_encoder.classes_)
+    feature_names = FEATURE_NAMES
+    n_features = len(feature_names)
+    qs = build_quickscorer(trees, n_features)
+
+    if qs['max_leaves'] > 64:
+        print(f"⚠️  A tree has {qs['max_leaves']} leaves (limit 64). Skipping...")
+        return None
+
+    n_conditions = sum(len(c) for c in qs['conditions'])
+    mask_type = f"uint{qs['mask_bits']}_t"
+    mask_hex = qs['mask_bits'] // 4
+    mask_suffix = "u" if qs['mask_bits'] == 32 else "ull"
+
+    c_code = []
+
+    # Header comment
+    c_code.append("/*")
+    c_code.append(" * Solar Panel Fault Detection - Random Forest Model (QuickScorer bitvectors)")
+    c_code.append(generated_line())
+    c_code.append(f" * Trees: {len(trees)}, Max Depth: {model.max_depth}, "
+                  f"Conditions: {n_conditions}, Max Leaves: {qs['max_leaves']}")
+    if raw_thresholds:
+        c_code.append(" * Thresholds: raw sensor units (StandardScaler folded in)")
+    c_code.append(" * ")
+    c_code.append(" * Classes:")
+    for i, name in enumerate(class_names):
+        c_code.append(f" *   {i}: {name}")
+    c_code.append(" * ")
+    c_code.append(" * Usage: int fault_type = quickscorer_predict(&SOLAR_QUICKSCORER, features);")
+    c_code.append(" */")
+    c_code.append("")
+
+    c_code.append("#ifndef SOLAR_FAULT_MODEL_QUICKSCORER_H")
+    c_code.append("#define SOLAR_FAULT_MODEL_QUICKSCORER_H")
+    c_code.append("")
+    c_code.append(f"#define QUICKSCORER_MASK_BITS {qs['mask_bits']}")
+    c_code.append(f"#define QUICKSCORER_MAX_TREES {len(trees)}")
+    c_code.append('#include "forest_quickscorer.h"')
+    c_code.append("")
+
+    c_code.append("// Fault type names")
+    c_code.append("const char* const QS_CLASS_NAMES[] = {")
+    for name in class_names:
+        c_code.append(f'    "{name}",')
+    c_code.append("};")
+    c_code.append("")
+
+    if not raw_thresholds:
+        c_code.append("// StandardScaler parameters")
+        c_code.append("const float QS_SCALER_MEAN[] = {")
+        c_code.append("    " + ", ".join([f"{m:.6f}f" for m in scaler.mean_]))
+        c_code.append("};")
+        c_code.append("")
+        c_code.append("const float QS_SCALER_STD[] = {")
+        c_code.append("    " + ", ".join([f"{s:.6f}f" for s in scaler.scale_]))
+        c_code.append("};")
+        c_code.append("")
+
+    # Conditions, grouped by feature with ascending thresholds
+    offsets = [0]
+    thresholds, tree_ids, masks = [], [], []
+    for feature_conditions in qs['conditions']:
+        for threshold, tree, mask in feature_conditions:
+            thresholds.append(c_float(threshold))
+            tree_ids.append(str(tree))
+            masks.append(f"0x{mask:0{mask_hex}X}{mask_suffix}")
+        offsets.append(len(thresholds))
+
+    c_code.append("// First condition of each feature (plus end marker)")
+    c_code.append("const uint16_t QS_FEATURE_OFFSETS[] = {")
+    c_code.append("    " + ", ".join(str(o) for o in offsets))
+    c_code.append("};")
+    c_code.append("")
+
+    def append_by_feature(values, per_line):
+        for feature in range(n_features):
+            c_code.append(f"    // {feature_names[feature]}")
+            chunk = values[offsets[feature]:offsets[feature + 1]]
+            for i in range(0, len(chunk), per_line):
+                c_code.append("    " + ", ".join(chunk[i:i + per_line]) + ",")
+
+    c_code.append("// Split thresholds, ascending within each feature")
+    c_code.append("const float QS_THRESHOLDS[] = {")
+    append_by_feature(thresholds, 6)
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("// Tree owning each condition")
+    c_code.append("const uint16_t QS_TREE_IDS[] = {")
+    append_by_feature(tree_ids, 12)
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("// Leaves still reachable when the condition fails (x > threshold)")
+    c_code.append(f"const {mask_type} QS_MASKS[] = {{")
+    append_by_feature(masks, 4)
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("// Leaf classes, left to right, padded to max leaves per tree")
+    c_code.append("const uint8_t QS_LEAF_VALUES[] = {")
+    for values in qs['leaf_values']:
+        padded = values + [0] * (qs['max_leaves'] - len(values))
+        c_code.append("    " + ", ".join(str(v) for v in padded) + ",")
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("const QuickScorer SOLAR_QUICKSCORER = {")
+    c_code.append("    QS_FEATURE_OFFSETS,")
+    c_code.append("    QS_THRESHOLDS,")
+    c_code.append("    QS_TREE_IDS,")
+    c_code.append("    QS_MASKS,")
+    c_code.append("    QS_LEAF_VALUES,")
+    c_code.append(f"    {qs['max_leaves']},   // leaves_per_tree")
+    c_code.append(f"    {len(trees)},   // num_trees")
+    c_code.append(f"    {n_features},    // num_features")
+    c_code.append(f"    {len(class_names)},    // num_classes")
+    if raw_thresholds:
+        c_code.append("    NULL,   // scaler_mean: folded into thresholds")
+        c_code.append("    NULL,   // scaler_std")
+    else:
+        c_code.append("    QS_SCALER_MEAN,")
+        c_code.append("    QS_SCALER_STD,")
+    c_code.append("    QS_CLASS_NAMES,")
+    c_code.append("};")
+    c_code.extend(forest_limits_assert('SOLAR_QUICKSCORER', n_features, len(class_names)))
+
+    c_code.append("#endif // SOLAR_FAULT_MODEL_QUICKSCORER_H")
+
+    # Check against the flat trees on every dataset row
+    mismatches = 0
+    rows = load_model_inputs(scaler, raw_thresholds)
+    for x in rows:
+        expected = [walk_flat_tree(nodes, x) for nodes in trees]
+        if quickscorer_tree_classes(qs, x) != expected:
+            mismatches += 1
+    if mismatches:
+        raise ExportCheckError(f"QuickScorer: {mismatches} of {len(rows)} rows differ from the tree walk")
+
+    output_file = CONFIG['output_header_quickscorer']
+    with open(output_file, 'w') as f:
+        f.write('\n'.join(c_code) + '\n')
+
+    table_bytes = n_conditions * (4 + 2 + qs['mask_bits'] // 8) + len(trees) * qs['max_leaves']
+    print(f"✅ QuickScorer export complete: {output_file}")
+    print(f"   Conditions: {n_conditions}, mask width: {qs['mask_bits']} bits")
+    print(f"   Table size: {table_bytes} bytes")
+    print(f"✅ Matches the tree walk on all {len(rows)} dataset rows")
+
+    return qs
+
+
+# =============================================================================
+# C++17 CONSTEXPR EXPORT (forest_constexpr.h)
+# =============================================================================
+def flat_tree_depth(nodes, i=0):
+    """Depth of the subtree at nodes[i] (a single leaf has depth 0)."""
+    node = nodes[i]
+    if node['feature'] == FOREST_LEAF:
+        return 0
+    return 1 + max(flat_tree_depth(nodes, i + 1), flat_tree_depth(nodes, i + node['right']))
+
+
+def next_float32(value):
+    """Smallest float32 greater than value."""
+    return float32_from_key(float32_key(value) + 1)
+
+
+def export_constexpr(model, scaler, label_encoder, trees, raw_thresholds=False):
+    """
+    Export the forest as constexpr node data for forest_constexpr.h (C++17).
+
+    Each tree is instantiated from the table as a template and fully
+    unrolled by the compiler; the same table is also exposed as a Forest
+    for the table-driven runtime. static_asserts check the feature count,
+    class count and depth, and evaluate both paths at compile time on
+    probe inputs around every threshold against the classes computed here.
+    """
+
+    print("\n" + "=" * 70)
+    print("🔧 C++17 CONSTEXPR EXPORT")
+    print("=" * 70)
+
+    class_names = list(label_encoder.classes_)
+    feature_names = FEATURE_NAMES
+    n_features = len(feature_names)
+    n_classes = len(class_names)
+    roots = []
+    n_nodes = 0
+    for nodes in trees:
+        roots.append(n_nodes)
+        n_nodes += len(nodes)
+    depth = max(flat_tree_depth(nodes) for nodes in trees)
+
+    # Probe inputs in threshold units: the verify_export() cases, plus each
+    # split threshold and the next float32 above it, with the other features
+    # at their mean
+    means, stds = device_scaler(scaler)
+
+    def to_model_units(raw):
+        if raw_thresholds:
+            return [to_float32(v) for v in raw]
+        return [device_scale(to_float32(raw[i]), means[i], stds[i]) for i in range(n_features)]
+
+    probes = [to_model_units(feature_row(case)) for case in VERIFY_TEST_CASES]
+    base = means if raw_thresholds else [0.0] * n_features
+    for nodes in trees:
+        for node in nodes:
+            if node['feature'] == FOREST_LEAF:
+                continue
+            for value in (node['threshold'], next_float32(node['threshold'])):
+                x = list(base)
+                x[node['feature']] = value
+                probes.append(x)
+
+    expected = []
+    for x in probes:
+        votes = [0] * n_classes
+        for nodes in trees:
+            votes[walk_flat_tree(nodes, x)] += 1
+        expected.append(int(np.argmax(votes)))
+
+    forest_args = "CX_NODES, CX_ROOTS, CX_NUM_TREES, CX_NUM_CLASSES"
+    c_code = []
+
+    # Header comment
+    c_code.append("/*")
+    c_code.append(" * Solar Panel Fault Detection - Random Forest Model (C++17 constexpr)")
+    c_code.append(generated_line())
+    c_code.append(f" * Trees: {len(trees)}, Max Depth: {depth}, Nodes: {n_nodes}")
+    if raw_thresholds:
+        c_code.append(" * Thresholds: raw sensor units (StandardScaler folded in)")
+    c_code.append(" * ")
+    c_code.append(" * Classes:")
+    for i, name in enumerate(class_names):
+        c_code.append(f" *   {i}: {name}")
+    c_code.append(" * ")
+    c_code.append(" * Usage: int fault_type = cx_predict(features);        // unrolled trees")
+    c_code.append(" *        int fault_type = forest_predict(&SOLAR_FOREST_CX, features);  // table")
+    c_code.append(" */")
+    c_code.append("")
+
+    c_code.append("#ifndef SOLAR_FAULT_MODEL_CONSTEXPR_H")
+    c_code.append("#define SOLAR_FAULT_MODEL_CONSTEXPR_H")
+    c_code.append("")
+    c_code.append('#include "forest_constexpr.h"')
+    c_code.append("")
+
+    c_code.append(f"inline constexpr int CX_NUM_FEATURES = {n_features};")
+    c_code.append(f"inline constexpr int CX_NUM_CLASSES = {n_classes};")
+    c_code.append(f"inline constexpr int CX_NUM_TREES = {len(trees)};")
+    c_code.append(f"inline constexpr int CX_NUM_NODES = {n_nodes};")
+    c_code.append(f"inline constexpr int CX_MAX_DEPTH = {depth};")
+    c_code.append("")
+
+    c_code.append("// Fault type names")
+    c_code.append("inline constexpr const char* CX_CLASS_NAMES[] = {")
+    for name in class_names:
+        c_code.append(f'    "{name}",')
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("// Feature names (for debugging)")
+    c_code.append("inline constexpr const char* CX_FEATURE_NAMES[] = {")
+    for name in feature_names:
+        c_code.append(f'    "{name}",')
+    c_code.append("};")
+    c_code.append("")
+
+    if not raw_thresholds:
+        c_code.append("// StandardScaler parameters")
+        c_code.append("inline constexpr float CX_SCALER_MEAN[] = {")
+        c_code.append("    " + ", ".join([f"{m:.6f}f" for m in scaler.mean_]))
+        c_code.append("};")
+        c_code.append("")
+        c_code.append("inline constexpr float CX_SCALER_STD[] = {")
+        c_code.append("    " + ", ".join([f"{s:.6f}f" for s in scaler.scale_]))
+        c_code.append("};")
+        c_code.append("")
+
+    c_code.append("// Node table: { threshold, right, feature, value }")
+    c_code.append("inline constexpr ForestNode CX_NODES[] = {")
+    for tree_idx, nodes in enumerate(trees):
+        c_code.append(f"    // Tree {tree_idx}")
+        for node in nodes:
+            if node['feature'] == FOREST_LEAF:
+                c_code.append(f"    {{ 0.0f, 0, FOREST_LEAF, {node['value']} }},")
+            else:
+                c_code.append(f"    {{ {c_float(node['threshold'])}, {node['right']}, "
+                              f"{node['feature']}, 0 }},")
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("// Root node of each tree")
+    c_code.append("inline constexpr uint16_t CX_ROOTS[] = {")
+    c_code.append("    " + ", ".join(str(r) for r in roots))
+    c_code.append("};")
+    c_code.append("")
+
+    # Shape checks
+    c_code.append("static_assert(sizeof(CX_FEATURE_NAMES) / sizeof(CX_FEATURE_NAMES[0]) == CX_NUM_FEATURES,")
+    c_code.append('              "feature count does not match the feature names");')
+    c_code.append("static_assert(sizeof(CX_CLASS_NAMES) / sizeof(CX_CLASS_NAMES[0]) == CX_NUM_CLASSES,")
+    c_code.append('              "class count does not match the class names");')
+    c_code.append("static_assert(CX_NUM_FEATURES <= FOREST_MAX_FEATURES && CX_NUM_CLASSES <= FOREST_MAX_CLASSES,")
+    c_code.append('              "raise FOREST_MAX_FEATURES / FOREST_MAX_CLASSES");')
+    c_code.append("static_assert(sizeof(CX_NODES) / sizeof(CX_NODES[0]) == CX_NUM_NODES &&")
+    c_code.append("              sizeof(CX_ROOTS) / sizeof(CX_ROOTS[0]) == CX_NUM_TREES,")
+    c_code.append('              "node or tree count mismatch");')
+    c_code.append("static_assert(forest_cx_valid(CX_NODES, CX_NUM_NODES, CX_NUM_FEATURES, CX_NUM_CLASSES),")
+    c_code.append('              "node with an unknown feature, class or child offset");')
+    c_code.append("static_assert(forest_cx_max_depth(CX_NODES, CX_ROOTS, CX_NUM_TREES) == CX_MAX_DEPTH,")
+    c_code.append('              "tree depth does not match the export");')
+    c_code.append("")
+
+    # Compile-time parity
+    c_code.append(f"// Probe inputs ({'raw units' if raw_thresholds else 'scaled'}) and the class the exporter computed")
+    c_code.append(f"inline constexpr float CX_CHECK_INPUTS[][{n_features}] = {{")
+    for x in probes:
+        c_code.append("    { " + ", ".join(c_float(v) for v in x) + " },")
+    c_code.append("};")
+    c_code.append("")
+    c_code.append("inline constexpr uint8_t CX_CHECK_CLASSES[] = {")
+    for i in range(0, len(expected), 24):
+        c_code.append("    " + ", ".join(str(c) for c in expected[i:i + 24]) + ",")
+    c_code.append("};")
+    c_code.append("")
+    c_code.append("// Unrolled trees and table walk must both give the exported class")
+    c_code.append("constexpr bool cx_checks_pass() {")
+    c_code.append("    for (size_t i = 0; i < sizeof(CX_CHECK_CLASSES); i++) {")
+    c_code.append(f"        int unrolled = forest_cx_predict<{forest_args}>(CX_CHECK_INPUTS[i]);")
+    c_code.append(f"        int table = forest_cx_table_predict({forest_args}, CX_CHECK_INPUTS[i]);")
+    c_code.append("        if (unrolled != CX_CHECK_CLASSES[i] || table != CX_CHECK_CLASSES[i]) {")
+    c_code.append("            return false;")
+    c_code.append("        }")
+    c_code.append("    }")
+    c_code.append("    return true;")
+    c_code.append("}")
+    c_code.append('static_assert(cx_checks_pass(), "unrolled trees, table walk and exporter disagree");')
+    c_code.append("")
+
+    # Runtime entry points
+    c_code.append("// Main prediction function (unrolled trees) - returns class index")
+    c_code.append("inline int cx_predict(const float* raw_features) {")
+    if raw_thresholds:
+        c_code.append(f"    return forest_cx_predict<{forest_args}>(raw_features);")
+    else:
+        c_code.append("    float scaled[CX_NUM_FEATURES];")
+        c_code.append("    for (int i = 0; i < CX_NUM_FEATURES; i++) {")
+        c_code.append("        scaled[i] = (raw_features[i] - CX_SCALER_MEAN[i]) / CX_SCALER_STD[i];")
+        c_code.append("    }")
+        c_code.append(f"    return forest_cx_predict<{forest_args}>(scaled);")
+    c_code.append("}")
+    c_code.append("")
+
+    c_code.append("// The same data for the table-driven forest_predict()")
+    c_code.append("inline constexpr Forest SOLAR_FOREST_CX = {")
+    c_code.append("    CX_NODES,")
+    c_code.append("    CX_ROOTS,")
+    c_code.append("    CX_NUM_TREES,")
+    c_code.append("    CX_NUM_FEATURES,")
+    c_code.append("    CX_NUM_CLASSES,")
+    if raw_thresholds:
+        c_code.append("    nullptr,   // scaler_mean: folded into thresholds")
+        c_code.append("    nullptr,   // scaler_std")
+    else:
+        c_code.append("    CX_SCALER_MEAN,")
+        c_code.append("    CX_SCALER_STD,")
+    c_code.append("    CX_CLASS_NAMES,")
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("#endif // SOLAR_FAULT_MODEL_CONSTEXPR_H")
+
+    output_file = CONFIG['output_header_constexpr']
+    with open(output_file, 'w') as f:
+        f.write('\n'.join(c_code) + '\n')
+
+    print(f"✅ Constexpr export complete: {output_file}")
+    print(f"   Nodes: {n_nodes}, compile-time checks: {len(probes)}")
+    print(f"   File size: {os.path.getsize(output_file)} bytes")
+
+    return output_file
+
+
+# =============================================================================
+# DENSE LOOKUP TABLE EXPORT (forest_lut.h)
+# =============================================================================
+def lut_thresholds(trees, n_features):
+    """Distinct split thresholds of each feature over all trees, ascending."""
+    return [sorted({node['threshold'] for nodes in trees for node in nodes
+                    if node['feature'] == f})
+            for f in range(n_features)]
+
+
+def lut_bin(thresholds, x):
+    """Python mirror of forest_lut_bin()."""
+    return len(thresholds) if x != x else bisect.bisect_left(thresholds, x)
+
+
+def build_lut(trees, weights, thresholds, n_classes):
+    """
+    Forest class of every box, feature 0 most significant.
+
+    Bin b of a feature holds thresholds[b - 1] < x <= thresholds[b], so
+    thresholds[b] itself (or the next float32 above the last threshold)
+    reaches the same leaf in every tree as any other value in the bin.
+    """
+    samples = [list(t) + [next_float32(t[-1]) if t else 0.0] for t in thresholds]
+    classes = []
+    for x in itertools.product(*samples):
+        votes = [0] * n_classes
+        for nodes, w in zip(trees, weights):
+            votes[walk_flat_tree(nodes, x)] += w
+        classes.append(votes.index(max(votes)))
+    return classes
+
+
+def measure_code_size(header, call, cxx=None):
+    """
+    Flash bytes (code + constants) that `call` pulls in from `header`,
+    measured by linking it with --gc-sections against an empty baseline.
+    Returns None when the compiler (CONFIG['size_compiler'] unless `cxx`
+    is given) is not available.
+    """
+    cxx = cxx or CONFIG['size_compiler']
+    size_tool = cxx[:-len('g++')] + 'size' if cxx.endswith('g++') else 'size'
+    flags = ['-Os', '-std=c++11', '-nostdlib', '-static', '-fno-exceptions',
+             '-fno-asynchronous-unwind-tables', '-ffunction-sections', '-fdata-sections',
+             '-Wl,--gc-sections', '-Wl,-e,size_probe', '-I', os.path.dirname(header), '-I', MODELS_DIR]
+    sources = {
+        'probe': f'#include "{os.path.basename(header)}"\n'
+                 f'extern "C" int size_probe(float* x) {{ return {call}; }}\n',
+        'empty': 'extern "C" int size_probe(float* x) { return 0; }\n',
+    }
+
+    text = {}
+    try:
+        with tempfile.TemporaryDirectory() as tmp:
+            for name, source in sources.items():
+                src = os.path.join(tmp, name + '.cpp')
+                elf = os.path.join(tmp, name + '.elf')
+                with open(src, 'w') as f:
+                    f.write(source)
+                subprocess.run([cxx] + flags + [src, '-o', elf], check=True, capture_output=True)
+                out = subprocess.run([size_tool, elf], check=True, capture_output=True, text=True)
+                text[name] = int(out.stdout.splitlines()[1].split()[0])
+    except (OSError, subprocess.CalledProcessError):
+        return None
+    return text['probe'] - text['empty']
+
+
+def export_lut(model, scaler, label_encoder, trees, weights, raw_thresholds=False):
+    """
+    Export the whole forest as one dense class table for forest_lut.h.
+
+    With 4 features and a few dozen distinct thresholds the forest only
+    ever sees a few thousand different boxes, so the exporter votes once
+    per box and the device only finds 4 bins and does one load. When the
+    table would exceed CONFIG['lut_max_bytes'], the backend is unavailable:
+    model_lut.h only defines LUT_AVAILABLE 0 and has no lut_predict(), so
+    code that needs the table fails to build instead of silently getting
+    another backend.
+    """
+
+    print("\n" + "=" * 70)
+    print("🔧 DENSE LOOKUP TABLE EXPORT")
+    print("=" * 70)
+
+    class_names = list(label_encoder.classes_)
+    n_features = len(scaler.mean_)
+    thresholds = lut_thresholds(trees, n_features)
+    bins = [len(t) + 1 for t in thresholds]
+    n_cells = 1
+    for b in bins:
+        n_cells *= b
+    n_thresholds = sum(len(t) for t in thresholds)
+    lut_bytes = n_cells + 4 * n_thresholds
+    available = n_cells <= CONFIG['lut_max_bytes']
+
+    strides = []
+    stride = 1
+    for b in reversed(bins):
+        strides.insert(0, stride)
+        stride *= b
+
+    c_code = []
+
+    # Header comment
+    c_code.append("/*")
+    c_code.append(" * Solar Panel Fault Detection - Random Forest Model (dense lookup table)")
+    c_code.append(generated_line())
+    c_code.append(f" * Trees: {sum(weights)}, Bins per feature: {' x '.join(str(b) for b in bins)} "
+                  f"= {n_cells} boxes")
+    if raw_thresholds:
+        c_code.append(" * Thresholds: raw sensor units (StandardScaler folded in)")
+    if available:
+        c_code.append(" * ")
+        c_code.append(" * Classes:")
+        for i, name in enumerate(class_names):
+            c_code.append(f" *   {i}: {name}")
+        c_code.append(" * ")
+        c_code.append(" * Usage: int fault_type = lut_predict(features);")
+    else:
+        c_code.append(f" * Not available: the table needs {n_cells} bytes "
+                      f"(lut_max_bytes is {CONFIG['lut_max_bytes']}).")
+        c_code.append(" * There is no lut_predict(); use model_table.h or model_manual.h.")
+    c_code.append(" */")
+    c_code.append("")
+
+    c_code.append("#ifndef SOLAR_FAULT_MODEL_LUT_H")
+    c_code.append("#define SOLAR_FAULT_MODEL_LUT_H")
+    c_code.append("")
+
+    if not available:
+        c_code.append("#define LUT_AVAILABLE 0")
+        c_code.append("")
+    else:
+        classes = build_lut(trees, weights, thresholds, len(class_names))
+
+        c_code.append('#include "forest_lut.h"')
+        c_code.append("")
+        c_code.append("#define LUT_AVAILABLE 1")
+        c_code.append("")
+        c_code.append("// Fault type names")
+        c_code.append("const char* const LUT_CLASS_NAMES[] = {")
+        for name in class_names:
+            c_code.append(f'    "{name}",')
+        c_code.append("};")
+        c_code.append("")
+
+        if not raw_thresholds:
+            c_code.append("// StandardScaler parameters")
+            c_code.append("const float LUT_SCALER_MEAN[] = {")
+            c_code.append("    " + ", ".join([f"{m:.6f}f" for m in scaler.mean_]))
+            c_code.append("};")
+            c_code.append("")
+            c_code.append("const float LUT_SCALER_STD[] = {")
+            c_code.append("    " + ", ".join([f"{s:.6f}f" for s in scaler.scale_]))
+            c_code.append("};")
+            c_code.append("")
+
+        c_code.append("// Bin edges of each feature, ascending")
+        c_code.append("const float LUT_THRESHOLDS[] = {")
+        for f, values in enumerate(thresholds):
+            if values:
+                c_code.append(f"    // Feature {f}: {len(values)} thresholds")
+                c_code.append("    " + ", ".join(c_float(t) for t in values) + ",")
+        c_code.append("};")
+        c_code.append("")
+
+        offsets = [0]
+        for values in thresholds:
+            offsets.append(offsets[-1] + len(values))
+        c_code.append("const uint16_t LUT_FEATURE_OFFSETS[] = {")
+        c_code.append("    " + ", ".join(str(o) for o in offsets))
+        c_code.append("};")
+        c_code.append("")
+
+        c_code.append("const uint32_t LUT_STRIDES[] = {")
+        c_code.append("    " + ", ".join(str(st) for st in strides))
+        c_code.append("};")
+        c_code.append("")
+
+        c_code.append(f"// Forest class of each box ({n_cells} bytes)")
+        c_code.append("const uint8_t LUT_CLASSES[] = {")
+        # One line per bin combination of all but the last two features
+        row = strides[-3] if n_features > 2 else n_cells
+        for i in range(0, n_cells, row):
+            c_code.append("    " + ", ".join(str(c) for c in classes[i:i + row]) + ",")
+        c_code.append("};")
+        c_code.append("")
+
+        c_code.append("const ForestLut SOLAR_LUT = {")
+        c_code.append("    LUT_THRESHOLDS,")
+        c_code.append("    LUT_FEATURE_OFFSETS,")
+        c_code.append("    LUT_STRIDES,")
+        c_code.append("    LUT_CLASSES,")
+        c_code.append(f"    {n_features},    // num_features")
+        c_code.append(f"    {len(class_names)},    // num_classes")
+        if raw_thresholds:
+            c_code.append("    NULL,   // scaler_mean: folded into thresholds")
+            c_code.append("    NULL,   // scaler_std")
+        else:
+            c_code.append("    LUT_SCALER_MEAN,")
+            c_code.append("    LUT_SCALER_STD,")
+        c_code.append("    LUT_CLASS_NAMES,")
+        c_code.append("};")
+        c_code.extend(forest_limits_assert('SOLAR_LUT', n_features, len(class_names)))
+
+        c_code.append("// Main prediction function - returns class index")
+        c_code.append("inline int lut_predict(const float* raw_features) {")
+        c_code.append("    return forest_lut_predict(&SOLAR_LUT, raw_features);")
+        c_code.append("}")
+        c_code.append("")
+
+    c_code.append("#endif // SOLAR_FAULT_MODEL_LUT_H")
+
+    if available:
+        # Same class as the weighted vote on every row and every box
+        rows = load_model_inputs(scaler, raw_thresholds)
+        samples = [list(t) + [next_float32(t[-1]) if t else 0.0, float('nan')] for t in thresholds]
+        probes = list(rows) + [list(x) for x in itertools.product(*samples)]
+        mismatches = 0
+        for x in probes:
+            votes = [0] * len(class_names)
+            for nodes, w in zip(trees, weights):
+                votes[walk_flat_tree(nodes, x)] += w
+            index = sum(lut_bin(t, v) * st for t, v, st in zip(thresholds, x, strides))
+            mismatches += classes[index] != votes.index(max(votes))
+        if mismatches:
+            raise ExportCheckError(f"Dense table differs from the forest on {mismatches} of "
+                                   f"{len(probes)} inputs")
+
+    output_file = CONFIG['output_header_lut']
+    with open(output_file, 'w') as f:
+        f.write('\n'.join(c_code) + '\n')
+
+    if not available:
+        print(f"⚠️  Dense table needs {n_cells} bytes (limit {CONFIG['lut_max_bytes']}): "
+              f"dense lut unavailable, {output_file} has no lut_predict()")
+        return output_file
+    print(f"✅ Dense table export complete: {output_file}")
+    print(f"   Boxes: {' x '.join(str(b) for b in bins)} = {n_cells} "
+          f"({lut_bytes} bytes with {n_thresholds} thresholds)")
+    print(f"✅ Table matches the forest on {len(probes)} inputs "
+          f"({len(rows)} dataset rows + every box and NaN)")
+
+    # Flash cost against the if/else trees
+    manual_size = measure_code_size(CONFIG['output_header_manual'], 'predict(x)')
+    lut_size = measure_code_size(output_file, 'lut_predict(x)')
+    if manual_size is None or lut_size is None:
+        print(f"   Code size not measured ({CONFIG['size_compiler']} not available)")
+    else:
+        print(f"   Flash ({CONFIG['size_compiler']} -Os, code + tables): "
+              f"lut_predict() {lut_size} bytes vs model_manual.h predict() {manual_size} bytes")
+
+    return output_file
+
+
+# =============================================================================
+# SOFT VOTING EXPORT (forest_soft.h)
+# =============================================================================
+def quantize_proba(proba, scale):
+    """
+    Round a leaf distribution to integers that sum to exactly `scale`
+    (largest remainder), so every tree adds the same total weight.
+    """
+    scaled = [p * scale for p in proba]
+    quantized = [int(v) for v in scaled]
+    order = sorted(range(len(proba)), key=lambda c: (quantized[c] - scaled[c], c))
+    for c in order[:scale - sum(quantized)]:
+        quantized[c] += 1
+    return quantized
+
+
+def export_soft(model, scaler, label_encoder, trees, raw_thresholds=False):
+    """
+    Export the forest with quantized leaf distributions for forest_soft.h.
+
+    sklearn averages the leaf distributions of its trees, while predict()
+    counts one hard vote per tree, so the two can disagree near class
+    boundaries. Each distinct distribution is stored once as
+    CONFIG['soft_vote_bits'] integers summing to the scale, and leaves
+    point at their row. The report compares the integer soft vote and the
+    hard vote with the joblib model on every dataset row.
+
+    `trees` must not be compacted: compact_tree() merges leaves by class
+    and would drop their distributions.
+    """
+
+    print("\n" + "=" * 70)
+    print("🔧 SOFT VOTING EXPORT")
+    print("=" * 70)
+
+    class_names = list(label_encoder.classes_)
+    n_classes = len(class_names)
+    bits = CONFIG['soft_vote_bits']
+    scale = (1 << bits) - 1
+    proba_type = 'uint16_t' if bits == 16 else 'uint8_t'
+
+    # One row per distinct quantized distribution
+    rows, row_index = [], {}
+    soft_trees = []
+    for nodes in trees:
+        soft_nodes = []
+        for node in nodes:
+            node = dict(node)
+            if node['feature'] == FOREST_LEAF:
+                row = tuple(quantize_proba(node['proba'], scale))
+                if row not in row_index:
+                    row_index[row] = len(rows)
+                    rows.append(row)
+                node['right'] = row_index[row]
+            soft_nodes.append(node)
+        soft_trees.append(soft_nodes)
+
+    roots = []
+    n_nodes = 0
+    for nodes in soft_trees:
+        roots.append(n_nodes)
+        n_nodes += len(nodes)
+    proba_bytes = len(rows) * n_classes * bits // 8
+
+    c_code = []
+
+    # Header comment
+    c_code.append("/*")
+    c_code.append(" * Solar Panel Fault Detection - Random Forest Model (soft voting)")
+    c_code.append(generated_line())
+    c_code.append(f" * Trees: {len(soft_trees)}, Nodes: {n_nodes} ({n_nodes * 8} bytes), "
+                  f"Leaf distributions: {len(rows)} x {bits}-bit ({proba_bytes} bytes)")
+    if raw_thresholds:
+        c_code.append(" * Thresholds: raw sensor units (StandardScaler folded in)")
+    c_code.append(" * ")
+    c_code.append(" * Classes:")
+    for i, name in enumerate(class_names):
+        c_code.append(f" *   {i}: {name}")
+    c_code.append(" * ")
+    c_code.append(" * Usage: uint32_t acc[SOFT_NUM_CLASSES];")
+    c_code.append(" *        int fault_type = soft_forest_predict_proba(&SOLAR_SOFT_FOREST, features, acc);")
+    c_code.append(" *        // P(class c) = acc[c] / soft_forest_total(&SOLAR_SOFT_FOREST)")
+    c_code.append(" */")
+    c_code.append("")
+
+    c_code.append("#ifndef SOLAR_FAULT_MODEL_SOFT_H")
+    c_code.append("#define SOLAR_FAULT_MODEL_SOFT_H")
+    c_code.append("")
+    c_code.append(f"#define FOREST_SOFT_BITS {bits}")
+    c_code.append('#include "forest_soft.h"')
+    c_code.append("")
+    c_code.append(f"#define SOFT_NUM_CLASSES {n_classes}")
+    c_code.append("")
+
+    c_code.append("// Fault type names")
+    c_code.append("const char* const SOFT_CLASS_NAMES[] = {")
+    for name in class_names:
+        c_code.append(f'    "{name}",')
+    c_code.append("};")
+    c_code.append("")
+
+    if not raw_thresholds:
+        c_code.append("// StandardScaler parameters")
+        c_code.append("const float SOFT_SCALER_MEAN[] = {")
+        c_code.append("    " + ", ".join([f"{m:.6f}f" for m in scaler.mean_]))
+        c_code.append("};")
+        c_code.append("")
+        c_code.append("const float SOFT_SCALER_STD[] = {")
+        c_code.append("    " + ", ".join([f"{s:.6f}f" for s in scaler.scale_]))
+        c_code.append("};")
+        c_code.append("")
+
+    c_code.append("// Node table: { threshold, right (leaves: distribution row), feature, value }")
+    c_code.append("const ForestNode SOFT_NODES[] = {")
+    for tree_idx, nodes in enumerate(soft_trees):
+        c_code.append(f"    // Tree {tree_idx}")
+        for node in nodes:
+            if node['feature'] == FOREST_LEAF:
+                c_code.append(f"    {{ 0.0f, {node['right']}, FOREST_LEAF, {node['value']} }},")
+            else:
+                c_code.append(f"    {{ {c_float(node['threshold'])}, {node['right']}, "
+                              f"{node['feature']}, 0 }},")
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("// Root node of each tree")
+    c_code.append("const uint16_t SOFT_ROOTS[] = {")
+    c_code.append("    " + ", ".join(str(r) for r in roots))
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append(f"// Leaf class distributions, each row sums to {scale}")
+    c_code.append(f"const {proba_type} SOFT_LEAF_PROBA[] = {{")
+    for row in rows:
+        c_code.append("    " + ", ".join(str(v) for v in row) + ",")
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("const SoftForest SOLAR_SOFT_FOREST = {")
+    c_code.append("    {")
+    c_code.append("        SOFT_NODES,")
+    c_code.append("        SOFT_ROOTS,")
+    c_code.append(f"        {len(soft_trees)},   // num_trees")
+    c_code.append(f"        {len(scaler.mean_)},    // num_features")
+    c_code.append(f"        {n_classes},    // num_classes")
+    if raw_thresholds:
+        c_code.append("        NULL,   // scaler_mean: folded into thresholds")
+        c_code.append("        NULL,   // scaler_std")
+    else:
+        c_code.append("        SOFT_SCALER_MEAN,")
+        c_code.append("        SOFT_SCALER_STD,")
+    c_code.append("        SOFT_CLASS_NAMES,")
+    c_code.append("    },")
+    c_code.append("    SOFT_LEAF_PROBA,")
+    c_code.append(f"    {scale},   // proba_scale")
+    c_code.append("};")
+    c_code.extend(forest_limits_assert('SOLAR_SOFT_FOREST', len(scaler.mean_), n_classes))
+
+    c_code.append("#endif // SOLAR_FAULT_MODEL_SOFT_H")
+
+    output_file = CONFIG['output_header_soft']
+    with open(output_file, 'w') as f:
+        f.write('\n'.join(c_code) + '\n')
+
+    print(f"✅ Soft voting export complete: {output_file}")
+    print(f"   Leaf distributions: {len(rows)} distinct rows x {bits}-bit ({proba_bytes} bytes)")
+    if all(max(row) == scale for row in rows):
+        print("⚠️  Every leaf is pure (one class only): soft voting gives the same "
+              "classes as hard voting for this model")
+
+    # Disagreement with the joblib model on every dataset row
+    scaled_rows = load_scaled_rows(scaler)
+    inputs = load_model_inputs(scaler, raw_thresholds)
+    total = len(soft_trees) * scale
+    soft_mismatches = hard_mismatches = 0
+    max_error = 0.0
+    for x, x_model in zip(scaled_rows, inputs):
+        proba = sklearn_proba(model, x)
+        expected = int(np.argmax(proba))
+
+        acc = [0] * n_classes
+        for nodes in soft_trees:
+            for c, v in enumerate(rows[flat_tree_leaf(nodes, x_model)['right']]):
+                acc[c] += v
+        soft_mismatches += acc.index(max(acc)) != expected
+        hard_mismatches += sklearn_vote(model, x) != expected
+        max_error = max(max_error, max(abs(a / total - p) for a, p in zip(acc, proba)))
+
+    n = len(scaled_rows)
+    print(f"   Disagreement with model.predict() on {n} dataset rows:")
+    for label, mismatches in ((f"soft vote ({bits}-bit integers)", soft_mismatches),
+                              ("hard vote (predict())", hard_mismatches)):
+        print(f"     {label + ':':30} {mismatches} ({100.0 * mismatches / n:.3f}%)")
+    print(f"   Max |predict_proba error|: {max_error:.6f} (quantization step {1.0 / scale:.6f})")
+
+    return output_file
+
+
+# =============================================================================
+# COMPACT LARGE-FOREST EXPORT (forest_compact.h)
+# =============================================================================
+COMPACT_LEAF = 0xF000
+
+
+def compact_forest_bin(thresholds, x):
+    """Python mirror of compact_forest_bin()."""
+    return len(thresholds) if x != x else bisect.bisect_left(thresholds, x)
+
+
+def encode_compact(trees, n_features, n_classes):
+    """
+    Encode flat trees as 4-byte (key, right) pairs for forest_compact.h.
+
+    Returns (nodes, roots, thresholds per feature). Raises ValueError when
+    the forest does not fit the encoding: at most 15 features, 4095
+    thresholds per feature, 4095 classes and 65535 nodes per left subtree.
+    """
+    thresholds = lut_thresholds(trees, n_features)
+    index = [{t: k for k, t in enumerate(values)} for values in thresholds]
+    if n_features > 15 or n_classes > 0x0FFF:
+        raise ValueError(f"{n_features} features / {n_classes} classes do not fit the compact encoding")
+    for f, values in enumerate(thresholds):
+        if len(values) > 0x0FFF:
+            raise ValueError(f"feature {f} has {len(values)} distinct thresholds (max 4095)")
+
+    nodes, roots = [], []
+    for tree in trees:
+        roots.append(len(nodes))
+        for node in tree:
+            if node['feature'] == FOREST_LEAF:
+                nodes.append((COMPACT_LEAF | node['value'], 0))
+            else:
+                if node['right'] > 0xFFFF:
+                    raise ValueError("subtree too large for a 16-bit right offset")
+                f = node['feature']
+                nodes.append(((f << 12) | index[f][node['threshold']], node['right']))
+    return nodes, roots, thresholds
+
+
+def walk_compact_tree(nodes, root, bins):
+    """Python mirror of compact_tree_predict()."""
+    i = root
+    while nodes[i][0] & COMPACT_LEAF != COMPACT_LEAF:
+        key, right = nodes[i]
+        i += 1 if bins[key >> 12] <= key & 0x0FFF else right
+    return nodes[i][0] & 0x0FFF
+
+
+def export_compact(model, scaler, label_encoder, trees, raw_thresholds=False):
+    """
+    Export the forest with 4-byte nodes for forest_compact.h.
+
+    This is the path for forests far beyond 10 trees of depth 5: votes are
+    counted in uint16_t (micromlgen's uint8_t wraps past 255 trees), the
+    class count only sets FOREST_COMPACT_MAX_CLASSES, and every node
+    takes half the flash of a ForestNode because splits store a threshold
+    index instead of the float.
+    """
+
+    print("\n" + "=" * 70)
+    print("🔧 COMPACT FOREST EXPORT")
+    print("=" * 70)
+
+    class_names = list(label_encoder.classes_)
+    n_features = len(scaler.mean_)
+    n_classes = len(class_names)
+    nodes, roots, thresholds = encode_compact(trees, n_features, n_classes)
+    n_thresholds = sum(len(values) for values in thresholds)
+    compact_bytes = 4 * len(nodes) + 4 * n_thresholds + 4 * len(roots)
+    flat_bytes = 8 * len(nodes) + 2 * len(roots)
+
+    c_code = []
+
+    # Header comment
+    c_code.append("/*")
+    c_code.append(" * Solar Panel Fault Detection - Random Forest Model (compact nodes)")
+    c_code.append(generated_line())
+    c_code.append(f" * Trees: {len(trees)}, Max Depth: {max(flat_tree_depth(t) for t in trees)}, "
+                  f"Nodes: {len(nodes)}, Thresholds: {n_thresholds} ({compact_bytes} bytes)")
+    if raw_thresholds:
+        c_code.append(" * Thresholds: raw sensor units (StandardScaler folded in)")
+    c_code.append(" * ")
+    c_code.append(" * Classes:")
+    for i, name in enumerate(class_names):
+        c_code.append(f" *   {i}: {name}")
+    c_code.append(" * ")
+    c_code.append(" * Usage: int fault_type = compact_forest_predict(&SOLAR_COMPACT_FOREST, features);")
+    c_code.append(" */")
+    c_code.append("")
+
+    c_code.append("#ifndef SOLAR_FAULT_MODEL_COMPACT_H")
+    c_code.append("#define SOLAR_FAULT_MODEL_COMPACT_H")
+    c_code.append("")
+    c_code.append(f"#define FOREST_COMPACT_MAX_FEATURES {n_features}")
+    c_code.append(f"#define FOREST_COMPACT_MAX_CLASSES {n_classes}")
+    c_code.append('#include "forest_compact.h"')
+    c_code.append("")
+
+    c_code.append("// Fault type names")
+    c_code.append("const char* const COMPACT_CLASS_NAMES[] = {")
+    for name in class_names:
+        c_code.append(f'    "{name}",')
+    c_code.append("};")
+    c_code.append("")
+
+    if not raw_thresholds:
+        c_code.append("// StandardScaler parameters")
+        c_code.append("const float COMPACT_SCALER_MEAN[] = {")
+        c_code.append("    " + ", ".join([f"{m:.6f}f" for m in scaler.mean_]))
+        c_code.append("};")
+        c_code.append("")
+        c_code.append("const float COMPACT_SCALER_STD[] = {")
+        c_code.append("    " + ", ".join([f"{s:.6f}f" for s in scaler.scale_]))
+        c_code.append("};")
+        c_code.append("")
+
+    c_code.append("// Split thresholds of each feature, ascending")
+    c_code.append("const float COMPACT_THRESHOLDS[] = {")
+    for f, values in enumerate(thresholds):
+        if values:
+            c_code.append(f"    // Feature {f}: {len(values)} thresholds")
+            for i in range(0, len(values), 8):
+                c_code.append("    " + ", ".join(c_float(t) for t in values[i:i + 8]) + ",")
+    c_code.append("};")
+    c_code.append("")
+
+    offsets = [0]
+    for values in thresholds:
+        offsets.append(offsets[-1] + len(values))
+    c_code.append("const uint16_t COMPACT_FEATURE_OFFSETS[] = {")
+    c_code.append("    " + ", ".join(str(o) for o in offsets))
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("// Node table: { feature << 12 | threshold index (leaves: FOREST_COMPACT_LEAF | class), right }")
+    c_code.append("const ForestCompactNode COMPACT_NODES[] = {")
+    for tree_idx, root in enumerate(roots):
+        c_code.append(f"    // Tree {tree_idx}")
+        end = roots[tree_idx + 1] if tree_idx + 1 < len(roots) else len(nodes)
+        for key, right in nodes[root:end]:
+            if key & COMPACT_LEAF == COMPACT_LEAF:
+                c_code.append(f"    {{ FOREST_COMPACT_LEAF | {key & 0x0FFF}, 0 }},")
+            else:
+                c_code.append(f"    {{ 0x{key:04X}, {right} }},")
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("// Root node of each tree")
+    c_code.append("const uint32_t COMPACT_ROOTS[] = {")
+    for i in range(0, len(roots), 16):
+        c_code.append("    " + ", ".join(str(r) for r in roots[i:i + 16]) + ",")
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("const CompactForest SOLAR_COMPACT_FOREST = {")
+    c_code.append("    COMPACT_NODES,")
+    c_code.append("    COMPACT_ROOTS,")
+    c_code.append("    COMPACT_THRESHOLDS,")
+    c_code.append("    COMPACT_FEATURE_OFFSETS,")
+    c_code.append(f"    {len(trees)},   // num_trees")
+    c_code.append(f"    {n_features},    // num_features")
+    c_code.append(f"    {n_classes},    // num_classes")
+    if raw_thresholds:
+        c_code.append("    NULL,   // scaler_mean: folded into thresholds")
+        c_code.append("    NULL,   // scaler_std")
+    else:
+        c_code.append("    COMPACT_SCALER_MEAN,")
+        c_code.append("    COMPACT_SCALER_STD,")
+    c_code.append("    COMPACT_CLASS_NAMES,")
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("#endif // SOLAR_FAULT_MODEL_COMPACT_H")
+
+    # Same leaf as the flat trees for every tree and dataset row
+    rows = load_model_inputs(scaler, raw_thresholds)
+    mismatches = 0
+    for x in rows:
+        bins = [compact_forest_bin(values, v) for values, v in zip(thresholds, x)]
+        for tree, root in zip(trees, roots):
+            mismatches += walk_compact_tree(nodes, root, bins) != walk_flat_tree(tree, x)
+    if mismatches:
+        raise ExportCheckError(f"{mismatches} compact leaf decisions differ from the flat trees")
+
+    output_file = CONFIG['output_header_compact']
+    with open(output_file, 'w') as f:
+        f.write('\n'.join(c_code) + '\n')
+
+    print(f"✅ Compact export complete: {output_file}")
+    print(f"   Nodes: {len(nodes)} x 4 bytes + {n_thresholds} thresholds = {compact_bytes} bytes "
+          f"(flat table: {flat_bytes} bytes)")
+    print(f"✅ {len(rows)} rows x {len(trees)} trees: compact leaves match the flat trees")
+
+    return output_file
+
+
+# =============================================================================
+# INTEGER ARDUINO NANO EXPORT (forest_nano.h)
+# =============================================================================
+NANO_READING_MAX = 0xFFFF
+
+
+def nano_lsb():
+    """
+    Physical value of one Nano reading unit for each feature, as float32;
+    None for a feature the Nano neither measures nor derives.
+    """
+    adc = CONFIG['nano_adc']
+    lsb = []
+    for name in FEATURE_NAMES:
+        if name in adc['units_per_volt']:
+            lsb.append(to_float32(adc['vref'] / adc['adc_max'] / adc['scale'] *
+                                  adc['units_per_volt'][name]))
+        elif name == 'Efficiency':
+            lsb.append(to_float32(1.0 / adc['efficiency_steps']))
+        else:
+            lsb.append(None)
+    return lsb
+
+
+def nano_efficiency_factor(lsb):
+    """
+    Fixed-point factor of nano_efficiency(): the efficiency reading is
+    voltage * current * factor / (light << 16) in readings, which is
+    panel_efficiency() with every unit folded into one integer.
+    """
+    index = {name: i for i, name in enumerate(FEATURE_NAMES)}
+    ratio = (lsb[index['Voltage']] * lsb[index['Current']] /
+             (lsb[index['Light_Intensity']] * EFFICIENCY_SCALE * lsb[index['Efficiency']]))
+    return int(round(ratio * 65536))
+
+
+def nano_efficiency(readings, factor):
+    """Python mirror of nano_efficiency_reading() in model_nano.h."""
+    index = {name: i for i, name in enumerate(FEATURE_NAMES)}
+    light = readings[index['Light_Intensity']]
+    if light == 0:
+        return 0
+    efficiency = readings[index['Voltage']] * readings[index['Current']] * factor // (light << 16)
+    return min(efficiency, int(EFFICIENCY_MAX * CONFIG['nano_adc']['efficiency_steps']))
+
+
+def nano_value(q, lsb):
+    """What the float model sees for reading q: q * lsb in float32."""
+    return to_float32(q * lsb)
+
+
+def nano_threshold(threshold, value):
+    """
+    Largest reading q with value(q) <= threshold, None when even 0 goes right.
+
+    value() is monotonic, so `q <= result` makes the same decision as the
+    float split for every uint16_t reading.
+    """
+    if value(0) > threshold:
+        return None
+    lo, hi = 0, NANO_READING_MAX + 1
+    while hi - lo > 1:
+        mid = (lo + hi) // 2
+        if value(mid) <= threshold:
+            lo = mid
+        else:
+            hi = mid
+
+    assert value(lo) <= threshold
+    assert lo == NANO_READING_MAX or value(lo + 1) > threshold
+    return lo
+
+
+def encode_nano(trees, values):
+    """
+    Flat trees -> (nodes, roots) for forest_nano.h, nodes as
+    (threshold, feature, right) with leaves (class, FOREST_LEAF, 0).
+
+    Splits that every reading passes the same way are replaced by the
+    child it always reaches.
+    """
+    nodes, roots = [], []
+
+    def emit(tree, i):
+        node = tree[i]
+        if node['feature'] == FOREST_LEAF:
+            nodes.append((node['value'], FOREST_LEAF, 0))
+            return
+        f = node['feature']
+        t = nano_threshold(node['threshold'], values[f])
+        if t is None:
+            emit(tree, i + node['right'])
+            return
+        if t == NANO_READING_MAX:
+            emit(tree, i + 1)
+            return
+        at = len(nodes)
+        nodes.append(None)
+        emit(tree, i + 1)
+        right = len(nodes) - at
+        if right > 0xFF:
+            raise ValueError(f"Left subtree of {right - 1} nodes does not fit NanoNode::right")
+        nodes[at] = (t, f, right)
+        emit(tree, i + node['right'])
+
+    for tree in trees:
+        roots.append(len(nodes))
+        emit(tree, 0)
+    return nodes, roots
+
+
+def walk_nano_tree(nodes, root, readings):
+    """Python mirror of nano_tree_predict()."""
+    i = root
+    while nodes[i][1] != FOREST_LEAF:
+        threshold, feature, right = nodes[i]
+        i += 1 if readings[feature] <= threshold else right
+    return nodes[i][0]
+
+
+def nano_readings(raw, lsb):
+    """Raw sensor values -> nearest uint16_t Nano readings."""
+    return [min(NANO_READING_MAX, max(0, int(round(x / unit)))) for x, unit in zip(raw, lsb)]
+
+
+def export_nano(model, scaler, label_encoder, trees, raw_thresholds=False):
+    """
+    Export an integer-only forest for the Arduino Nano (forest_nano.h).
+
+    Features are uint16_t readings in 1/64 ADC counts through each
+    sensor's front end (CONFIG['nano_adc']), so the ATmega328P classifies
+    straight from analogRead() without float math. Each threshold is the
+    largest reading the float model sends left, which makes the integer
+    forest agree with it for every possible reading. Nodes are 4 bytes in
+    PROGMEM.
+    """
+
+    print("\n" + "=" * 70)
+    print("🔧 ARDUINO NANO INTEGER EXPORT")
+    print("=" * 70)
+
+    class_names = list(label_encoder.classes_)
+    n_features = len(scaler.mean_)
+    n_classes = len(class_names)
+    lsb = nano_lsb()
+    if None in lsb:
+        missing = [name for name, unit in zip(FEATURE_NAMES, lsb) if unit is None]
+        print(f"⚠️  CONFIG['nano_adc'] has no sensor for {missing}; skipping")
+        return None
+    if len(trees) > 0xFF:
+        print(f"⚠️  {len(trees)} trees do not fit the Nano's uint8_t votes; skipping")
+        return None
+
+    # What the float model compares for reading q of each feature
+    if raw_thresholds:
+        values = [lambda q, unit=unit: nano_value(q, unit) for unit in lsb]
+    else:
+        means, stds = device_scaler(scaler)
+        values = [lambda q, unit=unit, m=m, s=s: device_scale(nano_value(q, unit), m, s)
+                  for unit, m, s in zip(lsb, means, stds)]
+
+    nodes, roots = encode_nano(trees, values)
+    flash_bytes = 4 * len(nodes) + 2 * len(roots)
+    adc = CONFIG['nano_adc']
+    feature_names = FEATURE_NAMES
+
+    c_code = []
+
+    # Header comment
+    c_code.append("/*")
+    c_code.append(" * Solar Panel Fault Detection - Random Forest Model (integer, Arduino Nano)")
+    c_code.append(generated_line())
+    c_code.append(f" * Trees: {len(trees)}, Nodes: {len(nodes)} ({flash_bytes} bytes PROGMEM)")
+    c_code.append(f" * Readings: 1/{adc['scale']} ADC counts ({adc['adc_max']:.0f} = "
+                  f"{adc['vref']:g} V) as uint16_t, no float math")
+    c_code.append(" * ")
+    c_code.append(" * Classes:")
+    for i, name in enumerate(class_names):
+        c_code.append(f" *   {i}: {name}")
+    c_code.append(" * ")
+    c_code.append(" * Usage: uint8_t fault_type = nano_forest_predict(&SOLAR_NANO_FOREST, readings);")
+    c_code.append(" */")
+    c_code.append("")
+
+    c_code.append("#ifndef SOLAR_FAULT_MODEL_NANO_H")
+    c_code.append("#define SOLAR_FAULT_MODEL_NANO_H")
+    c_code.append("")
+    c_code.append(f"#define NANO_MAX_CLASSES {n_classes}")
+    c_code.append('#include "forest_nano.h"')
+    c_code.append("")
+    c_code.append(f"#define NANO_NUM_FEATURES {n_features}")
+    c_code.append(f"#define NANO_ADC_SCALE {adc['scale']}")
+    c_code.append("")
+
+    c_code.append("// Fault type names")
+    for i, name in enumerate(class_names):
+        c_code.append(f'const char NANO_CLASS_{i}[] PROGMEM = "{name}";')
+    c_code.append("const char* const NANO_CLASS_NAMES[] PROGMEM = {")
+    c_code.append("    " + ", ".join(f"NANO_CLASS_{i}" for i in range(n_classes)))
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("// Physical value of one reading unit (volts, amps, degC, lux, percent);")
+    c_code.append("// the float model sees reading q of feature f as q * NANO_FEATURE_LSB[f]")
+    c_code.append("const float NANO_FEATURE_LSB[] PROGMEM = {")
+    for name, unit in zip(feature_names, lsb):
+        c_code.append(f"    {c_float(unit)},   // {name}")
+    c_code.append("};")
+    c_code.append("")
+
+    # Efficiency has no sensor on the Nano
+    factor = None
+    if 'Efficiency' in feature_names:
+        index = {name: i for i, name in enumerate(feature_names)}
+        factor = nano_efficiency_factor(lsb)
+        efficiency_max = int(EFFICIENCY_MAX * adc['efficiency_steps'])
+        c_code.append("// Efficiency reading from the voltage, current and light readings:")
+        c_code.append("// panel_efficiency() (panel_efficiency.h) in integer math, clamped the same way")
+        c_code.append(f"#define NANO_EFFICIENCY_FEATURE {index['Efficiency']}")
+        c_code.append(f"#define NANO_EFFICIENCY_FACTOR {factor}UL")
+        c_code.append(f"#define NANO_EFFICIENCY_MAX {efficiency_max}")
+        c_code.append("inline uint16_t nano_efficiency_reading(const uint16_t* readings) {")
+        c_code.append(f"    uint32_t light = readings[{index['Light_Intensity']}];")
+        c_code.append("    if (light == 0) {")
+        c_code.append("        return 0;")
+        c_code.append("    }")
+        c_code.append(f"    uint32_t power = (uint32_t)readings[{index['Voltage']}] * "
+                      f"readings[{index['Current']}];")
+        c_code.append("    uint64_t efficiency = (uint64_t)power * NANO_EFFICIENCY_FACTOR / (light << 16);")
+        c_code.append("    return efficiency < NANO_EFFICIENCY_MAX ? (uint16_t)efficiency : NANO_EFFICIENCY_MAX;")
+        c_code.append("}")
+        c_code.append("")
+
+    c_code.append("// Node table: { threshold (leaves: class), feature (leaves: NANO_LEAF), right }")
+    c_code.append("const NanoNode NANO_NODES[] PROGMEM = {")
+    for tree_idx, root in enumerate(roots):
+        c_code.append(f"    // Tree {tree_idx}")
+        end = roots[tree_idx + 1] if tree_idx + 1 < len(roots) else len(nodes)
+        for threshold, feature, right in nodes[root:end]:
+            if feature == FOREST_LEAF:
+                c_code.append(f"    {{ {threshold}, NANO_LEAF, 0 }},")
+            else:
+                c_code.append(f"    {{ {threshold}, {feature}, {right} }},")
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("// Root node of each tree")
+    c_code.append("const uint16_t NANO_ROOTS[] PROGMEM = {")
+    for i in range(0, len(roots), 16):
+        c_code.append("    " + ", ".join(str(r) for r in roots[i:i + 16]) + ",")
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("const NanoForest SOLAR_NANO_FOREST = {")
+    c_code.append("    NANO_NODES,")
+    c_code.append("    NANO_ROOTS,")
+    c_code.append(f"    {len(trees)},   // num_trees")
+    c_code.append(f"    {n_features},    // num_features")
+    c_code.append(f"    {n_classes},    // num_classes")
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("#endif // SOLAR_FAULT_MODEL_NANO_H")
+
+    # Same leaf as the float trees for every dataset row, once quantized
+    def vote(classes):
+        counts = [classes.count(c) for c in range(n_classes)]
+        return counts.index(max(counts))
+
+    rows = load_feature_rows()
+    inputs = load_model_inputs(scaler, raw_thresholds)
+    mismatches = changed = 0
+    for raw, exact in zip(rows, inputs):
+        readings = nano_readings(raw, lsb)
+        x = [values[f](q) for f, q in enumerate(readings)]
+        nano_classes = [walk_nano_tree(nodes, root, readings) for root in roots]
+        mismatches += sum(c != walk_flat_tree(tree, x) for c, tree in zip(nano_classes, trees))
+        changed += vote(nano_classes) != vote([walk_flat_tree(tree, exact) for tree in trees])
+    if mismatches:
+        raise ExportCheckError(f"{mismatches} integer leaf decisions differ from the float trees")
+
+    output_file = CONFIG['output_header_nano']
+    with open(output_file, 'w') as f:
+        f.write('\n'.join(c_code) + '\n')
+
+    print(f"✅ Nano export complete: {output_file}")
+    print(f"   Nodes: {len(nodes)} x 4 bytes + {len(roots)} roots = {flash_bytes} bytes PROGMEM")
+    print(f"   RAM: {n_features * 2} bytes of readings + {n_classes} vote counters")
+    print(f"✅ {len(rows)} rows x {len(trees)} trees: integer leaves match the float trees")
+    print(f"   Rounding to readings changes the class of {changed} of {len(rows)} rows")
+
+    # Integer efficiency against the float formula on the same readings
+    if factor is not None:
+        e = index['Efficiency']
+        worst = 0.0
+        for raw in rows:
+            readings = nano_readings(raw, lsb)
+            x = [nano_value(q, unit) for q, unit in zip(readings, lsb)]
+            exact = panel_efficiency(x[index['Voltage']], x[index['Current']], x[index['Light_Intensity']])
+            worst = max(worst, abs(nano_efficiency(readings, factor) * lsb[e] - exact))
+        print(f"   nano_efficiency_reading() is within {worst:.4f} % of panel_efficiency() on every row")
+
+    return output_file
+
+
+# =============================================================================
+# CASCADE PREFILTER (forest_cascade.h)
+# =============================================================================
+CASCADE_EFFICIENCY = 0xFE
+CASCADE_LEAF = 0xFF
+CASCADE_FOREST = 0xFF
+# Features the prefilter computes the efficiency from
+CASCADE_FEATURES = ['Voltage', 'Current', 'Light_Intensity']
+
+
+def cascade_inputs(raw, feature_index):
+    """Raw float32 features plus the efficiency, as cascade_value() computes them."""
+    efficiency = panel_efficiency(raw[feature_index['Voltage']], raw[feature_index['Current']],
+                                  raw[feature_index['Light_Intensity']])
+    return list(raw) + [efficiency]
+
+
+def best_cascade_leaves(hist, n_classes, min_precision):
+    """
+    Best single split of one child from its per-bin class counts
+    (hist[bin][class]). Returns (rows answered, split bin or None,
+    [left leaf, right leaf]); a leaf answers with its majority class when
+    that class holds at least min_precision of its rows.
+    """
+    def leaf(counts):
+        total = sum(counts)
+        if total == 0:
+            return 0, CASCADE_FOREST
+        top = max(range(n_classes), key=lambda c: counts[c])
+        if counts[top] >= min_precision * total:
+            return total, top
+        return 0, CASCADE_FOREST
+
+    whole = [sum(row[c] for row in hist) for c in range(n_classes)]
+    covered, value = leaf(whole)
+    best = (covered, None, [value, value])
+
+    left = [0] * n_classes
+    for k in range(len(hist) - 1):
+        for c in range(n_classes):
+            left[c] += hist[k][c]
+        right = [w - l for w, l in zip(whole, left)]
+        (left_covered, left_value), (right_covered, right_value) = leaf(left), leaf(right)
+        if left_covered + right_covered > best[0]:
+            best = (left_covered + right_covered, k, [left_value, right_value])
+    return best
+
+
+def train_cascade(inputs, forest_classes, n_classes):
+    """
+    Grow the depth-2 first stage on the forest's own classes.
+
+    Every input (raw features and the efficiency) gets up to
+    CONFIG['cascade_bins'] - 1 quantile thresholds. For every root split
+    the children pick their best single split from joint bin histograms,
+    and the root that lets the most rows skip the forest wins.
+    Returns (root, children, leaves) with (input, threshold) splits.
+    """
+    n_inputs = len(inputs[0])
+    n_bins = CONFIG['cascade_bins']
+    min_precision = CONFIG['cascade_min_precision']
+
+    thresholds = []
+    for i in range(n_inputs):
+        values = sorted(row[i] for row in inputs)
+        cuts = sorted(set(values[len(values) * k // n_bins] for k in range(1, n_bins)))
+        thresholds.append(cuts)
+    bins = [[bisect.bisect_left(thresholds[i], row[i]) for i in range(n_inputs)] for row in inputs]
+
+    best = (0, None, None, None)
+    for f in range(n_inputs):
+        fb = len(thresholds[f]) + 1
+        # joint[g][bin of f][bin of g][class], cumulated over the bins of f
+        joint = []
+        for g in range(n_inputs):
+            gb = len(thresholds[g]) + 1
+            counts = [[[0] * n_classes for _ in range(gb)] for _ in range(fb)]
+            for row_bins, c in zip(bins, forest_classes):
+                counts[row_bins[f]][row_bins[g]][c] += 1
+            for b in range(1, fb):
+                for j in range(gb):
+                    for c in range(n_classes):
+                        counts[b][j][c] += counts[b - 1][j][c]
+            joint.append(counts)
+
+        for k in range(fb - 1):
+            children = []
+            for side in range(2):
+                child = (0, None, [CASCADE_FOREST, CASCADE_FOREST])
+                for g in range(n_inputs):
+                    below, total = joint[g][k], joint[g][fb - 1]
+                    hist = below if side == 0 else [[t - b for t, b in zip(trow, brow)]
+                                                    for trow, brow in zip(total, below)]
+                    covered, split, leaves = best_cascade_leaves(hist, n_classes, min_precision)
+                    if covered > child[0]:
+                        child = (covered, None if split is None else (g, split), leaves)
+                children.append(child)
+            covered = children[0][0] + children[1][0]
+            if covered > best[0]:
+                best = (covered, (f, k), children[0], children[1])
+
+    def split_of(index):
+        input_idx, k = index
+        feature = CASCADE_EFFICIENCY if input_idx == n_inputs - 1 else input_idx
+        return feature, thresholds[input_idx][k]
+
+    if best[1] is None:
+        none = (CASCADE_LEAF, 0.0)
+        return none, [none, none], [CASCADE_FOREST] * 4
+    children = [split_of(child[1]) if child[1] else (CASCADE_LEAF, 0.0) for child in best[2:]]
+    leaves = best[2][2] + best[3][2]
+    return split_of(best[1]), children, leaves
+
+
+def cascade_prefilter_value(inputs, root, children, leaves, n_features):
+    """Python mirror of cascade_prefilter()."""
+    def value(feature):
+        return inputs[n_features] if feature == CASCADE_EFFICIENCY else inputs[feature]
+
+    if root[0] == CASCADE_LEAF:
+        return leaves[0]
+    side = 0 if value(root[0]) <= root[1] else 1
+    child = children[side]
+    if child[0] == CASCADE_LEAF:
+        return leaves[2 * side]
+    return leaves[2 * side + (0 if value(child[0]) <= child[1] else 1)]
+
+
+def export_cascade(model, scaler, label_encoder, trees, weights, raw_thresholds=False):
+    """
+    Export a two-stage cascade (forest_cascade.h): a depth-2 tree over the
+    raw features and the panel efficiency answers the plain readings, and
+    only the rest run the full forest (model_table.h). The first stage is
+    trained on the forest's classes for the dataset rows, so it only
+    answers where the forest almost always agrees
+    (CONFIG['cascade_min_precision']).
+    """
+
+    print("\n" + "=" * 70)
+    print("🔧 CASCADE PREFILTER EXPORT")
+    print("=" * 70)
+
+    class_names = list(label_encoder.classes_)
+    n_classes = len(class_names)
+    n_features = len(scaler.mean_)
+    if any(name not in FEATURE_NAMES for name in CASCADE_FEATURES):
+        print(f"⚠️  The cascade expects features {CASCADE_FEATURES}; skipping")
+        return None
+    feature_index = {name: i for i, name in enumerate(FEATURE_NAMES)}
+
+    # Forest class of every dataset row
+    raw_rows = [[to_float32(v) for v in raw] for raw in load_feature_rows()]
+    forest_classes = []
+    for x in load_model_inputs(scaler, raw_thresholds):
+        votes = [0] * n_classes
+        for nodes, w in zip(trees, weights):
+            votes[walk_flat_tree(nodes, x)] += w
+        forest_classes.append(int(np.argmax(votes)))
+
+    inputs = [cascade_inputs(raw, feature_index) for raw in raw_rows]
+    root, children, leaves = train_cascade(inputs, forest_classes, n_classes)
+
+    # Share answered by the first stage, and agreement with the forest
+    answered = disagree = 0
+    for i in range(len(raw_rows)):
+        predicted = cascade_prefilter_value(inputs[i], root, children, leaves, n_features)
+        if predicted != CASCADE_FOREST:
+            answered += 1
+            disagree += predicted != forest_classes[i]
+
+    def c_split(split):
+        feature, threshold = split
+        names = {CASCADE_EFFICIENCY: 'CASCADE_EFFICIENCY', CASCADE_LEAF: 'CASCADE_LEAF'}
+        return f"{{ {c_float(threshold)}, {names.get(feature, str(feature))} }}"
+
+    def describe(split):
+        feature, threshold = split
+        name = 'Efficiency (derived)' if feature == CASCADE_EFFICIENCY else FEATURE_NAMES[feature]
+        return f"{name} <= {threshold:.6g}"
+
+    def c_leaf(value):
+        return 'CASCADE_FOREST' if value == CASCADE_FOREST else str(value)
+
+    def leaf_name(value):
+        return 'forest' if value == CASCADE_FOREST else class_names[value]
+
+    n_rows = max(len(raw_rows), 1)
+    c_code = []
+
+    # Header comment
+    c_code.append("/*")
+    c_code.append(" * Solar Panel Fault Detection - Two-Stage Cascade (prefilter + forest)")
+    c_code.append(generated_line())
+    c_code.append(f" * First stage answers {100.0 * answered / n_rows:.1f}% of the dataset rows, "
+                  f"{disagree} of them differently from the forest")
+    c_code.append(f" * Trained with cascade_min_precision = {CONFIG['cascade_min_precision']}")
+    c_code.append(" * ")
+    c_code.append(" * Classes:")
+    for i, name in enumerate(class_names):
+        c_code.append(f" *   {i}: {name}")
+    c_code.append(" * ")
+    c_code.append(" * Usage: int fault_type = cascade_predict(features);")
+    c_code.append(" */")
+    c_code.append("")
+
+    c_code.append("#ifndef SOLAR_FAULT_MODEL_CASCADE_H")
+    c_code.append("#define SOLAR_FAULT_MODEL_CASCADE_H")
+    c_code.append("")
+    c_code.append('#include "model_table.h"')
+    c_code.append('#include "forest_cascade.h"')
+    c_code.append("")
+
+    c_code.append("// First stage: " + describe(root) if root[0] != CASCADE_LEAF else
+                  "// First stage: no split answers reliably, every reading runs the forest")
+    for side, child in enumerate(children):
+        if root[0] == CASCADE_LEAF:
+            break
+        branch = 'yes' if side == 0 else 'no'
+        if child[0] == CASCADE_LEAF:
+            c_code.append(f"//   {branch}: {leaf_name(leaves[2 * side])}")
+        else:
+            c_code.append(f"//   {branch}: {describe(child)} ? {leaf_name(leaves[2 * side])} "
+                          f": {leaf_name(leaves[2 * side + 1])}")
+    c_code.append("const CascadePrefilter SOLAR_CASCADE = {")
+    c_code.append(f"    {c_split(root)},   // root")
+    c_code.append(f"    {{ {c_split(children[0])}, {c_split(children[1])} }},   // children")
+    c_code.append(f"    {{ {', '.join(c_leaf(v) for v in leaves)} }},   // leaves")
+    c_code.append(f"    {feature_index['Voltage']},   // voltage_feature")
+    c_code.append(f"    {feature_index['Current']},   // current_feature")
+    c_code.append(f"    {feature_index['Light_Intensity']},   // light_feature")
+    c_code.append("};")
+    c_code.append("")
+
+    c_code.append("// Main prediction function - returns class index")
+    c_code.append("inline int cascade_predict(const float* features) {")
+    c_code.append("    return cascade_forest_predict(&SOLAR_CASCADE, &SOLAR_FOREST, features);")
+    c_code.append("}")
+    c_code.append("")
+    c_code.append("#endif // SOLAR_FAULT_MODEL_CASCADE_H")
+
+    output_file = CONFIG['output_header_cascade']
+    with open(output_file, 'w') as f:
+        f.write('\n'.join(c_code) + '\n')
+
+    print(f"✅ Cascade export complete: {output_file}")
+    print(f"   First stage answers {answered} of {len(raw_rows)} rows "
+          f"({100.0 * answered / n_rows:.1f}%), the forest runs for the rest")
+    if disagree == 0:
+        print("✅ The first stage agrees with the forest on every row it answers")
+    else:
+        print(f"⚠️  The first stage differs from the forest on {disagree} rows "
+              f"({100.0 * disagree / n_rows:.2f}% of all rows)")
+
+    return output_file
 
 
 # =============================================================================
-# MAIN EXECUTION
-# =============================================================================
+# BINARY MODEL BLOB (forest_blob.h)
+# =============================================================================
+BLOB_MAGIC = 0x46524653   # "SFRF"
+BLOB_VERSION = 1
+BLOB_SCALER = 0x1
+BLOB_PROBA = 0x2
+BLOB_NODE_PROBA = 0x4
+# magic, format_version, header_size, total_size, checksum, model_version,
+# num_nodes, num_trees, num_features, num_classes, flags, nodes_offset,
+# roots_offset, scaler_offset, names_offset, names_size, proba_offset
+BLOB_HEADER = struct.Struct('<IHHIIIIHBBIIIIIII')
+
+
+def pack_blob(trees, class_names, feature_names, scaler_params, model_version):
+    """
+    Serialize flat trees into the forest_blob.h layout. `scaler_params`
+    is (means, stds) as float32 lists, or None when thresholds are raw.
+    Leaf distributions (`proba`) are stored when every leaf has one.
+    """
+    def pad(data):
+        return data + b'\0' * (-len(data) % 4)
+
+    nodes, roots = b'', []
+    for tree in trees:
+        roots.append(len(nodes) // 8)
+        for node in tree:
+            if node['feature'] == FOREST_LEAF:
+                nodes += struct.pack('<fHBB', 0.0, 0, FOREST_LEAF, node['value'])
+            else:
+                nodes += struct.pack('<fHBB', node['threshold'], node['right'], node['feature'], 0)
+
+    sections = [nodes, pad(struct.pack(f'<{len(roots)}H', *roots))]
+    if scaler_params is not None:
+        means, stds = scaler_params
+        sections.append(struct.pack(f'<{2 * len(means)}f', *means, *stds))
+    names = b''.join(name.encode() + b'\0' for name in list(class_names) + list(feature_names))
+    sections.append(pad(names))
+    all_nodes = [node for tree in trees for node in tree]
+    proba = all('proba' in node for node in all_nodes if node['feature'] == FOREST_LEAF)
+    node_proba = proba and all('proba' in node for node in all_nodes)
+    if proba:
+        dist = []
+        for node in all_nodes:
+            keep = node_proba or node['feature'] == FOREST_LEAF
+            dist.extend(node['proba'] if keep else [0.0] * len(class_names))
+        sections.append(struct.pack(f'<{len(dist)}f', *dist))
+
+    offsets = []
+    offset = BLOB_HEADER.size
+    for data in sections:
+        offsets.append(offset)
+        offset += len(data)
+    payload = b''.join(sections)
+    scaler_offset = offsets[2] if scaler_params is not None else 0
+    names_offset = offsets[-2] if proba else offsets[-1]
+    flags = ((BLOB_SCALER if scaler_params is not None else 0) | (BLOB_PROBA if proba else 0) |
+             (BLOB_NODE_PROBA if node_proba else 0))
+    header = BLOB_HEADER.pack(
+        BLOB_MAGIC, BLOB_VERSION, BLOB_HEADER.size, BLOB_HEADER.size + len(payload),
+        zlib.crc32(payload), model_version, len(nodes) // 8, len(roots), len(feature_names),
+        len(class_names), flags, offsets[0], offsets[1], scaler_offset, names_offset,
+        len(names), offsets[-1] if proba else 0)
+    return header + payload
+
+
+def read_blob(data):
+    """Parse and check a blob - returns (trees, class_names, feature_names, header fields)."""
+    fields = BLOB_HEADER.unpack_from(data)
+    (magic, version, header_size, total_size, checksum, model_version, num_nodes, num_trees,
+     num_features, num_classes, flags, nodes_offset, roots_offset, scaler_offset,
+     names_offset, names_size, proba_offset) = fields
+    if magic != BLOB_MAGIC or version != BLOB_VERSION:
+        raise ValueError("not a version 1 forest blob")
+    if total_size > len(data) or zlib.crc32(data[header_size:total_size]) != checksum:
+        raise ValueError("truncated blob or checksum mismatch")
+
+    nodes = []
+    for i in range(num_nodes):
+        threshold, right, feature, value = struct.unpack_from('<fHBB', data, nodes_offset + 8 * i)
+        nodes.append({'feature': feature, 'threshold': threshold, 'right': right, 'value': value})
+        if flags & BLOB_PROBA and (feature == FOREST_LEAF or flags & BLOB_NODE_PROBA):
+            offset = proba_offset + 4 * num_classes * i
+            nodes[-1]['proba'] = list(struct.unpack_from(f'<{num_classes}f', data, offset))
+    roots = list(struct.unpack_from(f'<{num_trees}H', data, roots_offset)) + [num_nodes]
+    trees = [nodes[roots[t]:roots[t + 1]] for t in range(num_trees)]
+    names = data[names_offset:names_offset + names_size].split(b'\0')
+    names = [n.decode() for n in names[:num_classes + num_features]]
+    return trees, names[:num_classes], names[num_classes:], dict(
+        model_version=model_version, checksum=checksum, size=total_size,
+        scaler=bool(flags & BLOB_SCALER), proba=bool(flags & BLOB_PROBA),
+        node_proba=bool(flags & BLOB_NODE_PROBA))
+
+
+def export_blob(model, scaler, label_encoder, trees, raw_thresholds=False):
+    """
+    Write the forest as a versioned, checksummed binary blob.
+
+    Same node records as model_table.h, plus scaler, class names,
+    feature names and leaf distributions, so a device or host can load a
+    new model at runtime (forest_blob_loader.h) instead of being rebuilt.
+    Pass the trees before compact_forest(): it merges leaves by class and
+    would lose the distributions predict_proba() needs.
+    """
+
+    print("\n" + "=" * 70)
+    print("🔧 BINARY MODEL BLOB EXPORT")
+    print("=" * 70)
+
+    class_names = list(label_encoder.classes_)
+    scaler_params = None if raw_thresholds else device_scaler(scaler)
+    data = pack_blob(trees, class_names, FEATURE_NAMES, scaler_params,
+                     CONFIG['blob_model_version'])
+
+    # Read it back and replay the datasets through the parsed trees
+    blob_trees, blob_classes, blob_features, info = read_blob(data)
+    rows = load_model_inputs(scaler, raw_thresholds)
+    mismatches = sum(walk_flat_tree(a, x) != walk_flat_tree(b, x)
+                     for x in rows for a, b in zip(trees, blob_trees))
+    if blob_classes != class_names or blob_features != FEATURE_NAMES:
+        raise ExportCheckError(f"Blob reads back classes {blob_classes}, features {blob_features}")
+    if mismatches:
+        raise ExportCheckError(f"{mismatches} blob leaf decisions differ from the flat trees")
+
+    output_file = CONFIG['output_blob']
+    with open(output_file, 'wb') as f:
+        f.write(data)
+
+    print(f"✅ Blob export complete: {output_file}")
+    print(f"   Version {BLOB_VERSION}, model version {info['model_version']}, "
+          f"CRC-32 {info['checksum']:08x}, {info['size']} bytes")
+    print(f"   Classes: {', '.join(blob_classes)}")
+    print(f"   Features: {', '.join(blob_features)}")
+    print(f"   Leaf distributions: {'yes' if info['proba'] else 'no (hard votes)'}")
+    print(f"   Split distributions (attribution): {'yes' if info['node_proba'] else 'no'}")
+    print(f"✅ {len(rows)} rows x {len(trees)} trees: blob trees match the flat trees")
+
+    return output_file
+
+
+# =============================================================================
+# BACKEND AUTOTUNING (model_best.h)
+# =============================================================================
+# Backends sharing the float features -> class API: name, CONFIG key of
+# the header, the predict call on `float* x`, and the model_select.h
+# define that picks it (None for the default). predict_early_exit() is
+# not a candidate: its vote checks cost more than the trees it skips
+# (benchmarks/bench_backends.cpp). A backend whose header says it is not
+# available (LUT_AVAILABLE 0) is reported as such and not timed
+AUTOTUNE_BACKENDS = [
+    ('if-else', 'output_header_manual', 'predict(x)', None),
+    ('flat table', 'output_header_table', 'forest_predict(&SOLAR_FOREST, x)', 'SOLAR_MODEL_TABLE'),
+    ('quickscorer', 'output_header_quickscorer', 'quickscorer_predict(&SOLAR_QUICKSCORER, x)',
+     'SOLAR_MODEL_QUICKSCORER'),
+    ('dense lut', 'output_header_lut', 'lut_predict(x)', 'SOLAR_MODEL_LUT'),
+    ('compact nodes', 'output_header_compact', 'compact_forest_predict(&SOLAR_COMPACT_FOREST, x)',
+     'SOLAR_MODEL_COMPACT'),
+]
+
+# Times one backend on the rows in argv[1] (float32, n_features per row);
+# prints ns per prediction and an FNV-1a hash of the classes
+AUTOTUNE_HOST_BENCH = """#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "{header}"
+
+static volatile int sink;
+
+int main(int argc, char** argv) {{
+    std::vector<float> data;
+    FILE* file = std::fopen(argv[1], "rb");
+    float value;
+    while (file && std::fread(&value, sizeof(value), 1, file) == 1) data.push_back(value);
+    if (file) std::fclose(file);
+    size_t n = data.size() / {n_features};
+
+    unsigned hash = 2166136261u;
+    for (size_t i = 0; i < n; i++) {{
+        float* x = &data[i * {n_features}];
+        hash = (hash ^ (unsigned){call}) * 16777619u;
+    }}
+    double best = 1e30;
+    for (int r = 0; r < 5; r++) {{
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++) {{
+            float* x = &data[i * {n_features}];
+            sink = {call};
+        }}
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / n;
+        if (ns < best) best = ns;
+    }}
+    std::printf("%.3f %u\\n", best, hash);
+    return 0;
+}}
+"""
+
+
+def flat_tree_splits(nodes, x):
+    """Splits a row passes on its way to a leaf."""
+    i = splits = 0
+    while nodes[i]['feature'] != FOREST_LEAF:
+        node = nodes[i]
+        i += 1 if x[node['feature']] <= node['threshold'] else node['right']
+        splits += 1
+    return splits
+
+
+def autotune_unavailable(header):
+    """Why a generated header has no backend to time, or None when it has one."""
+    with open(header) as f:
+        text = f.read()
+    if '#define LUT_AVAILABLE 0' in text:
+        return 'dense table too large (lut_max_bytes)'
+    return None
+
+
+def autotune_op_counts(trees, table_trees, rows, n_classes):
+    """
+    Average operations per prediction of every backend over `rows`, in
+    the units of the cycle tables (CONFIG['autotune_targets']).
+    """
+    n_features = len(rows[0])
+    qs = build_quickscorer(table_trees, n_features)
+    thresholds = lut_thresholds(table_trees, n_features)
+    search_steps = sum(max(1, len(t).bit_length()) for t in thresholds)
+    totals = {name: {} for name, _, _, _ in AUTOTUNE_BACKENDS}
+
+    def add(name, op, count):
+        totals[name][op] = totals[name].get(op, 0) + count
+
+    for x in rows:
+        splits = [flat_tree_splits(nodes, x) for nodes in trees]
+        table_splits = sum(flat_tree_splits(nodes, x) for nodes in table_trees)
+        add('if-else', 'split', sum(splits))
+        add('if-else', 'tree', len(trees))
+
+        add('flat table', 'node', table_splits)
+        add('flat table', 'tree', len(table_trees))
+
+        # QuickScorer scans each feature's conditions up to the first true one
+        scanned = 0
+        for f, feature_conditions in enumerate(qs['conditions']):
+            for threshold, _, _ in feature_conditions:
+                scanned += 1
+                if x[f] <= threshold:
+                    break
+        add('quickscorer', 'qs_condition', scanned)
+        add('quickscorer', 'qs_tree', len(table_trees))
+
+        add('dense lut', 'bin_compare', sum(len(t) for t in thresholds))
+        add('dense lut', 'lookup', 1)
+
+        add('compact nodes', 'bin_compare', search_steps)
+        add('compact nodes', 'compact_node', table_splits)
+        add('compact nodes', 'tree', len(table_trees))
+
+    counts = {}
+    for name, ops in totals.items():
+        counts[name] = {op: count / len(rows) for op, count in ops.items()}
+        counts[name]['call'] = 1
+        counts[name]['class'] = 0 if name == 'dense lut' else n_classes
+    return counts
+
+
+def fnv1a_classes(classes):
+    """Same hash AUTOTUNE_HOST_BENCH prints."""
+    h = 2166136261
+    for c in classes:
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def time_backend_on_host(cxx, header, call, rows_file, n_features):
+    """(ns per prediction, class hash) from AUTOTUNE_HOST_BENCH, None when it does not build."""
+    try:
+        with tempfile.TemporaryDirectory() as tmp:
+            src = os.path.join(tmp, 'bench.cpp')
+            exe = os.path.join(tmp, 'bench')
+            with open(src, 'w') as f:
+                f.write(AUTOTUNE_HOST_BENCH.format(header=os.path.basename(header), call=call,
+                                                   n_features=n_features))
+            subprocess.run([cxx, '-O2', '-std=c++11', '-I', os.path.dirname(header), '-I', MODELS_DIR,
+                            src, '-o', exe], check=True, capture_output=True)
+            out = subprocess.run([exe, rows_file], check=True, capture_output=True, text=True)
+            ns, digest = out.stdout.split()
+            return float(ns), int(digest)
+    except (OSError, subprocess.CalledProcessError, ValueError):
+        return None
+
+
+def host_description(cxx):
+    """CPU model and compiler version the host timings were taken with."""
+    cpu = platform.processor() or platform.machine()
+    try:
+        with open('/proc/cpuinfo') as f:
+            for line in f:
+                if line.startswith('model name'):
+                    cpu = line.split(':', 1)[1].strip()
+                    break
+    except OSError:
+        pass
+    try:
+        out = subprocess.run([cxx, '--version'], check=True, capture_output=True, text=True)
+        compiler = out.stdout.splitlines()[0]
+    except (OSError, subprocess.CalledProcessError, IndexError):
+        compiler = cxx
+    return f"{cpu}, {compiler}"
+
+
+def autotune_backends(trees, table_trees, scaler, raw_thresholds, n_classes):
+    """
+    Pick the fastest backend within CONFIG['flash_budget'] for
+    CONFIG['autotune_target'] and write model_best.h, which selects it
+    through model_select.h.
+
+    Host: every backend is compiled and timed on the shuffled dataset rows,
+    and must return the forest's class on all of them. Other targets:
+    latency is the backend's operation counts on the same rows times the
+    target's cycle table. Flash is measured with the target compiler (host
+    compiler as a stand-in when it is missing). The latency/size table of
+    every candidate goes to CONFIG['autotune_report'].
+
+    Host timings depend on the machine and on timing noise (backends a few
+    ns apart can swap places between runs), so a host model_best.h names
+    the CPU and compiler it was tuned on. Cycle table targets give the same
+    choice on every run with the same compiler.
+    """
+
+    print("\n" + "=" * 70)
+    print("🔧 BACKEND AUTOTUNING")
+    print("=" * 70)
+
+    target_name = CONFIG['autotune_target']
+    target = CONFIG['autotune_targets'][target_name]
+    budget = CONFIG['flash_budget']
+    host_cxx = CONFIG['autotune_targets']['host']['compiler']
+    rows = load_model_inputs(scaler, raw_thresholds)
+    shuffled = list(rows)
+    random.Random(0).shuffle(shuffled)
+
+    # Class every backend must return: the plain vote of the table trees
+    expected = []
+    for x in shuffled:
+        votes = [0] * n_classes
+        for nodes in table_trees:
+            votes[walk_flat_tree(nodes, x)] += 1
+        expected.append(votes.index(max(votes)))
+    expected_hash = fnv1a_classes(expected)
+
+    n_features = len(rows[0])
+    counts = None if target_name == 'host' else autotune_op_counts(
+        trees, table_trees, rows, n_classes)
+
+    results = []
+    unavailable = []
+    with tempfile.TemporaryDirectory() as tmp:
+        rows_file = os.path.join(tmp, 'rows.bin')
+        with open(rows_file, 'wb') as f:
+            for x in shuffled:
+                f.write(struct.pack(f'<{n_features}f', *x))
+
+        for name, header_key, call, define in AUTOTUNE_BACKENDS:
+            header = CONFIG[header_key]
+            reason = autotune_unavailable(header)
+            if reason:
+                unavailable.append((name, reason))
+                continue
+            size = measure_code_size(header, call, target['compiler'])
+            size_source = target_name
+            if size is None and target_name != 'host':
+                size = measure_code_size(header, call, host_cxx)
+                size_source = 'host'
+            result = {'name': name, 'header': header, 'define': define, 'size': size,
+                      'size_source': size_source, 'parity': None}
+            if counts is None:
+                timing = time_backend_on_host(host_cxx, header, call, rows_file, n_features)
+                result['ns'] = timing[0] if timing else None
+                result['parity'] = timing is not None and timing[1] == expected_hash
+            else:
+                cycles = sum(target['cycles'][op] * n for op, n in counts[name].items())
+                result['cycles'] = cycles
+                result['ns'] = cycles * 1000.0 / target['mhz']
+            results.append(result)
+
+    failed = [r['name'] for r in results if r['parity'] is False]
+    if failed:
+        raise ExportCheckError(f"Backends disagree with the forest vote: {', '.join(failed)}")
+    usable = [r for r in results if r['ns'] is not None]
+    fitting = [r for r in usable if r['size'] is not None and r['size'] <= budget]
+    if fitting:
+        best = min(fitting, key=lambda r: r['ns'])
+    elif usable:
+        best = min(usable, key=lambda r: (r['size'] is None, r['size']))
+        print(f"⚠️  No backend fits {budget} bytes, using the smallest")
+    else:
+        print("❌ No backend could be measured, model_best.h not written")
+        return None
+
+    def latency(r):
+        if r['ns'] is None:
+            return 'n/a'
+        if 'cycles' in r:
+            return f"{r['cycles']:.0f} cycles ({r['ns'] / 1000:.2f} us)"
+        return f"{r['ns']:.1f} ns"
+
+    if counts is None:
+        host = host_description(host_cxx)
+        method = f"timed on this host ({host_cxx} -O2, best of 5 over {len(rows)} shuffled dataset rows)"
+    else:
+        method = (f"estimated from the {target_name} cycle table at {target['mhz']} MHz "
+                  f"(operation counts averaged over {len(rows)} dataset rows)")
+
+    report = [
+        "Solar Panel Fault Detection - Backend Autotuning",
+        "=" * 50,
+        "",
+        f"Target: {target_name}",
+        f"Latency: {method}",
+        f"Flash budget: {budget} bytes",
+    ]
+    if counts is None:
+        report.append(f"Host: {host}")
+    report.append("")
+    table_start = len(report)
+    report.append(f"{'Backend':<22}{'Flash (bytes)':>14}  {'Latency':<26}{'Fits':<6}Parity")
+    for r in results:
+        size = 'n/a' if r['size'] is None else f"{r['size']}" + (' (host)' if r['size_source'] != target_name else '')
+        fits = 'yes' if r['size'] is not None and r['size'] <= budget else 'no'
+        parity = {None: '-', True: 'ok', False: 'FAIL'}[r['parity']]
+        marker = '*' if r is best else ' '
+        report.append(f"{marker} {r['name']:<20}{size:>14}  {latency(r):<26}{fits:<6}{parity}")
+    for name, reason in unavailable:
+        report.append(f"  {name:<20}{'-':>14}  {'unavailable: ' + reason}")
+    report.append("")
+    report.append(f"Chosen: {best['name']} ({os.path.basename(best['header'])}), "
+                  f"{latency(best)}, {best['size']} bytes")
+    if counts is not None:
+        report.append("")
+        report.append("Operations per prediction:")
+        for r in results:
+            ops = ', '.join(f"{op} {n:.1f}" for op, n in sorted(counts[r['name']].items()))
+            report.append(f"  {r['name']:<20}{ops}")
+
+    with open(CONFIG['autotune_report'], 'w') as f:
+        f.write("\n".join(report) + "\n")
+
+    c_code = []
+    c_code.append("/*")
+    c_code.append(" * Solar Panel Fault Detection - Autotuned Backend")
+    c_code.append(generated_line())
+    c_code.append(f" * Target: {target_name}, flash budget {budget} bytes")
+    c_code.append(f" * Fastest backend within budget: {best['name']} ({latency(best)}, {best['size']} bytes)")
+    c_code.append(f" * Every candidate: {os.path.relpath(CONFIG['autotune_report'], MODELS_DIR)}")
+    if counts is None:
+        c_code.append(" * ")
+        c_code.append(f" * Host-specific: timed on {host}.")
+        c_code.append(" * Backends a few ns apart can swap places between runs; re-run")
+        c_code.append(" * step3_export_to_esp32.py --autotune on the machine that will use it.")
+    c_code.append(" * ")
+    c_code.append(" * Usage: int fault_type = model_predict(features);")
+    c_code.append(" */")
+    c_code.append("")
+    c_code.append("#ifndef SOLAR_FAULT_MODEL_BEST_H")
+    c_code.append("#define SOLAR_FAULT_MODEL_BEST_H")
+    c_code.append("")
+    if best['define']:
+        c_code.append(f"#define {best['define']}")
+    c_code.append('#include "model_select.h"')
+    c_code.append("")
+    c_code.append("#endif // SOLAR_FAULT_MODEL_BEST_H")
+
+    output_file = CONFIG['output_header_best']
+    with open(output_file, 'w') as f:
+        f.write("\n".join(c_code) + "\n")
+
+    for line in report[table_start:]:
+        print(f"   {line}")
+    print(f"✅ Autotuned header: {output_file}")
+    print(f"✅ Report: {CONFIG['autotune_report']}")
+
+    return output_file
+
+
+# =============================================================================
+# FLOAT32 ELOQUENT EXPORT (model_float.h)
+# =============================================================================
+def export_eloquent(model, trees, output_file, float32=True):
+    """
+    Export the forest in the micromlgen/Eloquent layout of model.h.
+
+    With float32, thresholds are f-suffixed float32 literals (model_float.h):
+    micromlgen prints the float64 thresholds, so every `x[i] <= 0.7569...`
+    in model.h is a double comparison, which is software-emulated on the
+    ESP32 and on AVR. `trees` must be the unfolded flat trees (scaled
+    units): float32_threshold() makes each comparison give the same answer
+    as sklearn for every float32 input. Same class and predict(float *x) as
+    model.h, so it is a drop-in replacement.
+
+    Without float32 it writes what micromlgen would (the float64 sklearn
+    thresholds), so model.h still matches the artifacts when micromlgen is
+    not installed.
+    """
+
+    print("\n" + "=" * 70)
+    print("🔧 FLOAT32 ELOQUENT EXPORT" if float32 else "🔧 ELOQUENT EXPORT (MICROMLGEN LAYOUT)")
+    print("=" * 70)
+
+    n_classes = len(model.classes_)
+    vote_type = 'uint8_t' if len(trees) <= 255 else 'uint16_t'
+
+    c_code = []
+    c_code.append("#pragma once")
+    c_code.append("#include <cstdarg>")
+    if float32:
+        c_code.append("#include <stdint.h>")
+        c_code.append("")
+        c_code.append("// Same forest as model.h, with float32 thresholds (generated by")
+        c_code.append("// ml/step3_export_to_esp32.py). Inputs are scaled features.")
+    c_code.append("namespace Eloquent {")
+    c_code.append("    namespace ML {")
+    c_code.append("        namespace Port {")
+    c_code.append("            class RandomForest {")
+    c_code.append("                public:")
+    c_code.append("                    /**")
+    c_code.append("                    * Predict class for features vector")
+    c_code.append("                    */")
+    c_code.append("                    int predict(float *x) {")
+    c_code.append(f"                        {vote_type} votes[{n_classes}] = {{ 0 }};")
+
+    def threshold(node):
+        return c_float(node['threshold']) if float32 else repr(node['split'])
+
+    def tree_to_code(nodes, i, indent):
+        indent_str = "    " * indent
+        node = nodes[i]
+        if node['feature'] == FOREST_LEAF:
+            return [f"{indent_str}votes[{node['value']}] += 1;"]
+        code = [f"{indent_str}if (x[{node['feature']}] <= {threshold(node)}) {{"]
+        code.extend(tree_to_code(nodes, i + 1, indent + 1))
+        code.append(f"{indent_str}}}")
+        code.append("")
+        code.append(f"{indent_str}else {{")
+        code.extend(tree_to_code(nodes, i + node['right'], indent + 1))
+        code.append(f"{indent_str}}}")
+        return code
+
+    for tree_idx, nodes in enumerate(trees):
+        c_code.append(f"                        // tree #{tree_idx + 1}")
+        c_code.extend(tree_to_code(nodes, 0, 6))
+        c_code.append("")
+
+    c_code.append("                        // return argmax of votes")
+    c_code.append("                        uint8_t classIdx = 0;")
+    c_code.append(f"                        {vote_type if float32 else 'float'} maxVotes = votes[0];")
+    c_code.append("")
+    c_code.append(f"                        for (uint8_t i = 1; i < {n_classes}; i++) {{")
+    c_code.append("                            if (votes[i] > maxVotes) {")
+    c_code.append("                                classIdx = i;")
+    c_code.append("                                maxVotes = votes[i];")
+    c_code.append("                            }")
+    c_code.append("                        }")
+    c_code.append("")
+    c_code.append("                        return classIdx;")
+    c_code.append("                    }")
+    c_code.append("")
+    c_code.append("                protected:")
+    c_code.append("                };")
+    c_code.append("            }")
+    c_code.append("        }")
+    c_code.append("    }")
+
+    with open(output_file, 'w') as f:
+        f.write('\n'.join(c_code) + '\n')
+
+    print(f"✅ {'Float32' if float32 else 'Eloquent'} export complete: {output_file}")
+    print(f"   File size: {os.path.getsize(output_file)} bytes")
+
+    return output_file
+
+
+def dump_golden_predictions(model, scaler, trees):
+    """
+    Write model.predict(scaler.transform(X)) for every complete row of each
+    dataset (one class per line, in file order), model.predict_proba() of
+    the same rows (one row of probabilities per line) and the scaler the
+    headers must use, and check the float32 thresholds against the sklearn
+    trees.
+    predict() averages the trees' leaf distributions while the exported
+    headers count one vote per tree, so the rows where the two disagree are
+    listed separately in CONFIG['golden_vote_gaps'] with both classes.
+    Rows the device path sends to another leaf in some tree (float32
+    readings, six-decimal scaler) go to CONFIG['golden_leaf_gaps'].
+    benchmarks/bench_vote_parity.cpp streams the same rows through the
+    headers and checks them against the hard vote these files give.
+    """
+
+    print("\n" + "=" * 70)
+    print("🧪 GOLDEN PREDICTIONS")
+    print("=" * 70)
+
+    means, stds = device_scaler(scaler)
+    gaps = []
+    leaf_gaps = []
+    results = []
+
+    # Check every dataset before any golden file is written
+    for path, columns in zip(CONFIG['datasets'], DATASET_COLUMNS):
+        name = os.path.basename(path)
+        rows = load_dataset_rows(path, columns)
+        X_scaled = scaler.transform(np.array(rows))
+        expected = [int(c) for c in model.predict(X_scaled)]
+        probabilities = model.predict_proba(X_scaled)
+        mismatches = 0
+        dataset_gaps = 0
+
+        for i, raw in enumerate(rows):
+            # The device scales float32 readings with the float32 scaler
+            x = [device_scale(to_float32(raw[f]), means[f], stds[f]) for f in range(len(raw))]
+            vote = sklearn_vote(model, x)
+
+            votes = [0] * len(model.classes_)
+            for nodes in trees:
+                votes[walk_flat_tree(nodes, x)] += 1
+            if int(np.argmax(votes)) != vote:
+                mismatches += 1
+            if vote != expected[i]:
+                gaps.append((name, i, expected[i], vote))
+                dataset_gaps += 1
+            if max(abs(a - b) for a, b in zip(sklearn_proba(model, x), probabilities[i])) > 1e-9:
+                leaf_gaps.append((name, i))
+
+        if mismatches:
+            raise ExportCheckError(f"{name}: float32 thresholds differ from the sklearn trees' "
+                                   f"vote on {mismatches} rows")
+        results.append((name, expected, probabilities, dataset_gaps))
+
+    for (name, expected, probabilities, dataset_gaps), output_file, proba_file in zip(
+            results, CONFIG['golden_predictions'], CONFIG['golden_probabilities']):
+        os.makedirs(os.path.dirname(output_file), exist_ok=True)
+        with open(output_file, 'w') as f:
+            f.write('\n'.join(str(c) for c in expected) + '\n')
+        with open(proba_file, 'w') as f:
+            f.write('\n'.join(' '.join(f"{p:.6g}" for p in proba) for proba in probabilities) + '\n')
+
+        print(f"✅ {len(expected)} model.predict() classes for {name} saved to: {output_file}")
+        print(f"   model.predict_proba() saved to: {proba_file}")
+        print(f"   hard vote differs from model.predict() on {dataset_gaps} rows "
+              f"({100.0 * dataset_gaps / len(expected):.3f}%)")
+        print(f"   float32 thresholds match the sklearn trees' vote on all {len(expected)} rows")
+
+    output_file = CONFIG['golden_vote_gaps']
+    with open(output_file, 'w') as f:
+        f.write("# Rows where the exported headers' hard vote (one vote per tree)\n")
+        f.write("# differs from model.predict() (mean of the leaf distributions)\n")
+        f.write("# dataset row predict hard_vote\n")
+        for name, row, predicted, vote in gaps:
+            f.write(f"{name} {row} {predicted} {vote}\n")
+    print(f"✅ {len(gaps)} hard-vote gaps saved to: {output_file}")
+
+    output_file = CONFIG['golden_leaf_gaps']
+    with open(output_file, 'w') as f:
+        f.write("# Rows where float32 readings scaled as on the device reach another\n")
+        f.write("# leaf than model.predict_proba() in at least one tree\n")
+        f.write("# dataset row\n")
+        for name, row in leaf_gaps:
+            f.write(f"{name} {row}\n")
+    print(f"✅ {len(leaf_gaps)} rows reaching another leaf on the device saved to: {output_file}")
+
+    # The headers must scale with these exact values for the classes to hold
+    output_file = CONFIG['golden_scaler']
+    with open(output_file, 'w') as f:
+        f.write('mean ' + ' '.join(f"{m:.9g}" for m in means) + '\n')
+        f.write('std ' + ' '.join(f"{s:.9g}" for s in stds) + '\n')
+    print(f"✅ Scaler saved to: {output_file}")
+
+
+def verify_export(model, scaler, label_encoder):
+    """Verify the exported model matches Python predictions."""
+    
+    print("\n" + "=" * 70)
+    print("🧪 VERIFYING EXPORT")
+    print("=" * 70)
+    
+    test_cases = VERIFY_TEST_CASES
+    
+    print("\nPython model predictions (for verification):")
+    print("-" * 50)
+    
+    for i, case in enumerate(test_cases):
+        features = feature_row(case)
+        X = np.array([features])
+        X_scaled = scaler.transform(X)
+        prediction = model.predict(X_scaled)[0]
+        label = label_encoder.inverse_transform([prediction])[0]
+        
+        print(f"Test {i+1}: " + ", ".join(f"{name}={value:g}"
+                                          for name, value in zip(FEATURE_NAMES, features)))
+        print(f"        Prediction: {prediction} ({label})")
+        print()
+    
+    print("✅ Use these values to verify ESP32 predictions match!")
+    print("   On a host, benchmarks/bench_vote_parity.cpp checks every dataset row against")
+    print(f"   the trees' hard vote ({os.path.dirname(CONFIG['golden_scaler'])})")
+
+
+def generate_esp32_usage_guide(label_encoder):
+    """Generate documentation for using the model on ESP32."""
+    
+    class_names = list(label_encoder.classes_)
+    # Sketch variable holding each feature in the example below
+    variables = {'Voltage': 'voltage', 'Current': 'current', 'Temperature': 'temperature',
+                 'Light_Intensity': 'light', 'Efficiency': 'efficiency'}
+    
+    guide = """
+================================================================================
+ESP32 USAGE GUIDE - Solar Panel Fault Detection Model
+================================================================================
+
+INSTALLATION STEPS:
+-------------------
+1. Copy 'model_manual.h' and 'panel_efficiency.h' to your Arduino project folder
+2. Include it in your sketch: #include "model_manual.h"
+3. Call predict() or predict_result() with your sensor readings
+   ('model.h' is the Eloquent port instead: Eloquent::ML::Port::RandomForest,
+   without predict_result(), PredictionResult or CLASS_NAMES)
+
+FLAT TABLE MODEL (SMALLER FLASH):
+---------------------------------
+1. Copy 'model_table.h' and 'forest_runtime.h' to your Arduino project folder
+2. Include it in your sketch: #include "model_table.h"
+3. Call forest_predict(&SOLAR_FOREST, features) - same classes as predict()
+
+DENSE LOOKUP TABLE MODEL (FASTEST):
+-----------------------------------
+1. Copy 'model_lut.h', 'forest_lut.h' and 'forest_runtime.h' to your project
+2. Include it in your sketch: #include "model_lut.h"
+3. Call lut_predict(features) - one bin lookup per feature and one table load
+4. If the table is too large (lut_max_bytes), model_lut.h only defines
+   LUT_AVAILABLE 0 and has no lut_predict(): use another backend
+
+BINARY MODEL BLOB (UPDATE WITHOUT REFLASHING):
+----------------------------------------------
+1. Copy 'forest_blob.h', 'forest_blob_loader.h' and 'forest_runtime.h'
+2. Put 'solar_forest.bin' on LittleFS, or in a data partition
+   (parttool.py write_partition --partition-name forest --input solar_forest.bin)
+3. ForestSlot slot; ForestBlobStatus status;
+   forest_slot_swap(&slot, forest_blob_map_partition("forest", &status));
+   // or forest_blob_read_file(LittleFS, "/solar_forest.bin", &status)
+4. int fault_type = forest_slot_predict(&slot, features);
+5. Swap in a new blob at any time; a damaged one is rejected and the old
+   model keeps running (forest_blob_error(status) says why)
+
+TWO-STAGE CASCADE (SKIP THE FOREST FOR PLAIN READINGS):
+-------------------------------------------------------
+1. Copy 'model_cascade.h', 'forest_cascade.h', 'panel_efficiency.h',
+   'model_table.h' and 'forest_runtime.h' to your project
+2. Include it in your sketch: #include "model_cascade.h"
+3. Call cascade_predict(features) - a depth-2 physics prefilter answers
+   the plain readings, the rest run forest_predict()
+4. May differ from the forest on a few readings near class boundaries
+   (see the header comment and benchmarks/bench_cascade.cpp)
+
+FLOAT32 ELOQUENT MODEL (NO DOUBLE MATH):
+----------------------------------------
+1. Use 'model_float.h' instead of 'model.h' - same RandomForest class
+2. Thresholds are float32 literals, so no comparison is promoted to double
+
+USAGE EXAMPLE:
+--------------
+```cpp
+#include "model_manual.h"
+#include "panel_efficiency.h"
+
+void loop() {
+    // Read sensors (replace with actual sensor code)
+    float voltage = readVoltage();
+    float current = readCurrent();
+    float temperature = readTemperature();
+    float light = readLight();
+    
+    // No sensor for efficiency: same formula as the backend
+    float efficiency = panel_efficiency(voltage, current, light);
+    
+    // Create feature array [FEATURE_LIST]
+    float features[NUM_FEATURES] = {FEATURE_VARIABLES};
+    
+    // Get prediction, votes and fault flag in one pass
+    PredictionResult result = predict_result(features);
+    int fault_type = result.class_idx;    // CLASS_RANGE
+    
+    // Get human-readable name
+    const char* fault_name = CLASS_NAMES[fault_type];
+    
+    // Check if any fault
+    if (result.is_fault) {
+        // Turn on fault LED
+        digitalWrite(FAULT_LED, HIGH);
+    }
+}
+```
+
+CLASS MAPPING:
+--------------
+CLASS_MAPPING
+
+MEMORY USAGE (APPROXIMATE):
+---------------------------
+- Code size: ~5-15 KB (depends on tree complexity)
+- RAM usage: ~200-500 bytes
+- Suitable for ESP32 (520KB RAM, 4MB Flash)
+
+TIPS FOR ESP32:
+---------------
+1. Use float instead of double for ESP32 efficiency
+2. Model is already optimized with limited trees and depth
+3. Prediction takes ~1-5ms on ESP32 @ 240MHz
+4. Consider using FreeRTOS task for continuous monitoring
+
+================================================================================
+"""
+    
+    guide = guide.replace('FEATURE_LIST', ', '.join(FEATURE_NAMES))
+    guide = guide.replace('FEATURE_VARIABLES', ', '.join(variables.get(name, name.lower())
+                                                         for name in FEATURE_NAMES))
+    guide = guide.replace('CLASS_RANGE', f"0-{len(class_names) - 1}")
+    guide = guide.replace('CLASS_MAPPING', '\n'.join(f"{i} = {name}" for i, name in enumerate(class_names)))
+    
+    for path in CONFIG['output_guides']:
+        with open(path, 'w') as f:
+            f.write(guide)
+        print(f"\n✅ Usage guide saved to: {path}")
+
+
+# =============================================================================
+# MAIN EXECUTION
+# =============================================================================
+# Optional exports: (flag, CONFIG output key, help)
+OPTIONAL_EXPORTS = [
+    ('quickscorer', 'output_header_quickscorer', 'QuickScorer bitvectors (forest_quickscorer.h)'),
+    ('constexpr', 'output_header_constexpr', 'C++17 constexpr trees (forest_constexpr.h)'),
+    ('lut', 'output_header_lut', 'dense class table over threshold bins (forest_lut.h)'),
+    ('soft', 'output_header_soft', 'quantized leaf distributions (forest_soft.h)'),
+    ('compact', 'output_header_compact', '4-byte nodes for large forests (forest_compact.h)'),
+    ('cascade', 'output_header_cascade', 'physics prefilter in front of model_table.h (forest_cascade.h)'),
+]
+
+# Backends autotune_backends() compiles besides model_manual.h and model_table.h
+AUTOTUNE_EXPORTS = ['quickscorer', 'lut', 'compact']
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Export the trained forest to C headers. Without flags only the "
+                    "headers the firmware, backend and benchmarks build against are written.")
+    for flag, key, text in OPTIONAL_EXPORTS:
+        parser.add_argument(f'--{flag}', action='store_true',
+                            help=f"also write {os.path.basename(CONFIG[key])}: {text}")
+    parser.add_argument('--autotune', action='store_true',
+                        help="time every backend with the host compiler and write model_best.h "
+                             "and autotune_report.txt (host-specific; implies "
+                             + ", ".join(f'--{flag}' for flag in AUTOTUNE_EXPORTS) + ")")
+    parser.add_argument('--all', action='store_true', help="every optional export and --autotune")
+    args = parser.parse_args()
+    if args.all:
+        for flag, _, _ in OPTIONAL_EXPORTS:
+            setattr(args, flag, True)
+        args.autotune = True
+    if args.autotune:
+        for flag in AUTOTUNE_EXPORTS:
+            setattr(args, flag, True)
+    return args
+
+
 if __name__ == "__main__":
     
+    args = parse_args()
+    
     print("\n")
     print("╔" + "═" * 68 + "╗")
     print("║" + " " * 15 + "ESP32 MODEL EXPORT TOOL" + " " * 20 + "║")
@@ -402,17 +4111,86 @@ if __name__ == "__main__":
     # Load artifacts
     model, scaler, label_encoder = load_artifacts()
     
+    # Flat trees shared by every exporter below. Every check raises
+    # ExportCheckError before its output is written
+    scaled_trees = flatten_forest(model)
+    raw_thresholds = CONFIG['fold_scaler']
+    trees = fold_scaler(scaled_trees, scaler) if raw_thresholds else scaled_trees
+    verify_flat_table(model, scaler, trees, raw_thresholds)
+    
+    # Golden classes, checked against the float32 thresholds of model_float.h
+    dump_golden_predictions(model, scaler, scaled_trees)
+    
     # Try micromlgen first
     micromlgen_success = export_with_micromlgen(model)
+    if not micromlgen_success:
+        export_eloquent(model, scaled_trees, CONFIG['output_header'], float32=False)
+    
+    # Leaf distributions for soft voting (before compaction merges leaves)
+    if args.soft:
+        export_soft(model, scaler, label_encoder, trees, raw_thresholds)
+    explain_trees = trees
+    
+    # model.h layout with float32 thresholds
+    export_eloquent(model, scaled_trees, CONFIG['output_header_float'])
+    
+    # Versioned binary model with leaf distributions (forest_blob.h)
+    export_blob(model, scaler, label_encoder, trees, raw_thresholds)
+    
+    # Drop dead splits and merge identical trees into weighted votes
+    n_classes = len(label_encoder.classes_)
+    weights = [1] * len(trees)
+    if CONFIG['compact_trees']:
+        trees, weights = compact_forest(trees, scaler, n_classes, raw_thresholds)
+    
+    # Evaluation order for predict_early_exit()
+    tree_order = choose_tree_order(trees, scaler, n_classes, raw_thresholds, weights)
+    
+    # Hot side of every split, for the if/else branch order
+    visits = load_node_profile(trees, weights, scaler, raw_thresholds)
     
     # Always do manual export as well (more control)
-    manual_output = export_manual(model, scaler, label_encoder)
+    manual_output = export_manual(model, scaler, label_encoder, trees, raw_thresholds, tree_order,
+                                  weights, visits)
+    
+    # The table backends count one vote per tree
+    table_trees = expand_weighted(trees, weights)
+    
+    # Flat node table for forest_runtime.h
+    export_flat_table(model, scaler, label_encoder, table_trees, raw_thresholds, explain_trees)
+    
+    # Integer-only PROGMEM forest for the Arduino Nano (forest_nano.h)
+    export_nano(model, scaler, label_encoder, table_trees, raw_thresholds)
+    
+    # QuickScorer bitvectors for forest_quickscorer.h
+    if args.quickscorer:
+        export_quickscorer(model, scaler, label_encoder, table_trees, raw_thresholds)
+    
+    # C++17 constexpr trees for forest_constexpr.h
+    if args.constexpr:
+        export_constexpr(model, scaler, label_encoder, table_trees, raw_thresholds)
+    
+    # One class per threshold box for forest_lut.h
+    if args.lut:
+        export_lut(model, scaler, label_encoder, trees, weights, raw_thresholds)
+    
+    # 4-byte nodes for large forests (forest_compact.h)
+    if args.compact:
+        export_compact(model, scaler, label_encoder, table_trees, raw_thresholds)
+    
+    # Physics prefilter in front of the flat table (forest_cascade.h)
+    if args.cascade:
+        export_cascade(model, scaler, label_encoder, trees, weights, raw_thresholds)
+    
+    # Fastest backend within the flash budget on this host (model_best.h)
+    if args.autotune:
+        autotune_backends(trees, table_trees, scaler, raw_thresholds, n_classes)
     
     # Verify export
     verify_export(model, scaler, label_encoder)
     
     # Generate guide
-    generate_esp32_usage_guide()
+    generate_esp32_usage_guide(label_encoder)
     
     print("\n" + "=" * 70)
     print("🎉 EXPORT COMPLETE!")
@@ -420,9 +4198,25 @@ if __name__ == "__main__":
     
     if micromlgen_success:
         print(f"\n✅ micromlgen export: {CONFIG['output_header']}")
+    else:
+        print(f"\n✅ Eloquent export (micromlgen layout): {CONFIG['output_header']}")
     
     print(f"✅ Manual export: {CONFIG['output_header_manual']}")
-    print(f"✅ Usage guide: ESP32_USAGE_GUIDE.txt")
+    print(f"✅ Flat table export: {CONFIG['output_header_table']}")
+    print(f"✅ Float32 Eloquent export: {CONFIG['output_header_float']}")
+    print(f"✅ Arduino Nano integer export: {CONFIG['output_header_nano']}")
+    print(f"✅ Binary model blob: {CONFIG['output_blob']}")
+    for flag, key, text in OPTIONAL_EXPORTS:
+        if getattr(args, flag):
+            print(f"✅ {text[0].upper() + text[1:]}: {CONFIG[key]}")
+    if args.autotune:
+        print(f"✅ Autotuned backend: {CONFIG['output_header_best']}")
+    stale = [(flag, key) for flag, key, _ in OPTIONAL_EXPORTS + [('autotune', 'output_header_best', '')]
+             if not getattr(args, flag) and os.path.exists(CONFIG[key])]
+    for flag, key in stale:
+        print(f"⚠️  {os.path.basename(CONFIG[key])} not rewritten, it may be from another model "
+              f"(--{flag} or --all)")
+    print(f"✅ Usage guide: {', '.join(CONFIG['output_guides'])}")
     
     print("\n📋 NEXT STEPS:")
     print("   1. Copy model_manual.h to your ESP32 Arduino project")
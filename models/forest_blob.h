@@ -0,0 +1,245 @@
+/*
+ * Solar Panel Fault Detection - Binary Model Blob
+ *
+ * A forest as one versioned, checksummed block of bytes (solar_forest.bin,
+ * written by ml/step3_export_to_esp32.py), so a new model can be shipped
+ * without rebuilding the firmware or loading joblib on the host.
+ *
+ * Layout, little-endian, every section 4-byte aligned:
+ *
+ *   ForestBlobHeader
+ *   nodes    ForestNode[num_nodes]        (same records as model_table.h)
+ *   roots    uint16_t[num_trees]
+ *   scaler   float mean[num_features], float std[num_features]
+ *            (only with FOREST_BLOB_SCALER; thresholds are raw otherwise)
+ *   names    class names, then feature names, each NUL-terminated
+ *   proba    float[num_nodes][num_classes], each leaf's class distribution
+ *            (only with FOREST_BLOB_PROBA; rows of splits are zero unless
+ *            FOREST_BLOB_NODE_PROBA, which forest_blob_predict_explain needs)
+ *
+ * forest_blob_open() validates a blob in place and points a Forest at it
+ * without copying, so it works on mmap()ed files and memory-mapped flash
+ * partitions alike. forest_blob_loader.h maps blobs and swaps them at
+ * runtime.
+ */
+
+#ifndef SOLAR_FOREST_BLOB_H
+#define SOLAR_FOREST_BLOB_H
+
+#include <string.h>
+
+#include "forest_runtime.h"
+
+#define FOREST_BLOB_MAGIC 0x46524653u   // "SFRF"
+#define FOREST_BLOB_VERSION 1
+
+// ForestBlobHeader::flags
+#define FOREST_BLOB_SCALER 0x1u
+#define FOREST_BLOB_PROBA 0x2u
+#define FOREST_BLOB_NODE_PROBA 0x4u
+
+struct ForestBlobHeader {
+    uint32_t magic;           // FOREST_BLOB_MAGIC
+    uint16_t format_version;  // FOREST_BLOB_VERSION
+    uint16_t header_size;     // sizeof(ForestBlobHeader)
+    uint32_t total_size;      // Header and payload, in bytes
+    uint32_t checksum;        // CRC-32 of everything after the header
+    uint32_t model_version;   // CONFIG['blob_model_version'] of the export
+    uint32_t num_nodes;
+    uint16_t num_trees;
+    uint8_t num_features;
+    uint8_t num_classes;
+    uint32_t flags;
+    uint32_t nodes_offset;    // Section offsets from the start of the blob
+    uint32_t roots_offset;
+    uint32_t scaler_offset;
+    uint32_t names_offset;
+    uint32_t names_size;
+    uint32_t proba_offset;
+};
+
+enum ForestBlobStatus {
+    FOREST_BLOB_OK = 0,
+    FOREST_BLOB_TRUNCATED,     // Shorter than its header says, or misaligned
+    FOREST_BLOB_BAD_MAGIC,
+    FOREST_BLOB_BAD_VERSION,
+    FOREST_BLOB_BAD_CHECKSUM,
+    FOREST_BLOB_BAD_LAYOUT,    // Sections or counts out of range
+    FOREST_BLOB_BAD_TREE,      // A node points outside its table or class range
+    FOREST_BLOB_NO_MEMORY,
+    FOREST_BLOB_NOT_FOUND,
+};
+
+// A validated blob; every pointer refers into the blob's own memory
+// except the name arrays. Do not copy it once opened (forest.class_names
+// points at class_names).
+struct ForestBlob {
+    Forest forest;
+    const char* class_names[FOREST_MAX_CLASSES];
+    const char* feature_names[FOREST_MAX_FEATURES];
+    const float* leaf_proba;    // NULL without FOREST_BLOB_PROBA
+    const float* node_proba;    // Same rows, NULL without FOREST_BLOB_NODE_PROBA
+    uint32_t model_version;
+    uint32_t checksum;
+};
+
+inline const char* forest_blob_error(ForestBlobStatus status) {
+    switch (status) {
+        case FOREST_BLOB_OK: return "ok";
+        case FOREST_BLOB_TRUNCATED: return "truncated or misaligned blob";
+        case FOREST_BLOB_BAD_MAGIC: return "not a forest blob";
+        case FOREST_BLOB_BAD_VERSION: return "unsupported blob version";
+        case FOREST_BLOB_BAD_CHECKSUM: return "checksum mismatch";
+        case FOREST_BLOB_BAD_LAYOUT: return "bad section layout";
+        case FOREST_BLOB_BAD_TREE: return "bad tree structure";
+        case FOREST_BLOB_NO_MEMORY: return "out of memory";
+        case FOREST_BLOB_NOT_FOUND: return "blob not found";
+    }
+    return "unknown error";
+}
+
+// CRC-32 (zlib polynomial), bitwise so it needs no table in RAM
+inline uint32_t forest_crc32(const uint8_t* data, size_t size) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+// True when [offset, offset + bytes) lies inside the blob and is aligned
+inline bool forest_blob_section(const ForestBlobHeader* header, uint32_t offset, uint64_t bytes) {
+    return offset % 4 == 0 && offset >= header->header_size && offset + bytes <= header->total_size;
+}
+
+// Validate `size` bytes at `data` and point blob->forest into them.
+// `data` must stay mapped, and 4-byte aligned, while the forest is used.
+inline ForestBlobStatus forest_blob_open(ForestBlob* blob, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    const ForestBlobHeader* header = (const ForestBlobHeader*)data;
+    if ((uintptr_t)data % 4 != 0 || size < sizeof(ForestBlobHeader)) return FOREST_BLOB_TRUNCATED;
+    if (header->magic != FOREST_BLOB_MAGIC) return FOREST_BLOB_BAD_MAGIC;
+    if (header->format_version != FOREST_BLOB_VERSION) return FOREST_BLOB_BAD_VERSION;
+    if (header->header_size < sizeof(ForestBlobHeader) || header->total_size < header->header_size) {
+        return FOREST_BLOB_BAD_LAYOUT;
+    }
+    if (header->total_size > size) return FOREST_BLOB_TRUNCATED;
+    if (forest_crc32(bytes + header->header_size, header->total_size - header->header_size) != header->checksum) {
+        return FOREST_BLOB_BAD_CHECKSUM;
+    }
+
+    bool scaler = (header->flags & FOREST_BLOB_SCALER) != 0;
+    bool proba = (header->flags & FOREST_BLOB_PROBA) != 0;
+    bool node_proba = (header->flags & FOREST_BLOB_NODE_PROBA) != 0;
+    if (header->num_trees == 0 || header->num_nodes == 0 || header->num_nodes > 0xFFFF ||
+        (node_proba && !proba) || header->num_features == 0 || header->num_features > FOREST_MAX_FEATURES ||
+        header->num_classes == 0 || header->num_classes > FOREST_MAX_CLASSES ||
+        !forest_blob_section(header, header->nodes_offset, (uint64_t)header->num_nodes * sizeof(ForestNode)) ||
+        !forest_blob_section(header, header->roots_offset, (uint64_t)header->num_trees * sizeof(uint16_t)) ||
+        (scaler && !forest_blob_section(header, header->scaler_offset, 2ull * header->num_features * sizeof(float))) ||
+        (proba && !forest_blob_section(header, header->proba_offset,
+                                       (uint64_t)header->num_nodes * header->num_classes * sizeof(float))) ||
+        header->names_offset < header->header_size ||
+        (uint64_t)header->names_offset + header->names_size > header->total_size) {
+        return FOREST_BLOB_BAD_LAYOUT;
+    }
+
+    // Every tree stays inside the table and ends in known classes
+    const ForestNode* nodes = (const ForestNode*)(bytes + header->nodes_offset);
+    const uint16_t* roots = (const uint16_t*)(bytes + header->roots_offset);
+    for (uint32_t i = 0; i < header->num_nodes; i++) {
+        if (nodes[i].feature == FOREST_LEAF) {
+            if (nodes[i].value >= header->num_classes) return FOREST_BLOB_BAD_TREE;
+        } else if (nodes[i].feature >= header->num_features || nodes[i].right < 2 ||
+                   i + nodes[i].right >= header->num_nodes) {
+            return FOREST_BLOB_BAD_TREE;
+        }
+    }
+    for (int t = 0; t < header->num_trees; t++) {
+        if (roots[t] >= header->num_nodes) return FOREST_BLOB_BAD_TREE;
+    }
+
+    // Class names, then feature names
+    const char* name = (const char*)(bytes + header->names_offset);
+    const char* end = name + header->names_size;
+    int count = header->num_classes + header->num_features;
+    for (int i = 0; i < count; i++) {
+        const char* nul = (const char*)memchr(name, '\0', end - name);
+        if (!nul) return FOREST_BLOB_BAD_LAYOUT;
+        if (i < header->num_classes) {
+            blob->class_names[i] = name;
+        } else {
+            blob->feature_names[i - header->num_classes] = name;
+        }
+        name = nul + 1;
+    }
+
+    const float* scaler_data = scaler ? (const float*)(bytes + header->scaler_offset) : NULL;
+    blob->forest.nodes = nodes;
+    blob->forest.roots = roots;
+    blob->forest.num_trees = header->num_trees;
+    blob->forest.num_features = header->num_features;
+    blob->forest.num_classes = header->num_classes;
+    blob->forest.scaler_mean = scaler_data;
+    blob->forest.scaler_std = scaler ? scaler_data + header->num_features : NULL;
+    blob->forest.class_names = blob->class_names;
+    blob->leaf_proba = proba ? (const float*)(bytes + header->proba_offset) : NULL;
+    blob->node_proba = node_proba ? blob->leaf_proba : NULL;
+    blob->model_version = header->model_version;
+    blob->checksum = header->checksum;
+    return FOREST_BLOB_OK;
+}
+
+// Mean leaf distribution over the trees, as sklearn's predict_proba(),
+// into proba[num_classes]; returns its argmax (ties go to the lowest
+// class index, as numpy's argmax). Without FOREST_BLOB_PROBA every leaf
+// counts as one vote for its class.
+inline int forest_blob_predict_proba(const ForestBlob* blob, const float* raw_features, float* proba) {
+    const Forest* forest = &blob->forest;
+    float scaled[FOREST_MAX_FEATURES];
+    forest_scale(forest, raw_features, scaled);
+
+    double sum[FOREST_MAX_CLASSES] = {0};
+    for (int t = 0; t < forest->num_trees; t++) {
+        const ForestNode* leaf = forest_tree_leaf(forest->nodes + forest->roots[t], scaled);
+        if (blob->leaf_proba) {
+            const float* dist = blob->leaf_proba + (size_t)(leaf - forest->nodes) * forest->num_classes;
+            for (int c = 0; c < forest->num_classes; c++) {
+                sum[c] += dist[c];
+            }
+        } else {
+            sum[leaf->value] += 1.0;
+        }
+    }
+
+    int predicted_class = 0;
+    for (int c = 0; c < forest->num_classes; c++) {
+        proba[c] = (float)(sum[c] / forest->num_trees);
+        if (sum[c] > sum[predicted_class]) {
+            predicted_class = c;
+        }
+    }
+    return predicted_class;
+}
+
+// forest_predict_explain() over the blob's node distributions, with
+// class_idx the argmax of the same double sums forest_blob_predict_proba()
+// picks it from (score is its proba, bit for bit). Returns class_idx, or
+// -1 when the blob has no FOREST_BLOB_NODE_PROBA.
+inline int forest_blob_predict_explain(const ForestBlob* blob, const float* raw_features,
+                                       ForestExplanation* explanation) {
+    if (!blob->node_proba) return -1;
+    double sum[FOREST_MAX_CLASSES];
+    forest_explain_walk(&blob->forest, blob->node_proba, raw_features, explanation, sum);
+    int predicted_class = 0;
+    for (int c = 1; c < blob->forest.num_classes; c++) {
+        if (sum[c] > sum[predicted_class]) predicted_class = c;
+    }
+    explanation->class_idx = predicted_class;
+    return predicted_class;
+}
+
+#endif // SOLAR_FOREST_BLOB_H
@@ -0,0 +1,218 @@
+/*
+ * Solar Panel Fault Detection - Blob Loading and Hot Swap
+ *
+ * Maps a forest blob (forest_blob.h) without copying where the platform
+ * allows it and keeps it alive while anything still predicts with it:
+ *
+ *   Linux / POSIX   forest_blob_map_file()       mmap() of the file
+ *   ESP32 (IDF)     forest_blob_map_partition()  esp_partition_mmap() of a
+ *                                                data partition, read from flash
+ *   ESP32 Arduino   forest_blob_read_file()      LittleFS (or any fs::FS)
+ *                                                file, read into the heap
+ *   anywhere        forest_blob_read_path()      stdio read into the heap
+ *
+ * A ForestSlot holds the active model. forest_slot_swap() replaces it
+ * atomically: predictions already running finish on the old model, every
+ * later one sees the new one, and the old blob is unmapped when its last
+ * user lets go. A blob that fails validation is never swapped in.
+ */
+
+#ifndef SOLAR_FOREST_BLOB_LOADER_H
+#define SOLAR_FOREST_BLOB_LOADER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <memory>
+#include <new>
+
+#include "forest_blob.h"
+
+#if defined(ESP_PLATFORM)
+#include <esp_idf_version.h>
+#include <esp_partition.h>
+#endif
+
+#if defined(ARDUINO) && defined(ESP_PLATFORM)
+#include <FS.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// A validated blob together with the memory it lives in
+struct ForestBlobModel {
+    ForestBlob blob;
+    const void* memory;
+    size_t size;
+    uintptr_t handle;                                 // Platform mapping handle
+    void (*release)(const void* memory, size_t size, uintptr_t handle);
+
+    ForestBlobModel() : memory(NULL), size(0), handle(0), release(NULL) {}
+    ~ForestBlobModel() {
+        if (release) release(memory, size, handle);
+    }
+
+private:
+    ForestBlobModel(const ForestBlobModel&);
+    ForestBlobModel& operator=(const ForestBlobModel&);
+};
+
+typedef std::shared_ptr<const ForestBlobModel> ForestModelPtr;
+
+inline void forest_blob_free(const void* memory, size_t, uintptr_t) {
+    free(const_cast<void*>(memory));
+}
+
+// Validate memory and take ownership of it; `release` runs when the last
+// reference goes away, and right away when validation fails
+inline ForestModelPtr forest_blob_adopt(const void* memory, size_t size, uintptr_t handle,
+                                        void (*release)(const void*, size_t, uintptr_t),
+                                        ForestBlobStatus* status) {
+    ForestBlobModel* model = new (std::nothrow) ForestBlobModel();
+    if (!model) {
+        if (release) release(memory, size, handle);
+        *status = FOREST_BLOB_NO_MEMORY;
+        return ForestModelPtr();
+    }
+    model->memory = memory;
+    model->size = size;
+    model->handle = handle;
+    model->release = release;
+    ForestModelPtr owned(model);
+    *status = forest_blob_open(&model->blob, memory, size);
+    return *status == FOREST_BLOB_OK ? owned : ForestModelPtr();
+}
+
+// Read a whole file into the heap (portable fallback, one copy)
+inline ForestModelPtr forest_blob_read_path(const char* path, ForestBlobStatus* status) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        *status = FOREST_BLOB_NOT_FOUND;
+        return ForestModelPtr();
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    void* memory = size > 0 ? malloc((size_t)size) : NULL;
+    if (!memory) {
+        fclose(file);
+        *status = size > 0 ? FOREST_BLOB_NO_MEMORY : FOREST_BLOB_TRUNCATED;
+        return ForestModelPtr();
+    }
+    size_t read = fread(memory, 1, (size_t)size, file);
+    fclose(file);
+    return forest_blob_adopt(memory, read, 0, forest_blob_free, status);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+inline void forest_blob_unmap(const void* memory, size_t size, uintptr_t) {
+    munmap(const_cast<void*>(memory), size);
+}
+
+// mmap() a blob file read-only; pages are shared with the page cache
+inline ForestModelPtr forest_blob_map_file(const char* path, ForestBlobStatus* status) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        *status = FOREST_BLOB_NOT_FOUND;
+        return ForestModelPtr();
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        *status = FOREST_BLOB_TRUNCATED;
+        return ForestModelPtr();
+    }
+    size_t size = (size_t)info.st_size;
+    void* memory = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        *status = FOREST_BLOB_NO_MEMORY;
+        return ForestModelPtr();
+    }
+    return forest_blob_adopt(memory, size, 0, forest_blob_unmap, status);
+}
+#endif
+
+#if defined(ESP_PLATFORM)
+#if ESP_IDF_VERSION_MAJOR >= 5
+typedef esp_partition_mmap_handle_t forest_partition_handle_t;
+#define FOREST_PARTITION_MMAP_DATA ESP_PARTITION_MMAP_DATA
+#define forest_partition_munmap esp_partition_munmap
+#else
+typedef spi_flash_mmap_handle_t forest_partition_handle_t;
+#define FOREST_PARTITION_MMAP_DATA SPI_FLASH_MMAP_DATA
+#define forest_partition_munmap spi_flash_munmap
+#endif
+
+inline void forest_blob_partition_unmap(const void*, size_t, uintptr_t handle) {
+    forest_partition_munmap((forest_partition_handle_t)handle);
+}
+
+// Map a data partition holding a blob (flash it with
+// `parttool.py write_partition --partition-name <label> --input solar_forest.bin`);
+// nodes are read through the flash cache, no RAM copy
+inline ForestModelPtr forest_blob_map_partition(const char* label, ForestBlobStatus* status) {
+    const esp_partition_t* partition =
+        esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (!partition) {
+        *status = FOREST_BLOB_NOT_FOUND;
+        return ForestModelPtr();
+    }
+    const void* memory = NULL;
+    forest_partition_handle_t handle;
+    if (esp_partition_mmap(partition, 0, partition->size, FOREST_PARTITION_MMAP_DATA, &memory, &handle) != ESP_OK) {
+        *status = FOREST_BLOB_NO_MEMORY;
+        return ForestModelPtr();
+    }
+    return forest_blob_adopt(memory, partition->size, (uintptr_t)handle, forest_blob_partition_unmap, status);
+}
+#endif
+
+#if defined(ARDUINO) && defined(ESP_PLATFORM)
+// Read a blob from LittleFS (or SPIFFS, SD) into the heap; LittleFS files
+// cannot be memory-mapped
+inline ForestModelPtr forest_blob_read_file(fs::FS& fs, const char* path, ForestBlobStatus* status) {
+    fs::File file = fs.open(path, "r");
+    if (!file) {
+        *status = FOREST_BLOB_NOT_FOUND;
+        return ForestModelPtr();
+    }
+    size_t size = file.size();
+    void* memory = size ? malloc(size) : NULL;
+    if (!memory) {
+        *status = size ? FOREST_BLOB_NO_MEMORY : FOREST_BLOB_TRUNCATED;
+        return ForestModelPtr();
+    }
+    size_t read = file.read((uint8_t*)memory, size);
+    return forest_blob_adopt(memory, read, 0, forest_blob_free, status);
+}
+#endif
+
+// The model predictions currently run on
+struct ForestSlot {
+    ForestModelPtr model;
+};
+
+// Current model; hold the pointer for as long as its forest is used
+inline ForestModelPtr forest_slot_get(const ForestSlot* slot) {
+    return std::atomic_load(&slot->model);
+}
+
+// Make `model` the current one; returns false (and keeps the old one) when it is empty
+inline bool forest_slot_swap(ForestSlot* slot, const ForestModelPtr& model) {
+    if (!model) return false;
+    std::atomic_store(&slot->model, model);
+    return true;
+}
+
+// Predict with the current model - returns class index, -1 before the first swap
+inline int forest_slot_predict(const ForestSlot* slot, const float* raw_features) {
+    ForestModelPtr model = forest_slot_get(slot);
+    return model ? forest_predict(&model->blob.forest, raw_features) : -1;
+}
+
+#endif // SOLAR_FOREST_BLOB_LOADER_H
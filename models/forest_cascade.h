@@ -0,0 +1,85 @@
+/*
+ * Solar Panel Fault Detection - Two-Stage Cascade Runtime
+ *
+ * A tiny first stage in front of a flat forest (forest_runtime.h), for
+ * cascades exported as model_cascade.h. Most readings are plainly Normal:
+ * voltage and current are what the light level predicts. The first stage
+ * is a depth-2 tree over the raw features plus the panel efficiency
+ * (panel_efficiency.h, the quantity the backend's calculate_efficiency()
+ * reports). Its leaves either give a class right away or send the reading
+ * on to the full forest.
+ *
+ * The exporter trains the first stage on the forest's own predictions, so
+ * short-circuited readings agree with the forest on the datasets to
+ * within CONFIG['cascade_min_precision']. benchmarks/bench_cascade.cpp
+ * replays both datasets and reports the share short-circuited and the
+ * accuracy change.
+ */
+
+#ifndef SOLAR_FOREST_CASCADE_H
+#define SOLAR_FOREST_CASCADE_H
+
+#include "forest_runtime.h"
+#include "panel_efficiency.h"
+
+// CascadeSplit::feature of the derived efficiency value
+#define CASCADE_EFFICIENCY 0xFE
+
+// CascadeSplit::feature of a child that is a single leaf
+#define CASCADE_LEAF 0xFF
+
+// Leaf value that defers to the full forest
+#define CASCADE_FOREST 0xFF
+
+// Go left when value(feature) <= threshold
+struct CascadeSplit {
+    float threshold;
+    uint8_t feature;     // Raw feature index, CASCADE_EFFICIENCY or CASCADE_LEAF
+};
+
+// The first stage: root split, one split per child and four leaves
+// (leaves[2 * side + child side]; a CASCADE_LEAF child uses leaves[2 * side])
+struct CascadePrefilter {
+    CascadeSplit root;
+    CascadeSplit children[2];
+    uint8_t leaves[4];          // Class index or CASCADE_FOREST
+    uint8_t voltage_feature;    // Inputs of panel_efficiency()
+    uint8_t current_feature;
+    uint8_t light_feature;
+};
+
+// One input of the first stage: a raw feature or the efficiency
+inline float cascade_value(const CascadePrefilter* prefilter, const float* raw_features, uint8_t feature) {
+    if (feature != CASCADE_EFFICIENCY) {
+        return raw_features[feature];
+    }
+    return panel_efficiency(raw_features[prefilter->voltage_feature], raw_features[prefilter->current_feature],
+                            raw_features[prefilter->light_feature]);
+}
+
+// First stage only - returns a class index, or CASCADE_FOREST when the
+// reading needs the full forest
+inline int cascade_prefilter(const CascadePrefilter* prefilter, const float* raw_features) {
+    const CascadeSplit* root = &prefilter->root;
+    if (root->feature == CASCADE_LEAF) {
+        return prefilter->leaves[0];
+    }
+    int side = (cascade_value(prefilter, raw_features, root->feature) <= root->threshold) ? 0 : 1;
+    const CascadeSplit* child = &prefilter->children[side];
+    int leaf = 2 * side;
+    if (child->feature != CASCADE_LEAF) {
+        leaf += (cascade_value(prefilter, raw_features, child->feature) <= child->threshold) ? 0 : 1;
+    }
+    return prefilter->leaves[leaf];
+}
+
+// Main prediction function - returns class index
+inline int cascade_forest_predict(const CascadePrefilter* prefilter, const Forest* forest, const float* raw_features) {
+    int predicted_class = cascade_prefilter(prefilter, raw_features);
+    if (predicted_class != CASCADE_FOREST) {
+        return predicted_class;
+    }
+    return forest_predict(forest, raw_features);
+}
+
+#endif // SOLAR_FOREST_CASCADE_H
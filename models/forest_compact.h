@@ -0,0 +1,126 @@
+/*
+ * Solar Panel Fault Detection - Compact Forest Runtime
+ *
+ * Traversal for large forests exported as model_compact.h (hundreds of
+ * trees, depth 10 and more, any number of classes). Nodes are 4 bytes
+ * instead of the 8 of ForestNode: a split stores the index of its
+ * threshold in a sorted per-feature table instead of the float itself.
+ *
+ * Each reading is first mapped to one bin per feature (the number of
+ * thresholds below it, by binary search). x <= thresholds[k] holds
+ * exactly when bin <= k, so every split is then an integer compare and
+ * the thresholds are only read once per feature, not once per node.
+ *
+ * Votes are counted in uint16_t, so up to 65535 trees. The data header
+ * defines FOREST_COMPACT_MAX_CLASSES before including this file.
+ */
+
+#ifndef SOLAR_FOREST_COMPACT_H
+#define SOLAR_FOREST_COMPACT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ForestCompactNode::key of a leaf; the low 12 bits hold the class
+#define FOREST_COMPACT_LEAF 0xF000
+
+#ifndef FOREST_COMPACT_MAX_FEATURES
+#define FOREST_COMPACT_MAX_FEATURES 15
+#endif
+
+#ifndef FOREST_COMPACT_MAX_CLASSES
+#define FOREST_COMPACT_MAX_CLASSES 16
+#endif
+
+// One split or leaf (4 bytes)
+struct ForestCompactNode {
+    uint16_t key;    // Splits: feature << 12 | threshold index, leaves: FOREST_COMPACT_LEAF | class
+    uint16_t right;  // Distance to the right child (splits only)
+};
+
+// A complete exported forest
+struct CompactForest {
+    const ForestCompactNode* nodes;  // All trees, back to back, in pre-order
+    const uint32_t* roots;           // Index of each tree's root in nodes
+    const float* thresholds;         // Ascending within each feature
+    const uint16_t* feature_offsets; // Thresholds of feature f: [offsets[f], offsets[f + 1])
+    uint16_t num_trees;
+    uint8_t num_features;
+    uint16_t num_classes;
+    const float* scaler_mean;        // StandardScaler parameters, NULL when the
+    const float* scaler_std;         // thresholds are already in raw units
+    const char* const* class_names;
+};
+
+// Number of thresholds below x; NaN fails every comparison and lands
+// past the last threshold, so it goes right at every split as in the trees
+inline uint16_t compact_forest_bin(const float* thresholds, int count, float x) {
+    int lo = 0;
+    int hi = count;
+    while (lo < hi) {
+        int mid = (lo + hi) >> 1;
+        if (x <= thresholds[mid]) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return (uint16_t)lo;
+}
+
+// Bin of every feature for one reading
+inline void compact_forest_bins(const CompactForest* forest, const float* raw_features, uint16_t* bins) {
+    for (int f = 0; f < forest->num_features; f++) {
+        float x = raw_features[f];
+        if (forest->scaler_mean) {
+            x = (x - forest->scaler_mean[f]) / forest->scaler_std[f];
+        }
+        int begin = forest->feature_offsets[f];
+        bins[f] = compact_forest_bin(forest->thresholds + begin, forest->feature_offsets[f + 1] - begin, x);
+    }
+}
+
+// Walk one tree on binned features - returns the leaf class
+inline int compact_tree_predict(const ForestCompactNode* node, const uint16_t* bins) {
+    while ((node->key & FOREST_COMPACT_LEAF) != FOREST_COMPACT_LEAF) {
+        node += (bins[node->key >> 12] <= (node->key & 0x0FFF)) ? 1 : node->right;
+    }
+    return node->key & 0x0FFF;
+}
+
+// Add each tree's vote to votes[num_classes]
+inline void compact_forest_vote(const CompactForest* forest, const uint16_t* bins, uint16_t* votes) {
+    for (int c = 0; c < forest->num_classes; c++) {
+        votes[c] = 0;
+    }
+    for (int t = 0; t < forest->num_trees; t++) {
+        votes[compact_tree_predict(forest->nodes + forest->roots[t], bins)]++;
+    }
+}
+
+// Majority vote (ties go to the lowest class index)
+inline int compact_forest_argmax(const uint16_t* votes, int num_classes) {
+    int predicted_class = 0;
+    for (int c = 1; c < num_classes; c++) {
+        if (votes[c] > votes[predicted_class]) {
+            predicted_class = c;
+        }
+    }
+    return predicted_class;
+}
+
+// Main prediction function - returns class index
+inline int compact_forest_predict(const CompactForest* forest, const float* raw_features) {
+    uint16_t bins[FOREST_COMPACT_MAX_FEATURES];
+    uint16_t votes[FOREST_COMPACT_MAX_CLASSES];
+    compact_forest_bins(forest, raw_features, bins);
+    compact_forest_vote(forest, bins, votes);
+    return compact_forest_argmax(votes, forest->num_classes);
+}
+
+// Get the class name string from prediction
+inline const char* compact_forest_predict_class_name(const CompactForest* forest, const float* raw_features) {
+    return forest->class_names[compact_forest_predict(forest, raw_features)];
+}
+
+#endif // SOLAR_FOREST_COMPACT_H
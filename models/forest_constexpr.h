@@ -0,0 +1,110 @@
+/*
+ * Solar Panel Fault Detection - Compile-Time Forest Runtime (C++17)
+ *
+ * Traversal for forests exported as model_constexpr.h. The node table is
+ * constexpr ForestNode data (same layout as model_table.h), and each tree
+ * is instantiated from it as a template: `if constexpr` on the node kind
+ * unrolls the tree into nested compares with constant thresholds, so the
+ * compiler sees the same code as the hand-written if/else trees.
+ *
+ * The same table also works with the table-driven forest_predict(), and
+ * every function here is constexpr, so both paths can be evaluated and
+ * compared inside static_assert.
+ */
+
+#ifndef SOLAR_FOREST_CONSTEXPR_H
+#define SOLAR_FOREST_CONSTEXPR_H
+
+#if __cplusplus < 201703L
+#error "forest_constexpr.h needs C++17 (-std=c++17)"
+#endif
+
+#include <utility>
+
+#include "forest_runtime.h"
+
+// Leaf class of the tree rooted at Nodes[I], unrolled at compile time
+template <const ForestNode* Nodes, int I>
+constexpr int forest_cx_tree(const float* x) {
+    if constexpr (Nodes[I].feature == FOREST_LEAF) {
+        return Nodes[I].value;
+    } else {
+        return (x[Nodes[I].feature] <= Nodes[I].threshold)
+            ? forest_cx_tree<Nodes, I + 1>(x)
+            : forest_cx_tree<Nodes, I + Nodes[I].right>(x);
+    }
+}
+
+// Add each tree's vote to votes[num_classes]
+template <const ForestNode* Nodes, const uint16_t* Roots, size_t... T>
+constexpr void forest_cx_vote(const float* x, int* votes, std::index_sequence<T...>) {
+    ((votes[forest_cx_tree<Nodes, Roots[T]>(x)]++), ...);
+}
+
+// Majority vote (ties go to the lowest class index)
+constexpr int forest_cx_argmax(const int* votes, int num_classes) {
+    int predicted_class = 0;
+    for (int i = 1; i < num_classes; i++) {
+        if (votes[i] > votes[predicted_class]) {
+            predicted_class = i;
+        }
+    }
+    return predicted_class;
+}
+
+// Template-instantiated prediction - x must already be in threshold units
+template <const ForestNode* Nodes, const uint16_t* Roots, int NumTrees, int NumClasses>
+constexpr int forest_cx_predict(const float* x) {
+    int votes[NumClasses] = {};
+    forest_cx_vote<Nodes, Roots>(x, votes, std::make_index_sequence<NumTrees>{});
+    return forest_cx_argmax(votes, NumClasses);
+}
+
+// Table-driven prediction over the same data (mirrors forest_predict_scaled)
+constexpr int forest_cx_table_predict(const ForestNode* nodes, const uint16_t* roots,
+                                      int num_trees, int num_classes, const float* x) {
+    int votes[FOREST_MAX_CLASSES] = {};
+    for (int t = 0; t < num_trees; t++) {
+        const ForestNode* node = nodes + roots[t];
+        while (node->feature != FOREST_LEAF) {
+            node += (x[node->feature] <= node->threshold) ? 1 : node->right;
+        }
+        votes[node->value]++;
+    }
+    return forest_cx_argmax(votes, num_classes);
+}
+
+// Depth of the subtree at nodes[i] (a single leaf has depth 0)
+constexpr int forest_cx_depth(const ForestNode* nodes, int i) {
+    if (nodes[i].feature == FOREST_LEAF) {
+        return 0;
+    }
+    int left = forest_cx_depth(nodes, i + 1);
+    int right = forest_cx_depth(nodes, i + nodes[i].right);
+    return 1 + (left > right ? left : right);
+}
+
+constexpr int forest_cx_max_depth(const ForestNode* nodes, const uint16_t* roots, int num_trees) {
+    int depth = 0;
+    for (int t = 0; t < num_trees; t++) {
+        int d = forest_cx_depth(nodes, roots[t]);
+        depth = d > depth ? d : depth;
+    }
+    return depth;
+}
+
+// Every split uses a known feature and stays inside the table,
+// every leaf holds a known class
+constexpr bool forest_cx_valid(const ForestNode* nodes, int num_nodes, int num_features, int num_classes) {
+    for (int i = 0; i < num_nodes; i++) {
+        if (nodes[i].feature == FOREST_LEAF) {
+            if (nodes[i].value >= num_classes) return false;
+        } else {
+            if (nodes[i].feature >= num_features) return false;
+            if (nodes[i].right < 2 || i + nodes[i].right >= num_nodes) return false;
+        }
+    }
+    return true;
+}
+
+#endif // SOLAR_FOREST_CONSTEXPR_H
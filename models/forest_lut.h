@@ -0,0 +1,64 @@
+/*
+ * Solar Panel Fault Detection - Dense Lookup Table Runtime
+ *
+ * Lookup for forests exported as model_lut.h. The distinct thresholds of
+ * each feature, taken over all trees, cut its axis into bins, and every
+ * combination of bins is a box in which the whole forest gives one class.
+ * The exporter evaluates the forest once per box, so a prediction is one
+ * short threshold count per feature plus a single table load.
+ */
+
+#ifndef SOLAR_FOREST_LUT_H
+#define SOLAR_FOREST_LUT_H
+
+#include "forest_runtime.h"
+
+// A complete exported forest as a dense class table
+struct ForestLut {
+    const float* thresholds;         // Ascending within each feature
+    const uint16_t* feature_offsets; // Thresholds of feature f: [offsets[f], offsets[f + 1])
+    const uint32_t* strides;         // Table index step per bin of each feature
+    const uint8_t* classes;          // Forest class of every box
+    uint8_t num_features;
+    uint8_t num_classes;
+    const float* scaler_mean;        // StandardScaler parameters, NULL when the
+    const float* scaler_std;         // thresholds are already in raw units
+    const char* const* class_names;
+};
+
+// Number of thresholds below x (the bin of x). A branch-free count is
+// cheaper than a binary search for the dozen or so edges per feature;
+// NaN fails every comparison and lands in the last bin, as it goes right
+// in the trees
+inline int forest_lut_bin(const float* thresholds, int count, float x) {
+    int bin = 0;
+    for (int i = 0; i < count; i++) {
+        bin += !(x <= thresholds[i]);
+    }
+    return bin;
+}
+
+// Predict from already scaled features - returns class index
+inline int forest_lut_predict_scaled(const ForestLut* lut, const float* scaled) {
+    uint32_t index = 0;
+    for (int f = 0; f < lut->num_features; f++) {
+        int begin = lut->feature_offsets[f];
+        int bin = forest_lut_bin(lut->thresholds + begin, lut->feature_offsets[f + 1] - begin, scaled[f]);
+        index += (uint32_t)bin * lut->strides[f];
+    }
+    return lut->classes[index];
+}
+
+// Main prediction function - returns class index
+inline int forest_lut_predict(const ForestLut* lut, const float* raw_features) {
+    if (!lut->scaler_mean) {
+        return forest_lut_predict_scaled(lut, raw_features);
+    }
+    float scaled[FOREST_MAX_FEATURES];
+    for (int i = 0; i < lut->num_features; i++) {
+        scaled[i] = (raw_features[i] - lut->scaler_mean[i]) / lut->scaler_std[i];
+    }
+    return forest_lut_predict_scaled(lut, scaled);
+}
+
+#endif // SOLAR_FOREST_LUT_H
@@ -0,0 +1,83 @@
+/*
+ * Solar Panel Fault Detection - Integer Forest Runtime (Arduino Nano)
+ *
+ * Traversal for forests exported as model_nano.h, small enough for an
+ * ATmega328P (32 KB flash, 2 KB RAM) and free of float math. Features are
+ * uint16_t readings in ADC units (1/64 of an ADC count, see the LSB
+ * table in model_nano.h) and every threshold is the largest reading that
+ * still goes left in the float model, so both make the same decision for
+ * every possible reading. Nodes live in PROGMEM; RAM use is the
+ * NanoForest struct plus one vote counter per class on the stack.
+ *
+ * Host builds read the same tables through plain pointers.
+ */
+
+#ifndef SOLAR_FOREST_NANO_H
+#define SOLAR_FOREST_NANO_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#elif !defined(PROGMEM)
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#endif
+
+// NanoNode::feature of a leaf; its threshold holds the class
+#define NANO_LEAF 0xFF
+
+#ifndef NANO_MAX_CLASSES
+#define NANO_MAX_CLASSES 16
+#endif
+
+// One split or leaf (4 bytes)
+struct NanoNode {
+    uint16_t threshold;  // Splits: go left when reading <= threshold, leaves: class
+    uint8_t feature;     // Feature index, NANO_LEAF for leaves
+    uint8_t right;       // Distance to the right child (splits only)
+};
+
+// A complete exported forest; nodes and roots are PROGMEM addresses
+struct NanoForest {
+    const NanoNode* nodes;   // All trees, back to back, in pre-order
+    const uint16_t* roots;   // Index of each tree's root in nodes
+    uint8_t num_trees;
+    uint8_t num_features;
+    uint8_t num_classes;
+};
+
+// Walk one tree - returns the leaf class
+inline uint8_t nano_tree_predict(const NanoNode* node, const uint16_t* readings) {
+    for (;;) {
+        uint8_t feature = pgm_read_byte(&node->feature);
+        uint16_t threshold = pgm_read_word(&node->threshold);
+        if (feature == NANO_LEAF) {
+            return (uint8_t)threshold;
+        }
+        node += (readings[feature] <= threshold) ? 1 : pgm_read_byte(&node->right);
+    }
+}
+
+// Main prediction function - returns class index (ties go to the lowest)
+inline uint8_t nano_forest_predict(const NanoForest* forest, const uint16_t* readings) {
+    uint8_t votes[NANO_MAX_CLASSES];
+    for (uint8_t c = 0; c < forest->num_classes; c++) {
+        votes[c] = 0;
+    }
+    for (uint8_t t = 0; t < forest->num_trees; t++) {
+        votes[nano_tree_predict(forest->nodes + pgm_read_word(forest->roots + t), readings)]++;
+    }
+
+    uint8_t predicted_class = 0;
+    for (uint8_t c = 1; c < forest->num_classes; c++) {
+        if (votes[c] > votes[predicted_class]) {
+            predicted_class = c;
+        }
+    }
+    return predicted_class;
+}
+
+#endif // SOLAR_FOREST_NANO_H
@@ -0,0 +1,94 @@
+/*
+ * Solar Panel Fault Detection - QuickScorer Runtime
+ *
+ * Bitvector evaluation for forests exported as model_quickscorer.h.
+ * Every split is a condition (threshold, tree, mask), grouped by feature
+ * with ascending thresholds. For each feature the conditions that fail
+ * (x > threshold) are a prefix of its list; each one ANDs its tree's
+ * leaf bitvector with a mask that removes the leaves of its left subtree.
+ * The exit leaf of a tree is then the lowest bit still set. No tree is
+ * walked, so there is no pointer chasing and the loop per feature stops
+ * at the first threshold >= x.
+ *
+ * The data header defines QUICKSCORER_MASK_BITS (32 or 64) and
+ * QUICKSCORER_MAX_TREES before including this file.
+ */
+
+#ifndef SOLAR_FOREST_QUICKSCORER_H
+#define SOLAR_FOREST_QUICKSCORER_H
+
+#include "forest_runtime.h"
+
+#ifndef QUICKSCORER_MASK_BITS
+#define QUICKSCORER_MASK_BITS 32
+#endif
+
+#ifndef QUICKSCORER_MAX_TREES
+#define QUICKSCORER_MAX_TREES 64
+#endif
+
+#if QUICKSCORER_MASK_BITS == 64
+typedef uint64_t qs_mask_t;
+#define QS_LOWEST_BIT(m) __builtin_ctzll(m)
+#else
+typedef uint32_t qs_mask_t;
+#define QS_LOWEST_BIT(m) __builtin_ctzl(m)  // long is >= 32 bits, int is 16 on AVR
+#endif
+
+// A complete exported forest in QuickScorer form
+struct QuickScorer {
+    const uint16_t* feature_offsets; // Conditions of feature f: [offsets[f], offsets[f + 1])
+    const float* thresholds;         // Ascending within each feature
+    const uint16_t* tree_ids;        // Tree owning each condition
+    const qs_mask_t* masks;          // Leaves kept when the condition fails
+    const uint8_t* leaf_values;      // Leaf classes, leaves_per_tree per tree
+    uint16_t leaves_per_tree;
+    uint16_t num_trees;
+    uint8_t num_features;
+    uint8_t num_classes;
+    const float* scaler_mean;        // StandardScaler parameters, NULL when the
+    const float* scaler_std;         // thresholds are already in raw units
+    const char* const* class_names;
+};
+
+// Add each tree's vote for one scaled sample to votes[num_classes]
+inline void quickscorer_vote(const QuickScorer* qs, const float* scaled, int* votes) {
+    qs_mask_t leaves[QUICKSCORER_MAX_TREES];
+    for (int t = 0; t < qs->num_trees; t++) {
+        leaves[t] = ~(qs_mask_t)0;
+    }
+
+    // Apply every failed condition; !(x <= t) also sends NaN right, as the trees do
+    for (int f = 0; f < qs->num_features; f++) {
+        float x = scaled[f];
+        int end = qs->feature_offsets[f + 1];
+        for (int i = qs->feature_offsets[f]; i < end && !(x <= qs->thresholds[i]); i++) {
+            leaves[qs->tree_ids[i]] &= qs->masks[i];
+        }
+    }
+
+    for (int t = 0; t < qs->num_trees; t++) {
+        votes[qs->leaf_values[t * qs->leaves_per_tree + QS_LOWEST_BIT(leaves[t])]]++;
+    }
+}
+
+// Predict from already scaled features - returns class index
+inline int quickscorer_predict_scaled(const QuickScorer* qs, const float* scaled) {
+    int votes[FOREST_MAX_CLASSES] = {0};
+    quickscorer_vote(qs, scaled, votes);
+    return forest_argmax(votes, qs->num_classes);
+}
+
+// Main prediction function - returns class index
+inline int quickscorer_predict(const QuickScorer* qs, const float* raw_features) {
+    if (!qs->scaler_mean) {
+        return quickscorer_predict_scaled(qs, raw_features);
+    }
+    float scaled[FOREST_MAX_FEATURES];
+    for (int i = 0; i < qs->num_features; i++) {
+        scaled[i] = (raw_features[i] - qs->scaler_mean[i]) / qs->scaler_std[i];
+    }
+    return quickscorer_predict_scaled(qs, scaled);
+}
+
+#endif // SOLAR_FOREST_QUICKSCORER_H
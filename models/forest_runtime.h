@@ -0,0 +1,271 @@
+/*
+ * Solar Panel Fault Detection - Forest Runtime
+ *
+ * Shared traversal code for forests exported as a flat node table
+ * (model_table.h, generated by ml/step3_export_to_esp32.py).
+ *
+ * Each tree is stored in pre-order: the left child of a split is always
+ * the next node, the right child is `right` nodes further on. Walking a
+ * tree is a single loop, so code size no longer grows with the model -
+ * only the table does.
+ */
+
+#ifndef SOLAR_FOREST_RUNTIME_H
+#define SOLAR_FOREST_RUNTIME_H
+
+#include <float.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// Marks a leaf in ForestNode::feature
+#define FOREST_LEAF 0xFF
+
+// Upper bounds for the stack buffers used during prediction
+#ifndef FOREST_MAX_FEATURES
+#define FOREST_MAX_FEATURES 8
+#endif
+
+#ifndef FOREST_MAX_CLASSES
+#define FOREST_MAX_CLASSES 8
+#endif
+
+// One split or leaf (8 bytes)
+struct ForestNode {
+    float threshold;   // Go left when x[feature] <= threshold
+    uint16_t right;    // Distance to the right child (splits only)
+    uint8_t feature;   // Split feature, FOREST_LEAF for leaves
+    uint8_t value;     // Predicted class (leaves only)
+};
+
+// A complete exported forest
+struct Forest {
+    const ForestNode* nodes;       // All trees, back to back
+    const uint16_t* roots;         // Index of each tree's root in nodes
+    uint16_t num_trees;
+    uint8_t num_features;
+    uint8_t num_classes;
+    const float* scaler_mean;      // StandardScaler parameters, NULL when the
+    const float* scaler_std;       // thresholds are already in raw units
+    const char* const* class_names;
+};
+
+// Apply StandardScaler transformation (a plain copy for raw-unit thresholds)
+inline void forest_scale(const Forest* forest, const float* features, float* scaled) {
+    for (int i = 0; i < forest->num_features; i++) {
+        scaled[i] = forest->scaler_mean
+            ? (features[i] - forest->scaler_mean[i]) / forest->scaler_std[i]
+            : features[i];
+    }
+}
+
+// Walk one tree on scaled features - returns the leaf node
+inline const ForestNode* forest_tree_leaf(const ForestNode* node, const float* scaled) {
+    while (node->feature != FOREST_LEAF) {
+        node += (scaled[node->feature] <= node->threshold) ? 1 : node->right;
+    }
+    return node;
+}
+
+// Walk one tree on scaled features - returns the leaf class
+inline int forest_tree_predict(const ForestNode* node, const float* scaled) {
+    return forest_tree_leaf(node, scaled)->value;
+}
+
+// Majority vote (ties go to the lowest class index)
+inline int forest_argmax(const int* votes, int num_classes) {
+    int max_votes = 0;
+    int predicted_class = 0;
+    for (int i = 0; i < num_classes; i++) {
+        if (votes[i] > max_votes) {
+            max_votes = votes[i];
+            predicted_class = i;
+        }
+    }
+    return predicted_class;
+}
+
+// Predict from already scaled features - returns class index
+inline int forest_predict_scaled(const Forest* forest, const float* scaled) {
+    int votes[FOREST_MAX_CLASSES] = {0};
+    for (int t = 0; t < forest->num_trees; t++) {
+        votes[forest_tree_predict(forest->nodes + forest->roots[t], scaled)]++;
+    }
+    return forest_argmax(votes, forest->num_classes);
+}
+
+// Main prediction function - returns class index
+inline int forest_predict(const Forest* forest, const float* raw_features) {
+    if (!forest->scaler_mean) {
+        return forest_predict_scaled(forest, raw_features);
+    }
+    float scaled[FOREST_MAX_FEATURES];
+    forest_scale(forest, raw_features, scaled);
+    return forest_predict_scaled(forest, scaled);
+}
+
+// forest_predict() that also counts how often each node is reached
+// (visits[i] for nodes[i]) - used to build the node profile
+inline int forest_profile_predict(const Forest* forest, const float* raw_features, uint32_t* visits) {
+    float scaled[FOREST_MAX_FEATURES];
+    forest_scale(forest, raw_features, scaled);
+    int votes[FOREST_MAX_CLASSES] = {0};
+    for (int t = 0; t < forest->num_trees; t++) {
+        int i = forest->roots[t];
+        visits[i]++;
+        while (forest->nodes[i].feature != FOREST_LEAF) {
+            const ForestNode* node = forest->nodes + i;
+            i += (scaled[node->feature] <= node->threshold) ? 1 : node->right;
+            visits[i]++;
+        }
+        votes[forest->nodes[i].value]++;
+    }
+    return forest_argmax(votes, forest->num_classes);
+}
+
+// How far a prediction is from changing, from forest_predict_margin()
+struct ForestMargin {
+    int class_idx;                          // Same class as forest_predict()
+    int vote_margin;                        // Winner's votes minus the runner-up's
+    float distance[FOREST_MAX_FEATURES];    // Per feature, raw units (see below)
+};
+
+// forest_predict() that also reports how close the input is to a boundary.
+//
+// distance[f] is the smallest |x[f] - threshold| over the splits on
+// feature f along every tree's decision path: moving x[f] alone by less
+// than that keeps every tree in the same leaf, so the class cannot change.
+// Features no path splits on get FLT_MAX. Thresholds in scaled units are
+// converted back with scaler_std. Crossing one threshold changes one tree's
+// vote, which moves vote_margin by at most 2, so a large vote_margin also
+// means several trees must change before the class does.
+//
+// Sender nodes can sample slowly while every distance is large compared
+// with the sensor's usual step between readings, and quickly when close.
+inline int forest_predict_margin(const Forest* forest, const float* raw_features, ForestMargin* margin) {
+    float scaled[FOREST_MAX_FEATURES];
+    forest_scale(forest, raw_features, scaled);
+    for (int f = 0; f < forest->num_features; f++) {
+        margin->distance[f] = FLT_MAX;
+    }
+
+    int votes[FOREST_MAX_CLASSES] = {0};
+    for (int t = 0; t < forest->num_trees; t++) {
+        const ForestNode* node = forest->nodes + forest->roots[t];
+        while (node->feature != FOREST_LEAF) {
+            float gap = scaled[node->feature] - node->threshold;
+            if (gap < 0.0f) gap = -gap;
+            if (gap < margin->distance[node->feature]) margin->distance[node->feature] = gap;
+            node += (scaled[node->feature] <= node->threshold) ? 1 : node->right;
+        }
+        votes[node->value]++;
+    }
+
+    if (forest->scaler_mean) {
+        for (int f = 0; f < forest->num_features; f++) {
+            if (margin->distance[f] != FLT_MAX) margin->distance[f] *= forest->scaler_std[f];
+        }
+    }
+
+    int predicted_class = forest_argmax(votes, forest->num_classes);
+    int runner_up = 0;
+    for (int i = 0; i < forest->num_classes; i++) {
+        if (i != predicted_class && votes[i] > runner_up) runner_up = votes[i];
+    }
+    margin->class_idx = predicted_class;
+    margin->vote_margin = votes[predicted_class] - runner_up;
+    return predicted_class;
+}
+
+// Per-feature attribution of one prediction, from forest_predict_explain()
+struct ForestExplanation {
+    int class_idx;                                                // Same class as forest_predict()
+    float score[FOREST_MAX_CLASSES];                              // Mean node value reached per class
+    float bias[FOREST_MAX_CLASSES];                               // Mean root value per class
+    float contributions[FOREST_MAX_FEATURES][FOREST_MAX_CLASSES]; // [feature][class]
+};
+
+// forest_predict() that also records, in the same traversal, how much each
+// feature moved each class's score (Saabas attribution).
+//
+// node_values holds num_classes values per node, in node table order: the
+// training class distribution at that node (FOREST_NODE_VALUES in
+// model_table.h, or a blob's node distributions). Every split on the path
+// moves the score from the node's value to the child's, and the change is
+// credited to the split feature, so for every class
+//   bias[c] + sum over f of contributions[f][c] == score[c]
+// up to float rounding. score is sklearn's predict_proba() for a forest
+// that was not compacted; the leaf values are summed in double into
+// sum[num_classes], as forest_blob_predict_proba() sums them. Returns the
+// hard-vote class, as forest_predict() does.
+//
+// Not cheap: the num_classes node values read and added per split cost
+// 4.6-6.1x forest_predict() (bench_explain: 467-480 against 78-82 ns per
+// sample, 15 trees, 1-vCPU Xeon), so explain only the predictions that
+// are shown.
+inline int forest_explain_walk(const Forest* forest, const float* node_values, const float* raw_features,
+                               ForestExplanation* explanation, double* sum) {
+    float scaled[FOREST_MAX_FEATURES];
+    forest_scale(forest, raw_features, scaled);
+    int num_classes = forest->num_classes;
+    float* score = explanation->score;
+    float* bias = explanation->bias;
+    for (int c = 0; c < num_classes; c++) {
+        sum[c] = 0.0;
+        bias[c] = 0.0f;
+    }
+    for (int f = 0; f < forest->num_features; f++) {
+        for (int c = 0; c < num_classes; c++) {
+            explanation->contributions[f][c] = 0.0f;
+        }
+    }
+
+    int votes[FOREST_MAX_CLASSES] = {0};
+    for (int t = 0; t < forest->num_trees; t++) {
+        const ForestNode* node = forest->nodes + forest->roots[t];
+        const float* value = node_values + (size_t)(node - forest->nodes) * num_classes;
+        for (int c = 0; c < num_classes; c++) {
+            bias[c] += value[c];
+        }
+        while (node->feature != FOREST_LEAF) {
+            float* contribution = explanation->contributions[node->feature];
+            node += (scaled[node->feature] <= node->threshold) ? 1 : node->right;
+            const float* next = node_values + (size_t)(node - forest->nodes) * num_classes;
+            for (int c = 0; c < num_classes; c++) {
+                contribution[c] += next[c] - value[c];
+            }
+            value = next;
+        }
+        for (int c = 0; c < num_classes; c++) {
+            sum[c] += value[c];
+        }
+        votes[node->value]++;
+    }
+
+    float scale = 1.0f / forest->num_trees;
+    for (int c = 0; c < num_classes; c++) {
+        score[c] = (float)(sum[c] / forest->num_trees);
+        bias[c] *= scale;
+    }
+    for (int f = 0; f < forest->num_features; f++) {
+        for (int c = 0; c < num_classes; c++) {
+            explanation->contributions[f][c] *= scale;
+        }
+    }
+    return forest_argmax(votes, num_classes);
+}
+
+// forest_predict() that also records how much each feature moved each
+// class's score (see forest_explain_walk()); class_idx is the hard vote
+inline int forest_predict_explain(const Forest* forest, const float* node_values, const float* raw_features,
+                                  ForestExplanation* explanation) {
+    double sum[FOREST_MAX_CLASSES];
+    explanation->class_idx = forest_explain_walk(forest, node_values, raw_features, explanation, sum);
+    return explanation->class_idx;
+}
+
+// Get the class name string from prediction
+inline const char* forest_predict_class_name(const Forest* forest, const float* raw_features) {
+    return forest->class_names[forest_predict(forest, raw_features)];
+}
+
+#endif // SOLAR_FOREST_RUNTIME_H
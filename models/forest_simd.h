@@ -0,0 +1,256 @@
+/*
+ * Solar Panel Fault Detection - Vectorized Blob Scoring (x86-64 hosts)
+ *
+ * forest_blob_predict_proba() for FOREST_SIMD_LANES rows at once, for bulk
+ * rescoring (tools/backfill.cpp). forest_simd_prepare() re-lays each tree
+ * of a blob out as a complete binary tree of the forest's maximum depth,
+ * breadth-first; shallower leaves are padded down. Every row then takes
+ * exactly `depth` steps per tree,
+ *
+ *     pos = 2 * pos + !(x[feature[pos]] <= threshold[pos])
+ *
+ * with no data-dependent branch, eight rows per AVX2 register. The final
+ * `pos` picks the leaf whose distribution is gathered and summed in double,
+ * tree by tree as forest_blob_predict_proba() does, so classes and
+ * probabilities are bit-identical to it.
+ *
+ * The AVX2 code is compiled with a target attribute, so the build needs no
+ * -mavx2. The CPU is checked at run time: forest_simd_prepare() returns
+ * false without AVX2 (__builtin_cpu_supports), on compilers other than
+ * GCC/Clang for x86-64, for blobs without leaf distributions and for trees
+ * deeper than FOREST_SIMD_MAX_DEPTH. Callers then score each row with
+ * forest_blob_predict_proba().
+ *
+ * 15 trees of depth 6, both datasets, 1-vCPU Xeon, g++ 12 -O2: 181-184 ns
+ * per row against 215-221 ns for forest_blob_predict_proba() (1.2x).
+ * backfill, one thread: 6.8-7.0 against 5.9-6.1 M rows/s on a binary
+ * archive; CSV archives stay at about 2.1 M rows/s, parsing dominates. An
+ * earlier hard-vote version (class per row, compile-time backends) lost to
+ * forest_predict() unless built with -march=native and was removed.
+ */
+
+#ifndef SOLAR_FOREST_SIMD_H
+#define SOLAR_FOREST_SIMD_H
+
+#include <vector>
+
+#include "forest_blob.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define FOREST_SIMD_AVX2
+#include <immintrin.h>
+#endif
+
+// Rows scored together
+#define FOREST_SIMD_LANES 16
+
+// Complete trees double in size per level - deeper forests are rejected
+#ifndef FOREST_SIMD_MAX_DEPTH
+#define FOREST_SIMD_MAX_DEPTH 12
+#endif
+
+// A blob's trees re-laid out as complete binary trees
+struct ForestSimd {
+    const ForestBlob* blob;
+    int depth;                     // Levels of splits in every tree
+    int split_stride;              // Entries per tree in thresholds/features
+    int leaf_stride;               // Entries per tree in leaves
+    std::vector<float> thresholds; // Breadth-first: level l starts at 2^l - 1
+    std::vector<int32_t> features;
+    std::vector<int32_t> leaves;   // 2^depth leaf node indices per tree
+};
+
+inline int forest_simd_tree_depth(const ForestNode* node) {
+    if (node->feature == FOREST_LEAF) return 0;
+    int left = forest_simd_tree_depth(node + 1);
+    int right = forest_simd_tree_depth(node + node->right);
+    return 1 + (left > right ? left : right);
+}
+
+// Copy the subtree at `node` into level `level`, position `pos`
+inline void forest_simd_fill(ForestSimd* simd, int tree, const ForestNode* node, int level, int pos) {
+    float* thresholds = &simd->thresholds[tree * simd->split_stride];
+    int32_t* features = &simd->features[tree * simd->split_stride];
+    int32_t* leaves = &simd->leaves[tree * simd->leaf_stride];
+
+    if (node->feature == FOREST_LEAF) {
+        // Splits below a shallow leaf are padding (feature 0, threshold 0):
+        // every leaf under it is this leaf, so the direction does not matter
+        int span = 1 << (simd->depth - level);
+        for (int i = 0; i < span; i++) {
+            leaves[pos * span + i] = (int32_t)(node - simd->blob->forest.nodes);
+        }
+        return;
+    }
+
+    thresholds[(1 << level) - 1 + pos] = node->threshold;
+    features[(1 << level) - 1 + pos] = node->feature;
+    forest_simd_fill(simd, tree, node + 1, level + 1, 2 * pos);
+    forest_simd_fill(simd, tree, node + node->right, level + 1, 2 * pos + 1);
+}
+
+// Whether this build and CPU can run the vectorized kernel
+inline bool forest_simd_supported() {
+#if defined(FOREST_SIMD_AVX2)
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+// Build the complete-tree layout - returns false when the kernel cannot
+// score this blob here (see above); use forest_blob_predict_proba() then
+inline bool forest_simd_prepare(const ForestBlob* blob, ForestSimd* simd) {
+    const Forest* forest = &blob->forest;
+    if (!forest_simd_supported() || !blob->leaf_proba) return false;
+
+    simd->blob = blob;
+    simd->depth = 0;
+    for (int t = 0; t < forest->num_trees; t++) {
+        int depth = forest_simd_tree_depth(forest->nodes + forest->roots[t]);
+        if (depth > simd->depth) simd->depth = depth;
+    }
+    if (simd->depth > FOREST_SIMD_MAX_DEPTH) return false;
+
+    // Padding of 8 entries lets every lookup load whole registers
+    simd->split_stride = (1 << simd->depth) - 1 + 8;
+    simd->leaf_stride = (1 << simd->depth) + 8;
+    simd->thresholds.assign((size_t)forest->num_trees * simd->split_stride, 0.0f);
+    simd->features.assign((size_t)forest->num_trees * simd->split_stride, 0);
+    simd->leaves.assign((size_t)forest->num_trees * simd->leaf_stride, 0);
+
+    for (int t = 0; t < forest->num_trees; t++) {
+        forest_simd_fill(simd, t, forest->nodes + forest->roots[t], 0, 0);
+    }
+    return true;
+}
+
+#if defined(FOREST_SIMD_AVX2)
+
+// table[pos] for each lane, where table holds `count` entries
+__attribute__((target("avx2")))
+inline __m256i forest_avx2_lookup(const int32_t* table, int count, __m256i pos) {
+    if (count <= 8) {
+        return _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(table)), pos);
+    }
+    if (count <= 64) {
+        __m256i chunk = _mm256_srli_epi32(pos, 3);
+        __m256i result = _mm256_setzero_si256();
+        for (int k = 0; k < count / 8; k++) {
+            __m256i entries = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table + 8 * k));
+            __m256i picked = _mm256_permutevar8x32_epi32(entries, pos);
+            result = _mm256_blendv_epi8(result, picked, _mm256_cmpeq_epi32(chunk, _mm256_set1_epi32(k)));
+        }
+        return result;
+    }
+    return _mm256_i32gather_epi32(reinterpret_cast<const int*>(table), pos, 4);
+}
+
+// Score FOREST_SIMD_LANES scaled rows, stored [feature][lane]
+__attribute__((target("avx2")))
+inline void forest_simd_block(const ForestSimd* simd, const float* scaled, double sum[][FOREST_SIMD_LANES]) {
+    const ForestBlob* blob = simd->blob;
+    const Forest* forest = &blob->forest;
+
+    // Two independent 8-lane halves keep two dependency chains in flight
+    __m256 x[2][FOREST_MAX_FEATURES];
+    __m256d acc[2][FOREST_MAX_CLASSES][2];
+    for (int h = 0; h < 2; h++) {
+        for (int f = 0; f < forest->num_features; f++) {
+            x[h][f] = _mm256_loadu_ps(scaled + f * FOREST_SIMD_LANES + 8 * h);
+        }
+        for (int c = 0; c < forest->num_classes; c++) {
+            acc[h][c][0] = acc[h][c][1] = _mm256_setzero_pd();
+        }
+    }
+
+    __m256i num_classes = _mm256_set1_epi32(forest->num_classes);
+    for (int t = 0; t < forest->num_trees; t++) {
+        const int32_t* thresholds = reinterpret_cast<const int32_t*>(&simd->thresholds[t * simd->split_stride]);
+        const int32_t* features = &simd->features[t * simd->split_stride];
+        __m256i pos[2] = {_mm256_setzero_si256(), _mm256_setzero_si256()};
+
+        for (int level = 0; level < simd->depth; level++) {
+            int first = (1 << level) - 1;
+            int count = 1 << level;
+            for (int h = 0; h < 2; h++) {
+                __m256i feature = forest_avx2_lookup(features + first, count, pos[h]);
+                __m256 threshold = _mm256_castsi256_ps(forest_avx2_lookup(thresholds + first, count, pos[h]));
+
+                // Select each lane's feature from registers
+                __m256 value = x[h][0];
+                for (int f = 1; f < forest->num_features; f++) {
+                    __m256i pick = _mm256_cmpeq_epi32(feature, _mm256_set1_epi32(f));
+                    value = _mm256_blendv_ps(value, x[h][f], _mm256_castsi256_ps(pick));
+                }
+
+                // go_right is all ones when !(x <= threshold), NaN included
+                __m256i go_right = _mm256_castps_si256(_mm256_cmp_ps(value, threshold, _CMP_NLE_UQ));
+                pos[h] = _mm256_sub_epi32(_mm256_add_epi32(pos[h], pos[h]), go_right);
+            }
+        }
+
+        // Add each lane's leaf distribution, widened to double
+        const int32_t* leaves = &simd->leaves[t * simd->leaf_stride];
+        for (int h = 0; h < 2; h++) {
+            __m256i leaf = forest_avx2_lookup(leaves, 1 << simd->depth, pos[h]);
+            __m256i offset = _mm256_mullo_epi32(leaf, num_classes);
+            for (int c = 0; c < forest->num_classes; c++) {
+                __m256 p = _mm256_i32gather_ps(blob->leaf_proba + c, offset, 4);
+                acc[h][c][0] = _mm256_add_pd(acc[h][c][0], _mm256_cvtps_pd(_mm256_castps256_ps128(p)));
+                acc[h][c][1] = _mm256_add_pd(acc[h][c][1], _mm256_cvtps_pd(_mm256_extractf128_ps(p, 1)));
+            }
+        }
+    }
+
+    for (int h = 0; h < 2; h++) {
+        for (int c = 0; c < forest->num_classes; c++) {
+            _mm256_storeu_pd(&sum[c][8 * h], acc[h][c][0]);
+            _mm256_storeu_pd(&sum[c][8 * h + 4], acc[h][c][1]);
+        }
+    }
+}
+
+#endif
+
+// forest_blob_predict_proba() of `count` (at most FOREST_SIMD_LANES) raw
+// rows, row r at rows[r * FOREST_MAX_FEATURES]. Writes each row's class
+// to classes[r] and probabilities to proba[r * FOREST_MAX_CLASSES].
+// Only call with a ForestSimd that forest_simd_prepare() accepted.
+inline void forest_simd_predict_proba(const ForestSimd* simd, const float* rows, int count,
+                                      int* classes, float* proba) {
+#if defined(FOREST_SIMD_AVX2)
+    const Forest* forest = &simd->blob->forest;
+
+    // Unused lanes repeat the last row so every lane holds valid input
+    float scaled[FOREST_MAX_FEATURES * FOREST_SIMD_LANES];
+    for (int l = 0; l < FOREST_SIMD_LANES; l++) {
+        float row[FOREST_MAX_FEATURES];
+        forest_scale(forest, rows + (l < count ? l : count - 1) * FOREST_MAX_FEATURES, row);
+        for (int f = 0; f < forest->num_features; f++) {
+            scaled[f * FOREST_SIMD_LANES + l] = row[f];
+        }
+    }
+
+    double sum[FOREST_MAX_CLASSES][FOREST_SIMD_LANES];
+    forest_simd_block(simd, scaled, sum);
+
+    for (int l = 0; l < count; l++) {
+        int predicted_class = 0;
+        for (int c = 0; c < forest->num_classes; c++) {
+            proba[l * FOREST_MAX_CLASSES + c] = (float)(sum[c][l] / forest->num_trees);
+            if (sum[c][l] > sum[predicted_class][l]) {
+                predicted_class = c;
+            }
+        }
+        classes[l] = predicted_class;
+    }
+#else
+    for (int l = 0; l < count; l++) {
+        classes[l] = forest_blob_predict_proba(simd->blob, rows + l * FOREST_MAX_FEATURES,
+                                               proba + l * FOREST_MAX_CLASSES);
+    }
+#endif
+}
+
+#endif // SOLAR_FOREST_SIMD_H
@@ -0,0 +1,92 @@
+/*
+ * Solar Panel Fault Detection - Soft Voting Runtime
+ *
+ * Probability averaging for forests exported as model_soft.h, the way
+ * sklearn's RandomForestClassifier.predict_proba() combines its trees.
+ * Each leaf carries its class distribution quantized to integers that
+ * sum to proba_scale, and predictions add them up in uint32_t, so there
+ * is no floating-point accumulation. The probability of class c is
+ * acc[c] / soft_forest_total(), within 1 / proba_scale of sklearn.
+ *
+ * The node table is a normal Forest: leaves keep their majority class in
+ * `value` (so forest_predict() still gives the hard vote) and the row of
+ * their distribution in `right`.
+ *
+ * The data header defines FOREST_SOFT_BITS (8 or 16) before including
+ * this file.
+ */
+
+#ifndef SOLAR_FOREST_SOFT_H
+#define SOLAR_FOREST_SOFT_H
+
+#include "forest_runtime.h"
+
+#ifndef FOREST_SOFT_BITS
+#define FOREST_SOFT_BITS 8
+#endif
+
+#if FOREST_SOFT_BITS == 16
+typedef uint16_t forest_proba_t;
+#else
+typedef uint8_t forest_proba_t;
+#endif
+
+// A complete exported forest with leaf distributions
+struct SoftForest {
+    Forest forest;
+    const forest_proba_t* leaf_proba;  // num_classes entries per row, each row sums to proba_scale
+    uint16_t proba_scale;
+};
+
+// Denominator of the accumulated probabilities
+inline uint32_t soft_forest_total(const SoftForest* soft) {
+    return (uint32_t)soft->forest.num_trees * soft->proba_scale;
+}
+
+// Sum the leaf distributions of every tree for one scaled sample
+inline void soft_forest_accumulate(const SoftForest* soft, const float* scaled, uint32_t* acc) {
+    const Forest* forest = &soft->forest;
+    int num_classes = forest->num_classes;
+    for (int c = 0; c < num_classes; c++) {
+        acc[c] = 0;
+    }
+    for (int t = 0; t < forest->num_trees; t++) {
+        const ForestNode* leaf = forest_tree_leaf(forest->nodes + forest->roots[t], scaled);
+        const forest_proba_t* proba = soft->leaf_proba + (uint32_t)leaf->right * num_classes;
+        for (int c = 0; c < num_classes; c++) {
+            acc[c] += proba[c];
+        }
+    }
+}
+
+// Highest probability (ties go to the lowest class index, as numpy.argmax)
+inline int soft_forest_argmax(const uint32_t* acc, int num_classes) {
+    int predicted_class = 0;
+    for (int c = 1; c < num_classes; c++) {
+        if (acc[c] > acc[predicted_class]) {
+            predicted_class = c;
+        }
+    }
+    return predicted_class;
+}
+
+// Fill acc[num_classes] with the summed distributions - returns class index
+inline int soft_forest_predict_proba(const SoftForest* soft, const float* raw_features, uint32_t* acc) {
+    const Forest* forest = &soft->forest;
+    if (forest->scaler_mean) {
+        float scaled[FOREST_MAX_FEATURES];
+        forest_scale(forest, raw_features, scaled);
+        soft_forest_accumulate(soft, scaled, acc);
+    } else {
+        soft_forest_accumulate(soft, raw_features, acc);
+    }
+    return soft_forest_argmax(acc, forest->num_classes);
+}
+
+// Main prediction function - returns class index
+inline int soft_forest_predict(const SoftForest* soft, const float* raw_features) {
+    uint32_t acc[FOREST_MAX_CLASSES];
+    return soft_forest_predict_proba(soft, raw_features, acc);
+}
+
+#endif // SOLAR_FOREST_SOFT_H
@@ -9,183 +9,409 @@ namespace Eloquent {
                     * Predict class for features vector
                     */
                     int predict(float *x) {
-                        uint8_t votes[4] = { 0 };
+                        uint8_t votes[5] = { 0 };
                         // tree #1
-                        if (x[1] <= 0.75692018866539) {
-                            if (x[0] <= 0.2857782170176506) {
-                                votes[2] += 1;
-                            }
-
-                            else {
-                                if (x[0] <= 1.016722321510315) {
-                                    if (x[0] <= 0.7551084756851196) {
-                                        votes[0] += 1;
-                                    }
+                        if (x[0] <= -1.178747832775116) {
+                            votes[4] += 1;
+                        }
 
-                                    else {
-                                        if (x[1] <= -0.5465880744159222) {
-                                            votes[1] += 1;
+                        else {
+                            if (x[4] <= -0.6676765382289886) {
+                                if (x[2] <= -0.35496407747268677) {
+                                    if (x[0] <= 0.9039826989173889) {
+                                        if (x[2] <= -0.5531470775604248) {
+                                            votes[2] += 1;
                                         }
 
                                         else {
-                                            votes[0] += 1;
+                                            votes[2] += 1;
                                         }
                                     }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
                                 }
 
                                 else {
-                                    if (x[3] <= 1.3552724123001099) {
-                                        if (x[0] <= 1.0379178524017334) {
-                                            votes[1] += 1;
+                                    votes[2] += 1;
+                                }
+                            }
+
+                            else {
+                                if (x[4] <= 1.2062460482120514) {
+                                    if (x[3] <= -1.0875731706619263) {
+                                        if (x[1] <= -0.09829088672995567) {
+                                            votes[3] += 1;
                                         }
 
                                         else {
-                                            votes[1] += 1;
+                                            votes[3] += 1;
                                         }
                                     }
 
                                     else {
-                                        if (x[2] <= -0.49996744096279144) {
-                                            votes[1] += 1;
+                                        if (x[1] <= -0.3954588919878006) {
+                                            if (x[0] <= -0.016503624385222793) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
                                         }
 
                                         else {
-                                            votes[0] += 1;
+                                            if (x[0] <= -0.1332143396139145) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
                                         }
                                     }
                                 }
-                            }
-                        }
 
-                        else {
-                            votes[3] += 1;
+                                else {
+                                    votes[1] += 1;
+                                }
+                            }
                         }
 
                         // tree #2
-                        if (x[2] <= 0.5304074883460999) {
-                            if (x[3] <= -0.6917167007923126) {
-                                if (x[0] <= 0.4541315361857414) {
-                                    votes[2] += 1;
+                        if (x[1] <= -1.165479063987732) {
+                            if (x[0] <= 0.6476359367370605) {
+                                votes[2] += 1;
+                            }
+
+                            else {
+                                if (x[4] <= -0.685075432062149) {
+                                    if (x[2] <= -0.35048341751098633) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
                                 }
 
                                 else {
-                                    votes[1] += 1;
+                                    votes[2] += 1;
                                 }
                             }
+                        }
+
+                        else {
+                            if (x[4] <= -0.6328788101673126) {
+                                votes[4] += 1;
+                            }
 
                             else {
-                                if (x[2] <= -0.1985463872551918) {
-                                    if (x[0] <= 0.28153911605477333) {
-                                        votes[2] += 1;
+                                if (x[3] <= -0.005885154940187931) {
+                                    if (x[3] <= -1.0968639254570007) {
+                                        if (x[1] <= -0.09081496298313141) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
                                     }
 
                                     else {
-                                        if (x[0] <= 0.781148761510849) {
-                                            votes[0] += 1;
+                                        if (x[0] <= -0.18392793089151382) {
+                                            if (x[2] <= 0.27370689809322357) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
                                         }
 
                                         else {
-                                            votes[1] += 1;
+                                            if (x[1] <= -0.5132047086954117) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
                                         }
                                     }
                                 }
 
                                 else {
-                                    if (x[1] <= -0.10716640576720238) {
-                                        votes[2] += 1;
-                                    }
-
-                                    else {
-                                        if (x[3] <= -0.5267366468906403) {
-                                            votes[0] += 1;
+                                    if (x[4] <= 1.1836919784545898) {
+                                        if (x[3] <= 0.218315951526165) {
+                                            votes[1] += 1;
                                         }
 
                                         else {
-                                            votes[0] += 1;
+                                            if (x[1] <= 0.02506186906248331) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
                                         }
                                     }
+
+                                    else {
+                                        votes[1] += 1;
+                                    }
                                 }
                             }
                         }
 
-                        else {
-                            votes[3] += 1;
-                        }
-
                         // tree #3
-                        if (x[0] <= -0.9393251836299896) {
-                            votes[3] += 1;
+                        if (x[0] <= -1.1697166562080383) {
+                            votes[4] += 1;
                         }
 
                         else {
-                            if (x[1] <= -1.0253609120845795) {
-                                votes[1] += 1;
+                            if (x[4] <= -0.5948590636253357) {
+                                if (x[0] <= 0.6531935930252075) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    if (x[2] <= -0.35048341751098633) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
                             }
 
                             else {
-                                if (x[1] <= -0.06617559120059013) {
-                                    votes[2] += 1;
+                                if (x[4] <= 0.9484850466251373) {
+                                    if (x[1] <= -0.2272505834698677) {
+                                        if (x[0] <= -0.008167145540937781) {
+                                            if (x[4] <= 0.35821230709552765) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[2] <= -0.24536026269197464) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[0] <= -0.19365382194519043) {
+                                            if (x[4] <= -0.18179702758789062) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.2101430967450142) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
                                 }
 
                                 else {
-                                    votes[0] += 1;
+                                    votes[1] += 1;
                                 }
                             }
                         }
 
                         // tree #4
-                        if (x[1] <= -1.0253609120845795) {
-                            votes[1] += 1;
+                        if (x[0] <= -1.178747832775116) {
+                            votes[4] += 1;
                         }
 
                         else {
-                            if (x[0] <= 0.2857782170176506) {
-                                if (x[1] <= 0.2765077129006386) {
+                            if (x[1] <= -1.144920289516449) {
+                                if (x[0] <= 0.7191907465457916) {
                                     votes[2] += 1;
                                 }
 
                                 else {
-                                    votes[3] += 1;
+                                    if (x[2] <= -0.35496407747268677) {
+                                        if (x[1] <= -1.3224735260009766) {
+                                            votes[2] += 1;
+                                        }
+
+                                        else {
+                                            if (x[1] <= -1.3112596273422241) {
+                                                votes[2] += 1;
+                                            }
+
+                                            else {
+                                                votes[2] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
                                 }
                             }
 
                             else {
-                                votes[0] += 1;
+                                if (x[4] <= 0.9420410096645355) {
+                                    if (x[0] <= -0.0137247983366251) {
+                                        if (x[4] <= 0.32985860109329224) {
+                                            if (x[1] <= 0.004503076896071434) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[2] <= 0.06621789745986462) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[3] <= -1.1711207032203674) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[1] <= -0.3917209208011627) {
+                                                votes[1] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    votes[1] += 1;
+                                }
                             }
                         }
 
                         // tree #5
-                        if (x[1] <= -1.0319194495677948) {
-                            votes[1] += 1;
-                        }
+                        if (x[2] <= 0.8272406458854675) {
+                            if (x[1] <= -1.1710860133171082) {
+                                if (x[0] <= 0.7928296029567719) {
+                                    if (x[4] <= -0.9492804706096649) {
+                                        votes[2] += 1;
+                                    }
 
-                        else {
-                            if (x[2] <= 0.5304074883460999) {
-                                if (x[1] <= -0.06617559120059013) {
-                                    votes[2] += 1;
+                                    else {
+                                        votes[2] += 1;
+                                    }
                                 }
 
                                 else {
-                                    if (x[1] <= 0.773316502571106) {
-                                        votes[0] += 1;
+                                    if (x[0] <= 0.9032879769802094) {
+                                        if (x[4] <= -0.8571308851242065) {
+                                            votes[2] += 1;
+                                        }
+
+                                        else {
+                                            votes[2] += 1;
+                                        }
                                     }
 
                                     else {
-                                        votes[0] += 1;
+                                        votes[2] += 1;
                                     }
                                 }
                             }
 
                             else {
-                                votes[3] += 1;
+                                if (x[4] <= 1.182403177022934) {
+                                    if (x[1] <= -0.30574779212474823) {
+                                        if (x[3] <= -0.8662850856781006) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[1] <= -0.4010658264160156) {
+                                                votes[1] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[4] <= -0.04067287780344486) {
+                                            if (x[1] <= 0.5184729043394327) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[4] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[3] <= -1.1901503205299377) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    votes[1] += 1;
+                                }
                             }
                         }
 
+                        else {
+                            votes[4] += 1;
+                        }
+
                         // tree #6
-                        if (x[2] <= 0.5418407022953033) {
-                            if (x[0] <= 0.2857782170176506) {
-                                if (x[0] <= -0.6946678459644318) {
-                                    votes[3] += 1;
+                        if (x[0] <= -1.178747832775116) {
+                            votes[4] += 1;
+                        }
+
+                        else {
+                            if (x[4] <= -0.6174131631851196) {
+                                if (x[4] <= -0.7868910133838654) {
+                                    votes[2] += 1;
                                 }
 
                                 else {
@@ -194,77 +420,144 @@ namespace Eloquent {
                             }
 
                             else {
-                                if (x[0] <= 0.7551084756851196) {
-                                    votes[0] += 1;
-                                }
+                                if (x[4] <= 0.9575066566467285) {
+                                    if (x[3] <= -0.9994923174381256) {
+                                        if (x[0] <= 0.12591123953461647) {
+                                            if (x[1] <= -0.06464922614395618) {
+                                                votes[3] += 1;
+                                            }
 
-                                else {
-                                    if (x[1] <= -0.5400295369327068) {
-                                        votes[1] += 1;
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[1] <= 0.021323905792087317) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
                                     }
 
                                     else {
-                                        votes[0] += 1;
+                                        if (x[0] <= -0.0762483961880207) {
+                                            if (x[3] <= -0.8525989651679993) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[2] <= 0.634572297334671) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
                                     }
                                 }
-                            }
-                        }
 
-                        else {
-                            votes[3] += 1;
+                                else {
+                                    votes[1] += 1;
+                                }
+                            }
                         }
 
                         // tree #7
-                        if (x[1] <= -1.0302797853946686) {
-                            votes[1] += 1;
-                        }
+                        if (x[1] <= -1.165479063987732) {
+                            if (x[4] <= -0.8049342930316925) {
+                                if (x[0] <= 1.0074939727783203) {
+                                    if (x[2] <= -0.3956346958875656) {
+                                        votes[2] += 1;
+                                    }
 
-                        else {
-                            if (x[0] <= 0.27427205815911293) {
-                                if (x[1] <= 0.2781473472714424) {
-                                    votes[2] += 1;
+                                    else {
+                                        votes[2] += 1;
+                                    }
                                 }
 
                                 else {
-                                    votes[3] += 1;
+                                    votes[2] += 1;
                                 }
                             }
 
                             else {
-                                votes[0] += 1;
+                                votes[2] += 1;
                             }
                         }
 
-                        // tree #8
-                        if (x[0] <= -0.9532536864280701) {
-                            votes[3] += 1;
-                        }
-
                         else {
-                            if (x[1] <= -1.0253609120845795) {
-                                votes[1] += 1;
+                            if (x[2] <= 0.7372828125953674) {
+                                if (x[4] <= 1.1869139969348907) {
+                                    if (x[3] <= -1.0989668369293213) {
+                                        if (x[4] <= 0.38141079246997833) {
+                                            if (x[1] <= -0.09081496298313141) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            votes[3] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[1] <= -0.4403144270181656) {
+                                            if (x[1] <= -0.5954398810863495) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.009418731555342674) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    votes[1] += 1;
+                                }
                             }
 
                             else {
-                                if (x[1] <= -0.05633779242634773) {
-                                    votes[2] += 1;
+                                if (x[1] <= 0.8324617147445679) {
+                                    votes[4] += 1;
                                 }
 
                                 else {
-                                    votes[0] += 1;
+                                    votes[4] += 1;
                                 }
                             }
                         }
 
-                        // tree #9
-                        if (x[0] <= -0.9605207145214081) {
-                            votes[3] += 1;
-                        }
-
-                        else {
-                            if (x[1] <= -0.057977426797151566) {
-                                if (x[1] <= -1.0319194495677948) {
-                                    votes[1] += 1;
+                        // tree #8
+                        if (x[4] <= -0.6792758107185364) {
+                            if (x[2] <= 0.19098703563213348) {
+                                if (x[4] <= -0.8313547968864441) {
+                                    votes[2] += 1;
                                 }
 
                                 else {
@@ -273,28 +566,692 @@ namespace Eloquent {
                             }
 
                             else {
-                                votes[0] += 1;
+                                votes[4] += 1;
                             }
                         }
 
-                        // tree #10
-                        if (x[1] <= -0.06617559120059013) {
-                            if (x[1] <= -1.0302797853946686) {
-                                votes[1] += 1;
-                            }
+                        else {
+                            if (x[3] <= 0.1530568227171898) {
+                                if (x[3] <= -1.0968639254570007) {
+                                    if (x[0] <= 0.0981229729950428) {
+                                        votes[3] += 1;
+                                    }
 
-                            else {
-                                votes[2] += 1;
-                            }
-                        }
+                                    else {
+                                        votes[3] += 1;
+                                    }
+                                }
 
-                        else {
-                            if (x[2] <= 0.3398539572954178) {
-                                votes[0] += 1;
-                            }
+                                else {
+                                    if (x[4] <= -0.1405552700161934) {
+                                        votes[3] += 1;
+                                    }
 
-                            else {
-                                votes[3] += 1;
+                                    else {
+                                        if (x[3] <= -0.14905531704425812) {
+                                            if (x[4] <= 0.11591694131493568) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[0] <= 0.05296703986823559) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[1] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+
+                            else {
+                                if (x[0] <= 0.25443197786808014) {
+                                    votes[1] += 1;
+                                }
+
+                                else {
+                                    if (x[2] <= -0.007540647988207638) {
+                                        votes[1] += 1;
+                                    }
+
+                                    else {
+                                        votes[1] += 1;
+                                    }
+                                }
+                            }
+                        }
+
+                        // tree #9
+                        if (x[2] <= 0.7617540955543518) {
+                            if (x[1] <= -1.144920289516449) {
+                                if (x[1] <= -1.2103346586227417) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    votes[2] += 1;
+                                }
+                            }
+
+                            else {
+                                if (x[4] <= 0.9575066566467285) {
+                                    if (x[3] <= -1.0875731706619263) {
+                                        if (x[1] <= -0.09081496298313141) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[1] <= -0.35247232019901276) {
+                                            if (x[0] <= -0.016503624385222793) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[0] <= -0.1332143396139145) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    votes[1] += 1;
+                                }
+                            }
+                        }
+
+                        else {
+                            votes[4] += 1;
+                        }
+
+                        // tree #10
+                        if (x[0] <= -1.1655484437942505) {
+                            votes[4] += 1;
+                        }
+
+                        else {
+                            if (x[1] <= -1.148658275604248) {
+                                if (x[3] <= -0.05616535805165768) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    if (x[1] <= -1.3243424892425537) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        if (x[2] <= -0.5562490820884705) {
+                                            if (x[4] <= -0.7572485208511353) {
+                                                votes[2] += 1;
+                                            }
+
+                                            else {
+                                                votes[2] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            votes[2] += 1;
+                                        }
+                                    }
+                                }
+                            }
+
+                            else {
+                                if (x[3] <= 0.009076523827388883) {
+                                    if (x[3] <= -1.020969569683075) {
+                                        if (x[1] <= -0.001103866845369339) {
+                                            if (x[3] <= -1.0638378858566284) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[4] <= -0.02391840983182192) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[1] <= -0.3917209208011627) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    if (x[4] <= 1.179181158542633) {
+                                        if (x[4] <= 0.05018788296729326) {
+                                            votes[1] += 1;
+                                        }
+
+                                        else {
+                                            if (x[3] <= 0.14619651436805725) {
+                                                votes[1] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        votes[1] += 1;
+                                    }
+                                }
+                            }
+                        }
+
+                        // tree #11
+                        if (x[1] <= -1.1710860133171082) {
+                            if (x[0] <= 0.6580565571784973) {
+                                votes[2] += 1;
+                            }
+
+                            else {
+                                if (x[1] <= -1.3598531484603882) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    if (x[1] <= -1.3523772358894348) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+                            }
+                        }
+
+                        else {
+                            if (x[4] <= -0.6270791888237) {
+                                votes[4] += 1;
+                            }
+
+                            else {
+                                if (x[0] <= -0.022755985148251057) {
+                                    if (x[1] <= -0.023531640879809856) {
+                                        if (x[3] <= -0.8279328644275665) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[4] <= 0.3337249904870987) {
+                                            votes[0] += 1;
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.6954151690006256) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    if (x[3] <= 0.18170464783906937) {
+                                        if (x[3] <= -1.1711207032203674) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[4] <= 0.8473138213157654) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[3] <= 0.3143085688352585) {
+                                            if (x[4] <= 0.9388189911842346) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[1] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            votes[1] += 1;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+
+                        // tree #12
+                        if (x[0] <= -1.1822214126586914) {
+                            votes[4] += 1;
+                        }
+
+                        else {
+                            if (x[4] <= -0.6361008286476135) {
+                                if (x[2] <= -0.5524577498435974) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    if (x[2] <= -0.5007578432559967) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+                            }
+
+                            else {
+                                if (x[3] <= -0.01091834669932723) {
+                                    if (x[3] <= -0.9988028407096863) {
+                                        if (x[0] <= 0.25234784185886383) {
+                                            if (x[3] <= -1.1700692772865295) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[1] <= -0.3917209208011627) {
+                                            if (x[2] <= -0.1971070095896721) {
+                                                votes[1] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.8539262115955353) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    if (x[0] <= 0.25651609897613525) {
+                                        if (x[1] <= 0.02506186906248331) {
+                                            votes[0] += 1;
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[4] <= 1.182403177022934) {
+                                            votes[0] += 1;
+                                        }
+
+                                        else {
+                                            votes[1] += 1;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+
+                        // tree #13
+                        if (x[4] <= -0.5948590636253357) {
+                            if (x[2] <= 0.19098703563213348) {
+                                if (x[0] <= 0.6927918791770935) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    if (x[2] <= -0.5524577498435974) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        if (x[2] <= -0.5179911553859711) {
+                                            votes[2] += 1;
+                                        }
+
+                                        else {
+                                            votes[2] += 1;
+                                        }
+                                    }
+                                }
+                            }
+
+                            else {
+                                votes[4] += 1;
+                            }
+                        }
+
+                        else {
+                            if (x[3] <= 0.06102871336042881) {
+                                if (x[1] <= -0.1637052297592163) {
+                                    if (x[0] <= 0.07172412052750587) {
+                                        if (x[1] <= -0.41041073203086853) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[4] <= 0.24028662592172623) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[3] <= -1.0879868268966675) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.6529605090618134) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    if (x[0] <= -0.20546383410692215) {
+                                        if (x[0] <= -0.47778885066509247) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            votes[3] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[4] <= 0.02312297560274601) {
+                                            votes[0] += 1;
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.2080746591091156) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+
+                            else {
+                                if (x[3] <= 0.30158767104148865) {
+                                    if (x[0] <= 0.4920216351747513) {
+                                        if (x[4] <= 0.7429206073284149) {
+                                            votes[0] += 1;
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        votes[1] += 1;
+                                    }
+                                }
+
+                                else {
+                                    if (x[4] <= 0.9684615433216095) {
+                                        votes[3] += 1;
+                                    }
+
+                                    else {
+                                        votes[1] += 1;
+                                    }
+                                }
+                            }
+                        }
+
+                        // tree #14
+                        if (x[0] <= -1.1731902360916138) {
+                            votes[4] += 1;
+                        }
+
+                        else {
+                            if (x[3] <= -0.13519680500030518) {
+                                if (x[1] <= -0.2627612203359604) {
+                                    if (x[0] <= 0.021705240476876497) {
+                                        if (x[0] <= -0.024840104393661022) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            votes[3] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[3] <= -1.0894519686698914) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[0] <= 0.4128250926733017) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    if (x[3] <= -1.1700692772865295) {
+                                        votes[3] += 1;
+                                    }
+
+                                    else {
+                                        if (x[4] <= -0.07611501403152943) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[2] <= 0.5366871356964111) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+
+                            else {
+                                if (x[4] <= -0.36996256560087204) {
+                                    if (x[4] <= -0.7546708881855011) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+
+                                else {
+                                    if (x[0] <= 0.2849990576505661) {
+                                        if (x[1] <= -0.047828396782279015) {
+                                            votes[1] += 1;
+                                        }
+
+                                        else {
+                                            if (x[3] <= 0.3674500957131386) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[1] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[4] <= 0.9388189911842346) {
+                                            if (x[0] <= 0.4475604146718979) {
+                                                votes[1] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            votes[1] += 1;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+
+                        // tree #15
+                        if (x[1] <= -1.1710860133171082) {
+                            if (x[4] <= -0.7965570688247681) {
+                                if (x[3] <= 0.38367006182670593) {
+                                    if (x[3] <= 0.37272460758686066) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+
+                                else {
+                                    votes[2] += 1;
+                                }
+                            }
+
+                            else {
+                                votes[2] += 1;
+                            }
+                        }
+
+                        else {
+                            if (x[4] <= 0.9484850466251373) {
+                                if (x[4] <= -0.6270791888237) {
+                                    votes[4] += 1;
+                                }
+
+                                else {
+                                    if (x[4] <= 0.11913895606994629) {
+                                        if (x[3] <= -0.8539262115955353) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.14478055387735367) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[1] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[3] <= -1.1617782711982727) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[1] <= -0.4141487032175064) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+
+                            else {
+                                votes[1] += 1;
                             }
                         }
 
@@ -302,7 +1259,7 @@ namespace Eloquent {
                         uint8_t classIdx = 0;
                         float maxVotes = votes[0];
 
-                        for (uint8_t i = 1; i < 4; i++) {
+                        for (uint8_t i = 1; i < 5; i++) {
                             if (votes[i] > maxVotes) {
                                 classIdx = i;
                                 maxVotes = votes[i];
@@ -316,4 +1273,4 @@ namespace Eloquent {
                 };
             }
         }
-    }
\ No newline at end of file
+    }
@@ -0,0 +1,20 @@
+/*
+ * Solar Panel Fault Detection - Autotuned Backend
+ * Generated from solar_fault_rf_model.joblib (sha256 1b364580bcfcb794)
+ * Target: host, flash budget 16384 bytes
+ * Fastest backend within budget: if-else (39.5 ns, 3042 bytes)
+ * Every candidate: autotune_report.txt
+ * 
+ * Host-specific: timed on Intel(R) Xeon(R) Processor, g++ (Debian 12.2.0-14+deb12u1) 12.2.0.
+ * Backends a few ns apart can swap places between runs; re-run
+ * step3_export_to_esp32.py --autotune on the machine that will use it.
+ * 
+ * Usage: int fault_type = model_predict(features);
+ */
+
+#ifndef SOLAR_FAULT_MODEL_BEST_H
+#define SOLAR_FAULT_MODEL_BEST_H
+
+#include "model_select.h"
+
+#endif // SOLAR_FAULT_MODEL_BEST_H
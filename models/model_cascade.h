@@ -0,0 +1,40 @@
+/*
+ * Solar Panel Fault Detection - Two-Stage Cascade (prefilter + forest)
+ * Generated from solar_fault_rf_model.joblib (sha256 1b364580bcfcb794)
+ * First stage answers 68.7% of the dataset rows, 17 of them differently from the forest
+ * Trained with cascade_min_precision = 0.999
+ * 
+ * Classes:
+ *   0: Dust_Accumulation
+ *   1: Normal
+ *   2: Open_Circuit
+ *   3: Partial_Shading
+ *   4: Short_Circuit
+ * 
+ * Usage: int fault_type = cascade_predict(features);
+ */
+
+#ifndef SOLAR_FAULT_MODEL_CASCADE_H
+#define SOLAR_FAULT_MODEL_CASCADE_H
+
+#include "model_table.h"
+#include "forest_cascade.h"
+
+// First stage: Current <= 0.6
+//   yes: Open_Circuit
+//   no: Efficiency <= 18.5472 ? forest : Normal
+const CascadePrefilter SOLAR_CASCADE = {
+    { 0.600000024f, 1 },   // root
+    { { 0.0f, CASCADE_LEAF }, { 18.5471821f, 4 } },   // children
+    { 2, 2, CASCADE_FOREST, 1 },   // leaves
+    0,   // voltage_feature
+    1,   // current_feature
+    3,   // light_feature
+};
+
+// Main prediction function - returns class index
+inline int cascade_predict(const float* features) {
+    return cascade_forest_predict(&SOLAR_CASCADE, &SOLAR_FOREST, features);
+}
+
+#endif // SOLAR_FAULT_MODEL_CASCADE_H
@@ -0,0 +1,367 @@
+/*
+ * Solar Panel Fault Detection - Random Forest Model (compact nodes)
+ * Generated from solar_fault_rf_model.joblib (sha256 1b364580bcfcb794)
+ * Trees: 15, Max Depth: 6, Nodes: 269, Thresholds: 106 (1560 bytes)
+ * Thresholds: raw sensor units (StandardScaler folded in)
+ * 
+ * Classes:
+ *   0: Dust_Accumulation
+ *   1: Normal
+ *   2: Open_Circuit
+ *   3: Partial_Shading
+ *   4: Short_Circuit
+ * 
+ * Usage: int fault_type = compact_forest_predict(&SOLAR_COMPACT_FOREST, features);
+ */
+
+#ifndef SOLAR_FAULT_MODEL_COMPACT_H
+#define SOLAR_FAULT_MODEL_COMPACT_H
+
+#define FOREST_COMPACT_MAX_FEATURES 5
+#define FOREST_COMPACT_MAX_CLASSES 5
+#include "forest_compact.h"
+
+// Fault type names
+const char* const COMPACT_CLASS_NAMES[] = {
+    "Dust_Accumulation",
+    "Normal",
+    "Open_Circuit",
+    "Partial_Shading",
+    "Short_Circuit",
+};
+
+// Split thresholds of each feature, ascending
+const float COMPACT_THRESHOLDS[] = {
+    // Feature 0: 23 thresholds
+    5.98500061f, 6.01000023f, 6.05000067f, 6.07500029f, 6.10500097f, 13.0149994f, 13.0999994f, 13.1699991f,
+    13.5349998f, 13.9449997f, 14.329999f, 14.374999f, 14.3949995f, 14.4349995f, 14.6499996f, 14.874999f,
+    15.0099993f, 15.3999996f, 16.3099995f, 16.3399982f, 16.5449982f, 17.7149982f, 18.0349979f,
+    // Feature 1: 22 thresholds
+    0.680000424f, 0.69500047f, 0.740000367f, 0.750000298f, 2.43999982f, 2.63499999f, 2.70499992f, 2.74000001f,
+    2.75499988f, 2.76499987f, 2.86999989f, 2.99499989f, 3.1099999f, 3.20499992f, 3.37499976f, 3.56999969f,
+    3.63999987f, 3.6849997f, 3.74999976f, 3.8099997f, 3.82499981f, 5.19999933f,
+    // Feature 2: 6 thresholds
+    42.1149979f, 45.9349976f, 47.7449989f, 55.6699982f, 56.0249977f, 56.9749985f,
+    // Feature 3: 30 thresholds
+    377.73996f, 383.259949f, 383.564941f, 385.96994f, 404.189972f, 404.799957f, 406.949951f, 407.374969f,
+    407.494965f, 426.814941f, 433.044952f, 433.244965f, 471.684967f, 475.269958f, 475.654968f, 482.809967f,
+    679.734924f, 680.974915f, 683.754944f, 719.804932f, 721.264954f, 725.604919f, 740.674927f, 765.379944f,
+    767.369934f, 775.679932f, 786.299927f, 810.454956f, 814.144958f, 829.559937f,
+    // Feature 4: 25 thresholds
+    4.05000019f, 4.13999987f, 4.38500023f, 4.40999985f, 4.4550004f, 4.53000021f, 4.7050004f, 6.45000029f,
+    8.22999954f, 8.72999954f, 9.00500011f, 9.13500023f, 9.71000004f, 10.2449999f, 11.8800001f, 16.6049995f,
+    16.6299992f, 16.6800003f, 16.75f, 16.8349991f, 18.4699993f, 18.4949989f, 18.5049992f, 18.5300007f,
+    18.6800003f,
+};
+
+const uint16_t COMPACT_FEATURE_OFFSETS[] = {
+    0, 23, 45, 51, 81, 106
+};
+
+// Node table: { feature << 12 | threshold index (leaves: FOREST_COMPACT_LEAF | class), right }
+const ForestCompactNode COMPACT_NODES[] = {
+    // Tree 0
+    { 0x0001, 2 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    { 0x4001, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { 0x4018, 10 },
+    { 0x3008, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { 0x1008, 4 },
+    { 0x000B, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x0008, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    // Tree 1
+    { 0x1001, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { 0x4003, 2 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    { 0x3014, 10 },
+    { 0x3005, 4 },
+    { 0x100F, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x0007, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { 0x1004, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x4016, 4 },
+    { 0x301A, 2 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    // Tree 2
+    { 0x0003, 2 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    { 0x4006, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { 0x4011, 8 },
+    { 0x100D, 4 },
+    { 0x000D, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x0006, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    // Tree 3
+    { 0x0001, 2 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    { 0x1003, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { 0x4010, 14 },
+    { 0x000C, 8 },
+    { 0x400E, 4 },
+    { 0x1014, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x2001, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x3001, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { 0x1009, 2 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    // Tree 4
+    { 0x2005, 18 },
+    { 0x1000, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { 0x4015, 14 },
+    { 0x100B, 6 },
+    { 0x300C, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { 0x1007, 2 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x400A, 4 },
+    { 0x1015, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    { 0x3000, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    // Tree 5
+    { 0x0001, 2 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    { 0x4005, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { 0x4012, 12 },
+    { 0x300A, 6 },
+    { 0x0011, 4 },
+    { 0x1010, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x0009, 4 },
+    { 0x300E, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    // Tree 6
+    { 0x1001, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { 0x2003, 8 },
+    { 0x4017, 6 },
+    { 0x3004, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { 0x1005, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    // Tree 7
+    { 0x4000, 4 },
+    { 0x2002, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    { 0x3018, 10 },
+    { 0x3005, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { 0x4008, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { 0x3010, 2 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x000F, 2 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    // Tree 8
+    { 0x2004, 16 },
+    { 0x1003, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { 0x4012, 12 },
+    { 0x3008, 4 },
+    { 0x100F, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x100A, 4 },
+    { 0x000B, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x0008, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    // Tree 9
+    { 0x0004, 2 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    { 0x1002, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { 0x3015, 10 },
+    { 0x3009, 4 },
+    { 0x1013, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x400B, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { 0x1009, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x4014, 6 },
+    { 0x400C, 2 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { 0x3017, 2 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    // Tree 10
+    { 0x1000, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { 0x4004, 2 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    { 0x000A, 6 },
+    { 0x1012, 4 },
+    { 0x300F, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x3019, 4 },
+    { 0x3001, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x301C, 4 },
+    { 0x400F, 2 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    // Tree 11
+    { 0x0000, 2 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    { 0x4002, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { 0x3013, 10 },
+    { 0x300B, 4 },
+    { 0x0012, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x1009, 4 },
+    { 0x2000, 2 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x0013, 2 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x4015, 2 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    // Tree 12
+    { 0x4006, 4 },
+    { 0x2002, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    { 0x3016, 10 },
+    { 0x100E, 6 },
+    { 0x0010, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { 0x3007, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x0005, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x301B, 4 },
+    { 0x0016, 2 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { 0x4013, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    // Tree 13
+    { 0x0002, 2 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    { 0x3012, 12 },
+    { 0x100C, 6 },
+    { 0x000E, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { 0x3006, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x3002, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { 0x4009, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { 0x4007, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { 0x0014, 6 },
+    { 0x1011, 2 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { 0x301D, 2 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { 0x400F, 4 },
+    { 0x0015, 2 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    // Tree 14
+    { 0x1000, 2 },
+    { FOREST_COMPACT_LEAF | 2, 0 },
+    { 0x4011, 14 },
+    { 0x4004, 2 },
+    { FOREST_COMPACT_LEAF | 4, 0 },
+    { 0x400D, 6 },
+    { 0x300D, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { 0x3011, 2 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+    { 0x3003, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { 0x1006, 2 },
+    { FOREST_COMPACT_LEAF | 3, 0 },
+    { FOREST_COMPACT_LEAF | 0, 0 },
+    { FOREST_COMPACT_LEAF | 1, 0 },
+};
+
+// Root node of each tree
+const uint32_t COMPACT_ROOTS[] = {
+    0, 15, 34, 47, 66, 85, 102, 113, 128, 145, 166, 185, 204, 225, 252,
+};
+
+const CompactForest SOLAR_COMPACT_FOREST = {
+    COMPACT_NODES,
+    COMPACT_ROOTS,
+    COMPACT_THRESHOLDS,
+    COMPACT_FEATURE_OFFSETS,
+    15,   // num_trees
+    5,    // num_features
+    5,    // num_classes
+    NULL,   // scaler_mean: folded into thresholds
+    NULL,   // scaler_std
+    COMPACT_CLASS_NAMES,
+};
+
+#endif // SOLAR_FAULT_MODEL_COMPACT_H
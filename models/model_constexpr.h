@@ -0,0 +1,661 @@
+/*
+ * Solar Panel Fault Detection - Random Forest Model (C++17 constexpr)
+ * Generated from solar_fault_rf_model.joblib (sha256 1b364580bcfcb794)
+ * Trees: 15, Max Depth: 6, Nodes: 269
+ * Thresholds: raw sensor units (StandardScaler folded in)
+ * 
+ * Classes:
+ *   0: Dust_Accumulation
+ *   1: Normal
+ *   2: Open_Circuit
+ *   3: Partial_Shading
+ *   4: Short_Circuit
+ * 
+ * Usage: int fault_type = cx_predict(features);        // unrolled trees
+ *        int fault_type = forest_predict(&SOLAR_FOREST_CX, features);  // table
+ */
+
+#ifndef SOLAR_FAULT_MODEL_CONSTEXPR_H
+#define SOLAR_FAULT_MODEL_CONSTEXPR_H
+
+#include "forest_constexpr.h"
+
+inline constexpr int CX_NUM_FEATURES = 5;
+inline constexpr int CX_NUM_CLASSES = 5;
+inline constexpr int CX_NUM_TREES = 15;
+inline constexpr int CX_NUM_NODES = 269;
+inline constexpr int CX_MAX_DEPTH = 6;
+
+// Fault type names
+inline constexpr const char* CX_CLASS_NAMES[] = {
+    "Dust_Accumulation",
+    "Normal",
+    "Open_Circuit",
+    "Partial_Shading",
+    "Short_Circuit",
+};
+
+// Feature names (for debugging)
+inline constexpr const char* CX_FEATURE_NAMES[] = {
+    "Voltage",
+    "Current",
+    "Temperature",
+    "Light_Intensity",
+    "Efficiency",
+};
+
+// Node table: { threshold, right, feature, value }
+inline constexpr ForestNode CX_NODES[] = {
+    // Tree 0
+    { 6.01000023f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.13999987f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 18.6800003f, 10, 4, 0 },
+    { 407.494965f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.75499988f, 4, 1, 0 },
+    { 14.374999f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.5349998f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 1
+    { 0.69500047f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 4.40999985f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 721.264954f, 10, 3, 0 },
+    { 404.799957f, 4, 3, 0 },
+    { 3.56999969f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.1699991f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.43999982f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 18.5049992f, 4, 4, 0 },
+    { 786.299927f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 2
+    { 6.07500029f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.7050004f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.6800003f, 8, 4, 0 },
+    { 3.20499992f, 4, 1, 0 },
+    { 14.4349995f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.0999994f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 3
+    { 6.01000023f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 0.750000298f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.6299992f, 14, 4, 0 },
+    { 14.3949995f, 8, 0, 0 },
+    { 11.8800001f, 4, 4, 0 },
+    { 3.82499981f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 45.9349976f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 383.259949f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.76499987f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 4
+    { 56.9749985f, 18, 2, 0 },
+    { 0.680000424f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 18.4949989f, 14, 4, 0 },
+    { 2.99499989f, 6, 1, 0 },
+    { 471.684967f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.74000001f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 9.00500011f, 4, 4, 0 },
+    { 5.19999933f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 377.73996f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    // Tree 5
+    { 6.01000023f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.53000021f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.75f, 12, 4, 0 },
+    { 433.044952f, 6, 3, 0 },
+    { 15.3999996f, 4, 0, 0 },
+    { 3.63999987f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.9449997f, 4, 0, 0 },
+    { 475.654968f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 6
+    { 0.69500047f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 55.6699982f, 8, 2, 0 },
+    { 18.5300007f, 6, 4, 0 },
+    { 404.189972f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.63499999f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    // Tree 7
+    { 4.05000019f, 4, 4, 0 },
+    { 47.7449989f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 767.369934f, 10, 3, 0 },
+    { 404.799957f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 8.22999954f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 679.734924f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 14.874999f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 8
+    { 56.0249977f, 16, 2, 0 },
+    { 0.750000298f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.75f, 12, 4, 0 },
+    { 407.494965f, 4, 3, 0 },
+    { 3.56999969f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 2.86999989f, 4, 1, 0 },
+    { 14.374999f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.5349998f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    // Tree 9
+    { 6.10500097f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 0.740000367f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 725.604919f, 10, 3, 0 },
+    { 426.814941f, 4, 3, 0 },
+    { 3.8099997f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 9.13500023f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.76499987f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 18.4699993f, 6, 4, 0 },
+    { 9.71000004f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 765.379944f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 10
+    { 0.680000424f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 4.4550004f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 14.329999f, 6, 0, 0 },
+    { 3.74999976f, 4, 1, 0 },
+    { 482.809967f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 775.679932f, 4, 3, 0 },
+    { 383.259949f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 814.144958f, 4, 3, 0 },
+    { 16.6049995f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 11
+    { 5.98500061f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.38500023f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 719.804932f, 10, 3, 0 },
+    { 433.244965f, 4, 3, 0 },
+    { 16.3099995f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 2.76499987f, 4, 1, 0 },
+    { 42.1149979f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 16.3399982f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 18.4949989f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 12
+    { 4.7050004f, 4, 4, 0 },
+    { 47.7449989f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 740.674927f, 10, 3, 0 },
+    { 3.37499976f, 6, 1, 0 },
+    { 15.0099993f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 407.374969f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.0149994f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 810.454956f, 4, 3, 0 },
+    { 18.0349979f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 16.8349991f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 13
+    { 6.05000067f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 683.754944f, 12, 3, 0 },
+    { 3.1099999f, 6, 1, 0 },
+    { 14.6499996f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 406.949951f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 383.564941f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 8.72999954f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 6.45000029f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.5449982f, 6, 0, 0 },
+    { 3.6849997f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 829.559937f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 16.6049995f, 4, 4, 0 },
+    { 17.7149982f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 14
+    { 0.680000424f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.6800003f, 14, 4, 0 },
+    { 4.4550004f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 10.2449999f, 6, 4, 0 },
+    { 475.269958f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 680.974915f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 385.96994f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.70499992f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+};
+
+// Root node of each tree
+inline constexpr uint16_t CX_ROOTS[] = {
+    0, 15, 34, 47, 66, 85, 102, 113, 128, 145, 166, 185, 204, 225, 252
+};
+
+static_assert(sizeof(CX_FEATURE_NAMES) / sizeof(CX_FEATURE_NAMES[0]) == CX_NUM_FEATURES,
+              "feature count does not match the feature names");
+static_assert(sizeof(CX_CLASS_NAMES) / sizeof(CX_CLASS_NAMES[0]) == CX_NUM_CLASSES,
+              "class count does not match the class names");
+static_assert(CX_NUM_FEATURES <= FOREST_MAX_FEATURES && CX_NUM_CLASSES <= FOREST_MAX_CLASSES,
+              "raise FOREST_MAX_FEATURES / FOREST_MAX_CLASSES");
+static_assert(sizeof(CX_NODES) / sizeof(CX_NODES[0]) == CX_NUM_NODES &&
+              sizeof(CX_ROOTS) / sizeof(CX_ROOTS[0]) == CX_NUM_TREES,
+              "node or tree count mismatch");
+static_assert(forest_cx_valid(CX_NODES, CX_NUM_NODES, CX_NUM_FEATURES, CX_NUM_CLASSES),
+              "node with an unknown feature, class or child offset");
+static_assert(forest_cx_max_depth(CX_NODES, CX_ROOTS, CX_NUM_TREES) == CX_MAX_DEPTH,
+              "tree depth does not match the export");
+
+// Probe inputs (raw units) and the class the exporter computed
+inline constexpr float CX_CHECK_INPUTS[][5] = {
+    { 20.0f, 5.0f, 35.0f, 1000.0f, 18.0f },
+    { 12.0f, 2.5f, 45.0f, 300.0f, 8.0f },
+    { 16.5f, 4.0f, 45.0f, 550.0f, 13.0f },
+    { 22.0f, 0.0500000007f, 30.0f, 900.0f, 1.0f },
+    { 1.5f, 8.0f, 70.0f, 800.0f, 1.5f },
+    { 6.01000023f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 6.01000071f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.13999987f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.14000034f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 18.6800003f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 18.6800022f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 407.494965f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 407.494995f, 9.3205862f },
+    { 14.4937811f, 2.75499988f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 2.75500011f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.374999f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.375f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 13.5349998f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 13.5350008f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.69500047f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.695000529f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.40999985f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.41000032f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 721.264954f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 721.265015f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 404.799957f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 404.799988f, 9.3205862f },
+    { 14.4937811f, 3.56999969f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.56999993f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 13.1699991f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 13.1700001f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 2.43999982f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 2.44000006f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 18.5049992f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 18.5050011f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 786.299927f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 786.299988f, 9.3205862f },
+    { 6.07500029f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 6.07500076f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.7050004f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.70500088f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.6800003f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.6800022f },
+    { 14.4937811f, 3.20499992f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.20500016f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4349995f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4350004f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 13.0999994f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 13.1000004f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 6.01000023f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 6.01000071f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.750000298f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.750000358f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.6299992f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.6300011f },
+    { 14.3949995f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.3950005f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 11.8800001f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 11.8800011f },
+    { 14.4937811f, 3.82499981f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.82500005f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 45.9349976f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 45.9350014f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 383.259949f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 383.259979f, 9.3205862f },
+    { 14.4937811f, 2.76499987f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 2.7650001f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 56.9749985f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 56.9750023f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.680000424f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.680000484f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 18.4949989f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 18.4950008f },
+    { 14.4937811f, 2.99499989f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 2.99500012f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 471.684967f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 471.684998f, 9.3205862f },
+    { 14.4937811f, 2.74000001f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 2.74000025f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 9.00500011f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 9.00500107f },
+    { 14.4937811f, 5.19999933f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 5.19999981f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 377.73996f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 377.73999f, 9.3205862f },
+    { 6.01000023f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 6.01000071f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.53000021f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.53000069f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.75f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.7500019f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 433.044952f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 433.044983f, 9.3205862f },
+    { 15.3999996f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 15.4000006f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.63999987f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.6400001f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 13.9449997f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 13.9450006f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 475.654968f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 475.654999f, 9.3205862f },
+    { 14.4937811f, 0.69500047f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.695000529f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 55.6699982f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 55.670002f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 18.5300007f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 18.5300026f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 404.189972f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 404.190002f, 9.3205862f },
+    { 14.4937811f, 2.63499999f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 2.63500023f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.05000019f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.05000067f },
+    { 14.4937811f, 3.812953f, 47.7449989f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 47.7450027f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 767.369934f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 767.369995f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 404.799957f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 404.799988f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 8.22999954f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 8.2300005f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 679.734924f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 679.734985f, 9.3205862f },
+    { 14.874999f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.875f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 56.0249977f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 56.0250015f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.750000298f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.750000358f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.75f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.7500019f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 407.494965f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 407.494995f, 9.3205862f },
+    { 14.4937811f, 3.56999969f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.56999993f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 2.86999989f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 2.87000012f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.374999f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.375f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 13.5349998f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 13.5350008f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 6.10500097f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 6.10500145f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.740000367f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.740000427f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 725.604919f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 725.60498f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 426.814941f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 426.814972f, 9.3205862f },
+    { 14.4937811f, 3.8099997f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.80999994f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 9.13500023f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 9.13500118f },
+    { 14.4937811f, 2.76499987f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 2.7650001f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 18.4699993f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 18.4700012f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 9.71000004f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 9.71000099f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 765.379944f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 765.380005f, 9.3205862f },
+    { 14.4937811f, 0.680000424f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.680000484f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.4550004f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.45500088f },
+    { 14.329999f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.3299999f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.74999976f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.75f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 482.809967f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 482.809998f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 775.679932f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 775.679993f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 383.259949f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 383.259979f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 814.144958f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 814.14502f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.6049995f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.6050014f },
+    { 5.98500061f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 5.98500109f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.38500023f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.38500071f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 719.804932f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 719.804993f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 433.244965f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 433.244995f, 9.3205862f },
+    { 16.3099995f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 16.3100014f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 2.76499987f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 2.7650001f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 42.1149979f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 42.1150017f, 722.972107f, 9.3205862f },
+    { 16.3399982f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 16.3400002f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 18.4949989f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 18.4950008f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.7050004f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.70500088f },
+    { 14.4937811f, 3.812953f, 47.7449989f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 47.7450027f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 740.674927f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 740.674988f, 9.3205862f },
+    { 14.4937811f, 3.37499976f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.375f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 15.0099993f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 15.0100002f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 407.374969f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 407.375f, 9.3205862f },
+    { 13.0149994f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 13.0150003f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 810.454956f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 810.455017f, 9.3205862f },
+    { 18.0349979f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 18.0349998f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.8349991f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.835001f },
+    { 6.05000067f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 6.05000114f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 683.754944f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 683.755005f, 9.3205862f },
+    { 14.4937811f, 3.1099999f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.11000013f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.6499996f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.6500006f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 406.949951f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 406.949982f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 383.564941f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 383.564972f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 8.72999954f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 8.7300005f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 6.45000029f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 6.45000076f },
+    { 16.5449982f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 16.5450001f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.6849997f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.68499994f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 829.559937f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 829.559998f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.6049995f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.6050014f },
+    { 17.7149982f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 17.7150002f, 3.812953f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.680000424f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 0.680000484f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.6800003f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 16.6800022f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.4550004f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 4.45500088f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 10.2449999f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 722.972107f, 10.2450008f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 475.269958f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 475.269989f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 680.974915f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 680.974976f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 385.96994f, 9.3205862f },
+    { 14.4937811f, 3.812953f, 44.9743919f, 385.969971f, 9.3205862f },
+    { 14.4937811f, 2.70499992f, 44.9743919f, 722.972107f, 9.3205862f },
+    { 14.4937811f, 2.70500016f, 44.9743919f, 722.972107f, 9.3205862f },
+};
+
+inline constexpr uint8_t CX_CHECK_CLASSES[] = {
+    1, 3, 0, 2, 4, 4, 0, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 4, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+// Unrolled trees and table walk must both give the exported class
+constexpr bool cx_checks_pass() {
+    for (size_t i = 0; i < sizeof(CX_CHECK_CLASSES); i++) {
+        int unrolled = forest_cx_predict<CX_NODES, CX_ROOTS, CX_NUM_TREES, CX_NUM_CLASSES>(CX_CHECK_INPUTS[i]);
+        int table = forest_cx_table_predict(CX_NODES, CX_ROOTS, CX_NUM_TREES, CX_NUM_CLASSES, CX_CHECK_INPUTS[i]);
+        if (unrolled != CX_CHECK_CLASSES[i] || table != CX_CHECK_CLASSES[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(cx_checks_pass(), "unrolled trees, table walk and exporter disagree");
+
+// Main prediction function (unrolled trees) - returns class index
+inline int cx_predict(const float* raw_features) {
+    return forest_cx_predict<CX_NODES, CX_ROOTS, CX_NUM_TREES, CX_NUM_CLASSES>(raw_features);
+}
+
+// The same data for the table-driven forest_predict()
+inline constexpr Forest SOLAR_FOREST_CX = {
+    CX_NODES,
+    CX_ROOTS,
+    CX_NUM_TREES,
+    CX_NUM_FEATURES,
+    CX_NUM_CLASSES,
+    nullptr,   // scaler_mean: folded into thresholds
+    nullptr,   // scaler_std
+    CX_CLASS_NAMES,
+};
+
+#endif // SOLAR_FAULT_MODEL_CONSTEXPR_H
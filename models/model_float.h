@@ -0,0 +1,1280 @@
+#pragma once
+#include <cstdarg>
+#include <stdint.h>
+
+// Same forest as model.h, with float32 thresholds (generated by
+// ml/step3_export_to_esp32.py). Inputs are scaled features.
+namespace Eloquent {
+    namespace ML {
+        namespace Port {
+            class RandomForest {
+                public:
+                    /**
+                    * Predict class for features vector
+                    */
+                    int predict(float *x) {
+                        uint8_t votes[5] = { 0 };
+                        // tree #1
+                        if (x[0] <= -1.17874789f) {
+                            votes[4] += 1;
+                        }
+
+                        else {
+                            if (x[4] <= -0.667676568f) {
+                                if (x[2] <= -0.354964077f) {
+                                    if (x[0] <= 0.903982699f) {
+                                        if (x[2] <= -0.553147078f) {
+                                            votes[2] += 1;
+                                        }
+
+                                        else {
+                                            votes[2] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+
+                                else {
+                                    votes[2] += 1;
+                                }
+                            }
+
+                            else {
+                                if (x[4] <= 1.20624602f) {
+                                    if (x[3] <= -1.08757317f) {
+                                        if (x[1] <= -0.0982908905f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            votes[3] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[1] <= -0.395458907f) {
+                                            if (x[0] <= -0.0165036246f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[0] <= -0.13321434f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    votes[1] += 1;
+                                }
+                            }
+                        }
+
+                        // tree #2
+                        if (x[1] <= -1.16547906f) {
+                            if (x[0] <= 0.647635937f) {
+                                votes[2] += 1;
+                            }
+
+                            else {
+                                if (x[4] <= -0.685075462f) {
+                                    if (x[2] <= -0.350483418f) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+
+                                else {
+                                    votes[2] += 1;
+                                }
+                            }
+                        }
+
+                        else {
+                            if (x[4] <= -0.63287884f) {
+                                votes[4] += 1;
+                            }
+
+                            else {
+                                if (x[3] <= -0.00588515494f) {
+                                    if (x[3] <= -1.09686399f) {
+                                        if (x[1] <= -0.090814963f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[0] <= -0.183927938f) {
+                                            if (x[2] <= 0.273706883f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[1] <= -0.513204753f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    if (x[4] <= 1.18369198f) {
+                                        if (x[3] <= 0.218315944f) {
+                                            votes[1] += 1;
+                                        }
+
+                                        else {
+                                            if (x[1] <= 0.0250618681f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        votes[1] += 1;
+                                    }
+                                }
+                            }
+                        }
+
+                        // tree #3
+                        if (x[0] <= -1.16971672f) {
+                            votes[4] += 1;
+                        }
+
+                        else {
+                            if (x[4] <= -0.594859064f) {
+                                if (x[0] <= 0.653193593f) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    if (x[2] <= -0.350483418f) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+                            }
+
+                            else {
+                                if (x[4] <= 0.948485017f) {
+                                    if (x[1] <= -0.227250591f) {
+                                        if (x[0] <= -0.00816714577f) {
+                                            if (x[4] <= 0.358212292f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[2] <= -0.24536027f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[0] <= -0.193653822f) {
+                                            if (x[4] <= -0.181797028f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.210143104f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    votes[1] += 1;
+                                }
+                            }
+                        }
+
+                        // tree #4
+                        if (x[0] <= -1.17874789f) {
+                            votes[4] += 1;
+                        }
+
+                        else {
+                            if (x[1] <= -1.14492035f) {
+                                if (x[0] <= 0.719190717f) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    if (x[2] <= -0.354964077f) {
+                                        if (x[1] <= -1.32247353f) {
+                                            votes[2] += 1;
+                                        }
+
+                                        else {
+                                            if (x[1] <= -1.31125963f) {
+                                                votes[2] += 1;
+                                            }
+
+                                            else {
+                                                votes[2] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+                            }
+
+                            else {
+                                if (x[4] <= 0.94204098f) {
+                                    if (x[0] <= -0.0137247983f) {
+                                        if (x[4] <= 0.329858601f) {
+                                            if (x[1] <= 0.0045030769f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[2] <= 0.0662178919f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[3] <= -1.17112076f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[1] <= -0.391720921f) {
+                                                votes[1] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    votes[1] += 1;
+                                }
+                            }
+                        }
+
+                        // tree #5
+                        if (x[2] <= 0.827240646f) {
+                            if (x[1] <= -1.17108607f) {
+                                if (x[0] <= 0.792829573f) {
+                                    if (x[4] <= -0.9492805f) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+
+                                else {
+                                    if (x[0] <= 0.903287947f) {
+                                        if (x[4] <= -0.857130885f) {
+                                            votes[2] += 1;
+                                        }
+
+                                        else {
+                                            votes[2] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+                            }
+
+                            else {
+                                if (x[4] <= 1.18240309f) {
+                                    if (x[1] <= -0.305747807f) {
+                                        if (x[3] <= -0.866285086f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[1] <= -0.401065826f) {
+                                                votes[1] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[4] <= -0.0406728797f) {
+                                            if (x[1] <= 0.51847285f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[4] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[3] <= -1.19015038f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    votes[1] += 1;
+                                }
+                            }
+                        }
+
+                        else {
+                            votes[4] += 1;
+                        }
+
+                        // tree #6
+                        if (x[0] <= -1.17874789f) {
+                            votes[4] += 1;
+                        }
+
+                        else {
+                            if (x[4] <= -0.617413163f) {
+                                if (x[4] <= -0.786891043f) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    votes[2] += 1;
+                                }
+                            }
+
+                            else {
+                                if (x[4] <= 0.957506657f) {
+                                    if (x[3] <= -0.999492347f) {
+                                        if (x[0] <= 0.125911236f) {
+                                            if (x[1] <= -0.0646492317f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[1] <= 0.0213239044f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[0] <= -0.0762483999f) {
+                                            if (x[3] <= -0.852598965f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[2] <= 0.634572268f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    votes[1] += 1;
+                                }
+                            }
+                        }
+
+                        // tree #7
+                        if (x[1] <= -1.16547906f) {
+                            if (x[4] <= -0.804934323f) {
+                                if (x[0] <= 1.00749397f) {
+                                    if (x[2] <= -0.395634711f) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+
+                                else {
+                                    votes[2] += 1;
+                                }
+                            }
+
+                            else {
+                                votes[2] += 1;
+                            }
+                        }
+
+                        else {
+                            if (x[2] <= 0.737282813f) {
+                                if (x[4] <= 1.18691397f) {
+                                    if (x[3] <= -1.09896684f) {
+                                        if (x[4] <= 0.381410778f) {
+                                            if (x[1] <= -0.090814963f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            votes[3] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[1] <= -0.440314442f) {
+                                            if (x[1] <= -0.595439911f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.00941873156f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    votes[1] += 1;
+                                }
+                            }
+
+                            else {
+                                if (x[1] <= 0.832461715f) {
+                                    votes[4] += 1;
+                                }
+
+                                else {
+                                    votes[4] += 1;
+                                }
+                            }
+                        }
+
+                        // tree #8
+                        if (x[4] <= -0.679275811f) {
+                            if (x[2] <= 0.190987036f) {
+                                if (x[4] <= -0.831354797f) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    votes[2] += 1;
+                                }
+                            }
+
+                            else {
+                                votes[4] += 1;
+                            }
+                        }
+
+                        else {
+                            if (x[3] <= 0.153056815f) {
+                                if (x[3] <= -1.09686399f) {
+                                    if (x[0] <= 0.0981229693f) {
+                                        votes[3] += 1;
+                                    }
+
+                                    else {
+                                        votes[3] += 1;
+                                    }
+                                }
+
+                                else {
+                                    if (x[4] <= -0.140555277f) {
+                                        votes[3] += 1;
+                                    }
+
+                                    else {
+                                        if (x[3] <= -0.149055317f) {
+                                            if (x[4] <= 0.115916938f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[0] <= 0.052967038f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[1] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+
+                            else {
+                                if (x[0] <= 0.254431963f) {
+                                    votes[1] += 1;
+                                }
+
+                                else {
+                                    if (x[2] <= -0.00754064834f) {
+                                        votes[1] += 1;
+                                    }
+
+                                    else {
+                                        votes[1] += 1;
+                                    }
+                                }
+                            }
+                        }
+
+                        // tree #9
+                        if (x[2] <= 0.761754096f) {
+                            if (x[1] <= -1.14492035f) {
+                                if (x[1] <= -1.21033466f) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    votes[2] += 1;
+                                }
+                            }
+
+                            else {
+                                if (x[4] <= 0.957506657f) {
+                                    if (x[3] <= -1.08757317f) {
+                                        if (x[1] <= -0.090814963f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[1] <= -0.352472335f) {
+                                            if (x[0] <= -0.0165036246f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[0] <= -0.13321434f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    votes[1] += 1;
+                                }
+                            }
+                        }
+
+                        else {
+                            votes[4] += 1;
+                        }
+
+                        // tree #10
+                        if (x[0] <= -1.16554844f) {
+                            votes[4] += 1;
+                        }
+
+                        else {
+                            if (x[1] <= -1.14865828f) {
+                                if (x[3] <= -0.0561653599f) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    if (x[1] <= -1.32434249f) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        if (x[2] <= -0.556249082f) {
+                                            if (x[4] <= -0.757248521f) {
+                                                votes[2] += 1;
+                                            }
+
+                                            else {
+                                                votes[2] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            votes[2] += 1;
+                                        }
+                                    }
+                                }
+                            }
+
+                            else {
+                                if (x[3] <= 0.00907652359f) {
+                                    if (x[3] <= -1.02096963f) {
+                                        if (x[1] <= -0.00110386685f) {
+                                            if (x[3] <= -1.06383789f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[4] <= -0.0239184108f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[1] <= -0.391720921f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    if (x[4] <= 1.1791811f) {
+                                        if (x[4] <= 0.050187882f) {
+                                            votes[1] += 1;
+                                        }
+
+                                        else {
+                                            if (x[3] <= 0.146196514f) {
+                                                votes[1] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        votes[1] += 1;
+                                    }
+                                }
+                            }
+                        }
+
+                        // tree #11
+                        if (x[1] <= -1.17108607f) {
+                            if (x[0] <= 0.658056557f) {
+                                votes[2] += 1;
+                            }
+
+                            else {
+                                if (x[1] <= -1.35985315f) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    if (x[1] <= -1.3523773f) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+                            }
+                        }
+
+                        else {
+                            if (x[4] <= -0.627079189f) {
+                                votes[4] += 1;
+                            }
+
+                            else {
+                                if (x[0] <= -0.0227559861f) {
+                                    if (x[1] <= -0.0235316418f) {
+                                        if (x[3] <= -0.827932894f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[4] <= 0.333724976f) {
+                                            votes[0] += 1;
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.695415199f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    if (x[3] <= 0.18170464f) {
+                                        if (x[3] <= -1.17112076f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[4] <= 0.847313821f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[3] <= 0.314308554f) {
+                                            if (x[4] <= 0.938818991f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[1] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            votes[1] += 1;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+
+                        // tree #12
+                        if (x[0] <= -1.18222141f) {
+                            votes[4] += 1;
+                        }
+
+                        else {
+                            if (x[4] <= -0.636100829f) {
+                                if (x[2] <= -0.55245775f) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    if (x[2] <= -0.500757873f) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+                            }
+
+                            else {
+                                if (x[3] <= -0.0109183472f) {
+                                    if (x[3] <= -0.998802841f) {
+                                        if (x[0] <= 0.252347827f) {
+                                            if (x[3] <= -1.17006934f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[1] <= -0.391720921f) {
+                                            if (x[2] <= -0.197107017f) {
+                                                votes[1] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.853926241f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    if (x[0] <= 0.256516099f) {
+                                        if (x[1] <= 0.0250618681f) {
+                                            votes[0] += 1;
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[4] <= 1.18240309f) {
+                                            votes[0] += 1;
+                                        }
+
+                                        else {
+                                            votes[1] += 1;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+
+                        // tree #13
+                        if (x[4] <= -0.594859064f) {
+                            if (x[2] <= 0.190987036f) {
+                                if (x[0] <= 0.692791879f) {
+                                    votes[2] += 1;
+                                }
+
+                                else {
+                                    if (x[2] <= -0.55245775f) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        if (x[2] <= -0.517991185f) {
+                                            votes[2] += 1;
+                                        }
+
+                                        else {
+                                            votes[2] += 1;
+                                        }
+                                    }
+                                }
+                            }
+
+                            else {
+                                votes[4] += 1;
+                            }
+                        }
+
+                        else {
+                            if (x[3] <= 0.0610287115f) {
+                                if (x[1] <= -0.16370523f) {
+                                    if (x[0] <= 0.0717241168f) {
+                                        if (x[1] <= -0.410410732f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[4] <= 0.240286618f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[3] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[3] <= -1.08798683f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.652960539f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    if (x[0] <= -0.205463842f) {
+                                        if (x[0] <= -0.477788866f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            votes[3] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[4] <= 0.0231229756f) {
+                                            votes[0] += 1;
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.208074659f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+
+                            else {
+                                if (x[3] <= 0.301587671f) {
+                                    if (x[0] <= 0.49202162f) {
+                                        if (x[4] <= 0.742920578f) {
+                                            votes[0] += 1;
+                                        }
+
+                                        else {
+                                            votes[0] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        votes[1] += 1;
+                                    }
+                                }
+
+                                else {
+                                    if (x[4] <= 0.968461514f) {
+                                        votes[3] += 1;
+                                    }
+
+                                    else {
+                                        votes[1] += 1;
+                                    }
+                                }
+                            }
+                        }
+
+                        // tree #14
+                        if (x[0] <= -1.17319024f) {
+                            votes[4] += 1;
+                        }
+
+                        else {
+                            if (x[3] <= -0.135196805f) {
+                                if (x[1] <= -0.262761235f) {
+                                    if (x[0] <= 0.02170524f) {
+                                        if (x[0] <= -0.0248401053f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            votes[3] += 1;
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[3] <= -1.08945203f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[0] <= 0.412825078f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+
+                                else {
+                                    if (x[3] <= -1.17006934f) {
+                                        votes[3] += 1;
+                                    }
+
+                                    else {
+                                        if (x[4] <= -0.0761150196f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[2] <= 0.536687136f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+
+                            else {
+                                if (x[4] <= -0.369962573f) {
+                                    if (x[4] <= -0.754670918f) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+
+                                else {
+                                    if (x[0] <= 0.284999043f) {
+                                        if (x[1] <= -0.0478283986f) {
+                                            votes[1] += 1;
+                                        }
+
+                                        else {
+                                            if (x[3] <= 0.367450088f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[1] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[4] <= 0.938818991f) {
+                                            if (x[0] <= 0.4475604f) {
+                                                votes[1] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+
+                                        else {
+                                            votes[1] += 1;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+
+                        // tree #15
+                        if (x[1] <= -1.17108607f) {
+                            if (x[4] <= -0.796557069f) {
+                                if (x[3] <= 0.383670062f) {
+                                    if (x[3] <= 0.372724593f) {
+                                        votes[2] += 1;
+                                    }
+
+                                    else {
+                                        votes[2] += 1;
+                                    }
+                                }
+
+                                else {
+                                    votes[2] += 1;
+                                }
+                            }
+
+                            else {
+                                votes[2] += 1;
+                            }
+                        }
+
+                        else {
+                            if (x[4] <= 0.948485017f) {
+                                if (x[4] <= -0.627079189f) {
+                                    votes[4] += 1;
+                                }
+
+                                else {
+                                    if (x[4] <= 0.119138956f) {
+                                        if (x[3] <= -0.853926241f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[3] <= -0.144780561f) {
+                                                votes[0] += 1;
+                                            }
+
+                                            else {
+                                                votes[1] += 1;
+                                            }
+                                        }
+                                    }
+
+                                    else {
+                                        if (x[3] <= -1.16177833f) {
+                                            votes[3] += 1;
+                                        }
+
+                                        else {
+                                            if (x[1] <= -0.414148718f) {
+                                                votes[3] += 1;
+                                            }
+
+                                            else {
+                                                votes[0] += 1;
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+
+                            else {
+                                votes[1] += 1;
+                            }
+                        }
+
+                        // return argmax of votes
+                        uint8_t classIdx = 0;
+                        uint8_t maxVotes = votes[0];
+
+                        for (uint8_t i = 1; i < 5; i++) {
+                            if (votes[i] > maxVotes) {
+                                classIdx = i;
+                                maxVotes = votes[i];
+                            }
+                        }
+
+                        return classIdx;
+                    }
+
+                protected:
+                };
+            }
+        }
+    }
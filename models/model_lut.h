@@ -0,0 +1,15 @@
+/*
+ * Solar Panel Fault Detection - Random Forest Model (dense lookup table)
+ * Generated from solar_fault_rf_model.joblib (sha256 1b364580bcfcb794)
+ * Trees: 15, Bins per feature: 24 x 23 x 7 x 31 x 26 = 3114384 boxes
+ * Thresholds: raw sensor units (StandardScaler folded in)
+ * Not available: the table needs 3114384 bytes (lut_max_bytes is 8192).
+ * There is no lut_predict(); use model_table.h or model_manual.h.
+ */
+
+#ifndef SOLAR_FAULT_MODEL_LUT_H
+#define SOLAR_FAULT_MODEL_LUT_H
+
+#define LUT_AVAILABLE 0
+
+#endif // SOLAR_FAULT_MODEL_LUT_H
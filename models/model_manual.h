@@ -1,24 +1,44 @@
 /*
  * Solar Panel Fault Detection - Random Forest Model
- * Generated: 2026-01-02 15:41:16
- * Trees: 10, Max Depth: 5
+ * Generated from solar_fault_rf_model.joblib (sha256 1b364580bcfcb794)
+ * Trees: 15, Max Depth: 6
+ * Thresholds: raw sensor units (StandardScaler folded in)
+ * Branch order: hot side first (node profile)
  * 
  * Classes:
- *   0: Normal
- *   1: Open_Circuit
- *   2: Partial_Shading
- *   3: Short_Circuit
+ *   0: Dust_Accumulation
+ *   1: Normal
+ *   2: Open_Circuit
+ *   3: Partial_Shading
+ *   4: Short_Circuit
  */
 
 #ifndef SOLAR_FAULT_MODEL_H
 #define SOLAR_FAULT_MODEL_H
 
-#define NUM_FEATURES 4
-#define NUM_CLASSES 4
-#define NUM_TREES 10
+#include <stddef.h>
+#include <stdint.h>
+
+#define NUM_FEATURES 5
+#define NUM_CLASSES 5
+#define NUM_TREES 15
+
+// 1: trees compare raw readings (scaler folded in), 0: scaled features
+#define RAW_THRESHOLDS 1
+
+// Class index of 'Normal' (every other class is a fault)
+#define NORMAL_CLASS 1
+
+// Branch hint for splits where the profile shows one side is nearly always taken
+#if defined(__GNUC__)
+#define FOREST_LIKELY(x) __builtin_expect(!!(x), 1)
+#else
+#define FOREST_LIKELY(x) (x)
+#endif
 
 // Fault type names
 const char* CLASS_NAMES[] = {
+    "Dust_Accumulation",
     "Normal",
     "Open_Circuit",
     "Partial_Shading",
@@ -31,15 +51,16 @@ const char* FEATURE_NAMES[] = {
     "Current",
     "Temperature",
     "Light_Intensity",
+    "Efficiency",
 };
 
 // StandardScaler parameters
 const float SCALER_MEAN[] = {
-    13.530488f, 3.746800f, 43.080350f, 900.020213f
+    14.493781f, 3.812953f, 44.974391f, 722.972133f, 9.320586f
 };
 
 const float SCALER_STD[] = {
-    8.256446f, 3.049463f, 14.431640f, 169.050730f
+    7.197282f, 2.675254f, 14.506793f, 290.074402f, 7.759125f
 };
 
 // Apply StandardScaler transformation
@@ -49,250 +70,615 @@ void scale_features(float* features, float* scaled) {
     }
 }
 
+// Trees read feature f of one sample as features[f], from a feature row
+// (const float*) or from one sample of a column-major batch:
+// sample i of column-major X (X[f * n + i]), read in place
+struct ColumnRow {
+    const float* sample;   // X + i
+    size_t n;
+    float operator[](int f) const { return sample[f * n]; }
+};
+
 // Decision Tree 0
-int predict_tree_0(float* features) {
-    if (features[1] <= 0.756920f) {
-        if (features[0] <= 0.285778f) {
-            return 2;
+template <typename Row>
+int predict_tree_0(Row features) {
+    if (FOREST_LIKELY(!(features[0] <= 6.01000023f))) {
+        if (!(features[4] <= 4.13999987f)) {
+            if (!(features[4] <= 18.6800003f)) {
+                return 1;
+            } else {
+                if (FOREST_LIKELY(!(features[3] <= 407.494965f))) {
+                    if (!(features[1] <= 2.75499988f)) {
+                        if (FOREST_LIKELY(!(features[0] <= 13.5349998f))) {
+                            return 0;
+                        } else {
+                            return 3;
+                        }
+                    } else {
+                        if (FOREST_LIKELY(!(features[0] <= 14.374999f))) {
+                            return 0;
+                        } else {
+                            return 3;
+                        }
+                    }
+                } else {
+                    return 3;
+                }
+            }
         } else {
-            if (features[0] <= 1.016722f) {
-                if (features[0] <= 0.755108f) {
-                    return 0;
+            return 2;
+        }
+    } else {
+        return 4;
+    }
+}
+
+// Decision Tree 1
+template <typename Row>
+int predict_tree_1(Row features) {
+    if (!(features[1] <= 0.69500047f)) {
+        if (FOREST_LIKELY(!(features[4] <= 4.40999985f))) {
+            if (FOREST_LIKELY(!(features[3] <= 721.264954f))) {
+                if (!(features[4] <= 18.5049992f)) {
+                    return 1;
                 } else {
-                    if (features[1] <= -0.546588f) {
-                        return 1;
-                    } else {
+                    if (FOREST_LIKELY(!(features[3] <= 786.299927f))) {
                         return 0;
+                    } else {
+                        return 1;
                     }
                 }
             } else {
-                if (features[3] <= 1.355272f) {
-                    if (features[0] <= 1.037918f) {
-                        return 1;
+                if (!(features[3] <= 404.799957f)) {
+                    if (!(features[0] <= 13.1699991f)) {
+                        if (FOREST_LIKELY(!(features[1] <= 2.43999982f))) {
+                            return 0;
+                        } else {
+                            return 3;
+                        }
                     } else {
-                        return 1;
+                        return 3;
                     }
                 } else {
-                    if (features[2] <= -0.499967f) {
-                        return 1;
+                    if (FOREST_LIKELY(features[1] <= 3.56999969f)) {
+                        return 3;
                     } else {
                         return 0;
                     }
                 }
             }
+        } else {
+            return 4;
         }
     } else {
-        return 3;
+        return 2;
     }
 }
 
-// Decision Tree 1
-int predict_tree_1(float* features) {
-    if (features[2] <= 0.530407f) {
-        if (features[3] <= -0.691717f) {
-            if (features[0] <= 0.454132f) {
-                return 2;
-            } else {
+// Decision Tree 2
+template <typename Row>
+int predict_tree_2(Row features) {
+    if (FOREST_LIKELY(!(features[0] <= 6.07500029f))) {
+        if (!(features[4] <= 4.7050004f)) {
+            if (!(features[4] <= 16.6800003f)) {
                 return 1;
+            } else {
+                if (features[1] <= 3.20499992f) {
+                    if (FOREST_LIKELY(!(features[0] <= 14.4349995f))) {
+                        return 0;
+                    } else {
+                        return 3;
+                    }
+                } else {
+                    if (FOREST_LIKELY(!(features[0] <= 13.0999994f))) {
+                        return 0;
+                    } else {
+                        return 3;
+                    }
+                }
             }
         } else {
-            if (features[2] <= -0.198546f) {
-                if (features[0] <= 0.281539f) {
-                    return 2;
+            return 2;
+        }
+    } else {
+        return 4;
+    }
+}
+
+// Decision Tree 3
+template <typename Row>
+int predict_tree_3(Row features) {
+    if (FOREST_LIKELY(!(features[0] <= 6.01000023f))) {
+        if (!(features[1] <= 0.750000298f)) {
+            if (!(features[4] <= 16.6299992f)) {
+                return 1;
+            } else {
+                if (FOREST_LIKELY(!(features[0] <= 14.3949995f))) {
+                    if (FOREST_LIKELY(!(features[3] <= 383.259949f))) {
+                        if (!(features[1] <= 2.76499987f)) {
+                            return 0;
+                        } else {
+                            return 1;
+                        }
+                    } else {
+                        return 3;
+                    }
                 } else {
-                    if (features[0] <= 0.781149f) {
-                        return 0;
+                    if (features[4] <= 11.8800001f) {
+                        if (FOREST_LIKELY(features[1] <= 3.82499981f)) {
+                            return 3;
+                        } else {
+                            return 0;
+                        }
                     } else {
-                        return 1;
+                        if (!(features[2] <= 45.9349976f)) {
+                            return 0;
+                        } else {
+                            return 3;
+                        }
                     }
                 }
+            }
+        } else {
+            return 2;
+        }
+    } else {
+        return 4;
+    }
+}
+
+// Decision Tree 4
+template <typename Row>
+int predict_tree_4(Row features) {
+    if (features[2] <= 56.9749985f) {
+        if (!(features[1] <= 0.680000424f)) {
+            if (!(features[4] <= 18.4949989f)) {
+                return 1;
             } else {
-                if (features[1] <= -0.107166f) {
-                    return 2;
+                if (features[1] <= 2.99499989f) {
+                    if (FOREST_LIKELY(!(features[3] <= 471.684967f))) {
+                        if (features[1] <= 2.74000001f) {
+                            return 1;
+                        } else {
+                            return 0;
+                        }
+                    } else {
+                        return 3;
+                    }
                 } else {
-                    if (features[3] <= -0.526737f) {
+                    if (!(features[4] <= 9.00500011f)) {
+                        if (FOREST_LIKELY(!(features[3] <= 377.73996f))) {
+                            return 0;
+                        } else {
+                            return 3;
+                        }
+                    } else {
+                        if (FOREST_LIKELY(features[1] <= 5.19999933f)) {
+                            return 3;
+                        } else {
+                            return 4;
+                        }
+                    }
+                }
+            }
+        } else {
+            return 2;
+        }
+    } else {
+        return 4;
+    }
+}
+
+// Decision Tree 5
+template <typename Row>
+int predict_tree_5(Row features) {
+    if (FOREST_LIKELY(!(features[0] <= 6.01000023f))) {
+        if (!(features[4] <= 4.53000021f)) {
+            if (!(features[4] <= 16.75f)) {
+                return 1;
+            } else {
+                if (FOREST_LIKELY(!(features[3] <= 433.044952f))) {
+                    if (FOREST_LIKELY(!(features[0] <= 13.9449997f))) {
                         return 0;
+                    } else {
+                        if (!(features[3] <= 475.654968f)) {
+                            return 0;
+                        } else {
+                            return 3;
+                        }
+                    }
+                } else {
+                    if (FOREST_LIKELY(features[0] <= 15.3999996f)) {
+                        if (FOREST_LIKELY(features[1] <= 3.63999987f)) {
+                            return 3;
+                        } else {
+                            return 0;
+                        }
                     } else {
                         return 0;
                     }
                 }
             }
+        } else {
+            return 2;
         }
     } else {
-        return 3;
+        return 4;
     }
 }
 
-// Decision Tree 2
-int predict_tree_2(float* features) {
-    if (features[0] <= -0.939325f) {
-        return 3;
-    } else {
-        if (features[1] <= -1.025361f) {
-            return 1;
-        } else {
-            if (features[1] <= -0.066176f) {
-                return 2;
+// Decision Tree 6
+template <typename Row>
+int predict_tree_6(Row features) {
+    if (!(features[1] <= 0.69500047f)) {
+        if (features[2] <= 55.6699982f) {
+            if (!(features[4] <= 18.5300007f)) {
+                return 1;
             } else {
-                return 0;
+                if (FOREST_LIKELY(!(features[3] <= 404.189972f))) {
+                    if (!(features[1] <= 2.63499999f)) {
+                        return 0;
+                    } else {
+                        return 3;
+                    }
+                } else {
+                    return 3;
+                }
             }
+        } else {
+            return 4;
         }
+    } else {
+        return 2;
     }
 }
 
-// Decision Tree 3
-int predict_tree_3(float* features) {
-    if (features[1] <= -1.025361f) {
-        return 1;
-    } else {
-        if (features[0] <= 0.285778f) {
-            if (features[1] <= 0.276508f) {
-                return 2;
+// Decision Tree 7
+template <typename Row>
+int predict_tree_7(Row features) {
+    if (!(features[4] <= 4.05000019f)) {
+        if (FOREST_LIKELY(!(features[3] <= 767.369934f))) {
+            return 1;
+        } else {
+            if (!(features[3] <= 404.799957f)) {
+                if (FOREST_LIKELY(!(features[4] <= 8.22999954f))) {
+                    if (features[3] <= 679.734924f) {
+                        return 0;
+                    } else {
+                        if (!(features[0] <= 14.874999f)) {
+                            return 1;
+                        } else {
+                            return 0;
+                        }
+                    }
+                } else {
+                    return 3;
+                }
             } else {
                 return 3;
             }
+        }
+    } else {
+        if (features[2] <= 47.7449989f) {
+            return 2;
         } else {
-            return 0;
+            return 4;
         }
     }
 }
 
-// Decision Tree 4
-int predict_tree_4(float* features) {
-    if (features[1] <= -1.031919f) {
-        return 1;
-    } else {
-        if (features[2] <= 0.530407f) {
-            if (features[1] <= -0.066176f) {
-                return 2;
+// Decision Tree 8
+template <typename Row>
+int predict_tree_8(Row features) {
+    if (features[2] <= 56.0249977f) {
+        if (!(features[1] <= 0.750000298f)) {
+            if (!(features[4] <= 16.75f)) {
+                return 1;
             } else {
-                if (features[1] <= 0.773317f) {
-                    return 0;
+                if (FOREST_LIKELY(!(features[3] <= 407.494965f))) {
+                    if (!(features[1] <= 2.86999989f)) {
+                        if (FOREST_LIKELY(!(features[0] <= 13.5349998f))) {
+                            return 0;
+                        } else {
+                            return 3;
+                        }
+                    } else {
+                        if (FOREST_LIKELY(!(features[0] <= 14.374999f))) {
+                            return 0;
+                        } else {
+                            return 3;
+                        }
+                    }
                 } else {
-                    return 0;
+                    if (FOREST_LIKELY(features[1] <= 3.56999969f)) {
+                        return 3;
+                    } else {
+                        return 0;
+                    }
                 }
             }
         } else {
-            return 3;
+            return 2;
         }
+    } else {
+        return 4;
     }
 }
 
-// Decision Tree 5
-int predict_tree_5(float* features) {
-    if (features[2] <= 0.541841f) {
-        if (features[0] <= 0.285778f) {
-            if (features[0] <= -0.694668f) {
-                return 3;
+// Decision Tree 9
+template <typename Row>
+int predict_tree_9(Row features) {
+    if (FOREST_LIKELY(!(features[0] <= 6.10500097f))) {
+        if (!(features[1] <= 0.740000367f)) {
+            if (FOREST_LIKELY(!(features[3] <= 725.604919f))) {
+                if (!(features[4] <= 18.4699993f)) {
+                    return 1;
+                } else {
+                    if (!(features[4] <= 9.71000004f)) {
+                        if (FOREST_LIKELY(!(features[3] <= 765.379944f))) {
+                            return 0;
+                        } else {
+                            return 1;
+                        }
+                    } else {
+                        return 1;
+                    }
+                }
             } else {
-                return 2;
+                if (!(features[3] <= 426.814941f)) {
+                    if (FOREST_LIKELY(!(features[4] <= 9.13500023f))) {
+                        if (FOREST_LIKELY(!(features[1] <= 2.76499987f))) {
+                            return 0;
+                        } else {
+                            return 3;
+                        }
+                    } else {
+                        return 3;
+                    }
+                } else {
+                    if (FOREST_LIKELY(features[1] <= 3.8099997f)) {
+                        return 3;
+                    } else {
+                        return 0;
+                    }
+                }
             }
         } else {
-            if (features[0] <= 0.755108f) {
-                return 0;
+            return 2;
+        }
+    } else {
+        return 4;
+    }
+}
+
+// Decision Tree 10
+template <typename Row>
+int predict_tree_10(Row features) {
+    if (!(features[1] <= 0.680000424f)) {
+        if (FOREST_LIKELY(!(features[4] <= 4.4550004f))) {
+            if (FOREST_LIKELY(!(features[0] <= 14.329999f))) {
+                if (FOREST_LIKELY(!(features[3] <= 775.679932f))) {
+                    if (FOREST_LIKELY(!(features[3] <= 814.144958f))) {
+                        return 1;
+                    } else {
+                        if (!(features[4] <= 16.6049995f)) {
+                            return 1;
+                        } else {
+                            return 0;
+                        }
+                    }
+                } else {
+                    if (FOREST_LIKELY(!(features[3] <= 383.259949f))) {
+                        return 0;
+                    } else {
+                        return 3;
+                    }
+                }
             } else {
-                if (features[1] <= -0.540030f) {
-                    return 1;
+                if (features[1] <= 3.74999976f) {
+                    if (FOREST_LIKELY(features[3] <= 482.809967f)) {
+                        return 3;
+                    } else {
+                        return 0;
+                    }
                 } else {
                     return 0;
                 }
             }
+        } else {
+            return 4;
         }
     } else {
-        return 3;
+        return 2;
     }
 }
 
-// Decision Tree 6
-int predict_tree_6(float* features) {
-    if (features[1] <= -1.030280f) {
-        return 1;
-    } else {
-        if (features[0] <= 0.274272f) {
-            if (features[1] <= 0.278147f) {
-                return 2;
+// Decision Tree 11
+template <typename Row>
+int predict_tree_11(Row features) {
+    if (FOREST_LIKELY(!(features[0] <= 5.98500061f))) {
+        if (!(features[4] <= 4.38500023f)) {
+            if (FOREST_LIKELY(!(features[3] <= 719.804932f))) {
+                if (FOREST_LIKELY(!(features[0] <= 16.3399982f))) {
+                    if (!(features[4] <= 18.4949989f)) {
+                        return 1;
+                    } else {
+                        return 0;
+                    }
+                } else {
+                    return 0;
+                }
             } else {
-                return 3;
+                if (!(features[3] <= 433.244965f)) {
+                    if (FOREST_LIKELY(!(features[1] <= 2.76499987f))) {
+                        return 0;
+                    } else {
+                        if (!(features[2] <= 42.1149979f)) {
+                            return 3;
+                        } else {
+                            return 1;
+                        }
+                    }
+                } else {
+                    if (FOREST_LIKELY(features[0] <= 16.3099995f)) {
+                        return 3;
+                    } else {
+                        return 0;
+                    }
+                }
             }
         } else {
-            return 0;
+            return 2;
         }
+    } else {
+        return 4;
     }
 }
 
-// Decision Tree 7
-int predict_tree_7(float* features) {
-    if (features[0] <= -0.953254f) {
-        return 3;
-    } else {
-        if (features[1] <= -1.025361f) {
-            return 1;
+// Decision Tree 12
+template <typename Row>
+int predict_tree_12(Row features) {
+    if (!(features[4] <= 4.7050004f)) {
+        if (FOREST_LIKELY(!(features[3] <= 740.674927f))) {
+            if (FOREST_LIKELY(!(features[3] <= 810.454956f))) {
+                if (!(features[4] <= 16.8349991f)) {
+                    return 1;
+                } else {
+                    return 3;
+                }
+            } else {
+                if (features[0] <= 18.0349979f) {
+                    return 0;
+                } else {
+                    return 1;
+                }
+            }
         } else {
-            if (features[1] <= -0.056338f) {
-                return 2;
+            if (features[1] <= 3.37499976f) {
+                if (features[0] <= 15.0099993f) {
+                    return 3;
+                } else {
+                    if (!(features[3] <= 407.374969f)) {
+                        return 0;
+                    } else {
+                        return 3;
+                    }
+                }
             } else {
-                return 0;
+                if (FOREST_LIKELY(!(features[0] <= 13.0149994f))) {
+                    return 0;
+                } else {
+                    return 3;
+                }
             }
         }
+    } else {
+        if (features[2] <= 47.7449989f) {
+            return 2;
+        } else {
+            return 4;
+        }
     }
 }
 
-// Decision Tree 8
-int predict_tree_8(float* features) {
-    if (features[0] <= -0.960521f) {
-        return 3;
-    } else {
-        if (features[1] <= -0.057977f) {
-            if (features[1] <= -1.031919f) {
-                return 1;
+// Decision Tree 13
+template <typename Row>
+int predict_tree_13(Row features) {
+    if (FOREST_LIKELY(!(features[0] <= 6.05000067f))) {
+        if (FOREST_LIKELY(!(features[3] <= 683.754944f))) {
+            if (!(features[4] <= 6.45000029f)) {
+                if (FOREST_LIKELY(!(features[0] <= 16.5449982f))) {
+                    if (!(features[4] <= 16.6049995f)) {
+                        return 1;
+                    } else {
+                        if (FOREST_LIKELY(!(features[0] <= 17.7149982f))) {
+                            return 0;
+                        } else {
+                            return 1;
+                        }
+                    }
+                } else {
+                    if (features[1] <= 3.6849997f) {
+                        return 1;
+                    } else {
+                        if (!(features[3] <= 829.559937f)) {
+                            return 1;
+                        } else {
+                            return 0;
+                        }
+                    }
+                }
             } else {
                 return 2;
             }
         } else {
-            return 0;
+            if (!(features[1] <= 3.1099999f)) {
+                if (FOREST_LIKELY(!(features[3] <= 383.564941f))) {
+                    if (FOREST_LIKELY(!(features[4] <= 8.72999954f))) {
+                        return 0;
+                    } else {
+                        return 3;
+                    }
+                } else {
+                    return 3;
+                }
+            } else {
+                if (features[0] <= 14.6499996f) {
+                    return 3;
+                } else {
+                    if (!(features[3] <= 406.949951f)) {
+                        return 0;
+                    } else {
+                        return 3;
+                    }
+                }
+            }
         }
+    } else {
+        return 4;
     }
 }
 
-// Decision Tree 9
-int predict_tree_9(float* features) {
-    if (features[1] <= -0.066176f) {
-        if (features[1] <= -1.030280f) {
+// Decision Tree 14
+template <typename Row>
+int predict_tree_14(Row features) {
+    if (!(features[1] <= 0.680000424f)) {
+        if (!(features[4] <= 16.6800003f)) {
             return 1;
         } else {
-            return 2;
+            if (!(features[4] <= 4.4550004f)) {
+                if (!(features[4] <= 10.2449999f)) {
+                    if (FOREST_LIKELY(!(features[3] <= 385.96994f))) {
+                        if (!(features[1] <= 2.70499992f)) {
+                            return 0;
+                        } else {
+                            return 3;
+                        }
+                    } else {
+                        return 3;
+                    }
+                } else {
+                    if (FOREST_LIKELY(!(features[3] <= 475.269958f))) {
+                        if (FOREST_LIKELY(!(features[3] <= 680.974915f))) {
+                            return 1;
+                        } else {
+                            return 0;
+                        }
+                    } else {
+                        return 3;
+                    }
+                }
+            } else {
+                return 4;
+            }
         }
     } else {
-        if (features[2] <= 0.339854f) {
-            return 0;
-        } else {
-            return 3;
-        }
+        return 2;
     }
 }
 
-// Main prediction function - returns class index
-int predict(float* raw_features) {
-    // Scale features
-    float scaled[NUM_FEATURES];
-    scale_features(raw_features, scaled);
-    
-    // Vote counting
-    int votes[NUM_CLASSES] = {0};
-    
-    // Get prediction from each tree
-    votes[predict_tree_0(scaled)]++;
-    votes[predict_tree_1(scaled)]++;
-    votes[predict_tree_2(scaled)]++;
-    votes[predict_tree_3(scaled)]++;
-    votes[predict_tree_4(scaled)]++;
-    votes[predict_tree_5(scaled)]++;
-    votes[predict_tree_6(scaled)]++;
-    votes[predict_tree_7(scaled)]++;
-    votes[predict_tree_8(scaled)]++;
-    votes[predict_tree_9(scaled)]++;
-    
-    // Find majority vote
+// Find majority vote (ties go to the lowest class index)
+int majority_vote(const int* votes) {
     int max_votes = 0;
     int predicted_class = 0;
     for (int i = 0; i < NUM_CLASSES; i++) {
@@ -301,10 +687,202 @@ int predict(float* raw_features) {
             predicted_class = i;
         }
     }
-    
     return predicted_class;
 }
 
+// Add each tree's vote for one sample to votes[NUM_CLASSES]
+template <typename Row>
+void vote_trees(Row features, int* votes) {
+    votes[predict_tree_0(features)]++;
+    votes[predict_tree_1(features)]++;
+    votes[predict_tree_2(features)]++;
+    votes[predict_tree_3(features)]++;
+    votes[predict_tree_4(features)]++;
+    votes[predict_tree_5(features)]++;
+    votes[predict_tree_6(features)]++;
+    votes[predict_tree_7(features)]++;
+    votes[predict_tree_8(features)]++;
+    votes[predict_tree_9(features)]++;
+    votes[predict_tree_10(features)]++;
+    votes[predict_tree_11(features)]++;
+    votes[predict_tree_12(features)]++;
+    votes[predict_tree_13(features)]++;
+    votes[predict_tree_14(features)]++;
+}
+
+// Each tree on its own (before vote weights), for inspection and benchmarks
+typedef int (*TreeFunction)(const float* features);
+#define NUM_TREE_FUNCTIONS 15
+const TreeFunction TREE_FUNCTIONS[NUM_TREE_FUNCTIONS] = {
+    predict_tree_0<const float*>,
+    predict_tree_1<const float*>,
+    predict_tree_2<const float*>,
+    predict_tree_3<const float*>,
+    predict_tree_4<const float*>,
+    predict_tree_5<const float*>,
+    predict_tree_6<const float*>,
+    predict_tree_7<const float*>,
+    predict_tree_8<const float*>,
+    predict_tree_9<const float*>,
+    predict_tree_10<const float*>,
+    predict_tree_11<const float*>,
+    predict_tree_12<const float*>,
+    predict_tree_13<const float*>,
+    predict_tree_14<const float*>,
+};
+
+// Count each tree's vote for one sample of raw readings
+void count_votes(float* raw_features, int* votes) {
+    for (int c = 0; c < NUM_CLASSES; c++) {
+        votes[c] = 0;
+    }
+    // Thresholds are in raw units: no scaling needed
+    vote_trees<const float*>(raw_features, votes);
+}
+
+// Main prediction function - returns class index
+int predict(float* raw_features) {
+    int votes[NUM_CLASSES];
+    count_votes(raw_features, votes);
+    return majority_vote(votes);
+}
+
+// Everything one run of the forest says about a sample
+struct PredictionResult {
+    int class_idx;            // Predicted class (same as predict())
+    int votes[NUM_CLASSES];   // Trees voting for each class
+    int margin;               // Winner's votes minus the runner-up's
+    int is_fault;             // 1 if class_idx is not NORMAL_CLASS
+};
+
+// Predict once and keep the votes - use instead of calling predict(),
+// is_fault() and predict_class_name() on the same sample
+PredictionResult predict_result(float* raw_features) {
+    PredictionResult result;
+    count_votes(raw_features, result.votes);
+    result.class_idx = majority_vote(result.votes);
+    
+    int runner_up = 0;
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        if (i != result.class_idx && result.votes[i] > runner_up) {
+            runner_up = result.votes[i];
+        }
+    }
+    result.margin = result.votes[result.class_idx] - runner_up;
+    result.is_fault = (result.class_idx != NORMAL_CLASS) ? 1 : 0;
+    return result;
+}
+
+// predict_early_exit() and its counters, only with -DPREDICT_EARLY_EXIT
+// (or #define PREDICT_EARLY_EXIT before including this header). Off by
+// default: it is slower than predict() on the host, the vote checks cost
+// more than the trees they skip (benchmarks/bench_backends.cpp: 56.5
+// against 48.3 ns per sample, 1-vCPU Xeon, g++ 12 -O2)
+#ifdef PREDICT_EARLY_EXIT
+
+// 1 if no class can still overtake the leader with `remaining` trees left
+int vote_decided(const int* votes, int remaining) {
+    int leader = majority_vote(votes);
+    int lead = votes[leader];
+    int decided = 1;
+    // Branch-free: the exit point already varies from sample to sample
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        int best = votes[i] + remaining;
+        decided &= (i == leader) | (best < lead) | ((best == lead) & (i > leader));
+    }
+    return decided;
+}
+
+// Evaluation order of predict_early_exit()
+const uint8_t TREE_ORDER[] = {
+    5, 2, 13, 0, 11, 1, 3, 9, 8, 6, 12, 10, 14, 4, 7
+};
+
+// Counters for predict_early_exit() (set to zero to reset)
+struct EarlyExitStats {
+    unsigned long predictions;     // Calls to predict_early_exit()
+    unsigned long trees_skipped;   // Trees not evaluated because the winner was fixed
+};
+EarlyExitStats early_exit_stats = {0, 0};
+
+// Same class as predict(), but trees run in TREE_ORDER and evaluation
+// stops once the majority can no longer change
+int predict_early_exit(float* raw_features) {
+    const float* features = raw_features;
+    int votes[NUM_CLASSES] = {0};
+    early_exit_stats.predictions++;
+    
+    votes[predict_tree_5(features)]++;
+    votes[predict_tree_2(features)]++;
+    votes[predict_tree_13(features)]++;
+    votes[predict_tree_0(features)]++;
+    votes[predict_tree_11(features)]++;
+    votes[predict_tree_1(features)]++;
+    votes[predict_tree_3(features)]++;
+    votes[predict_tree_9(features)]++;
+    if (vote_decided(votes, 7)) {
+        early_exit_stats.trees_skipped += 7;
+        return majority_vote(votes);
+    }
+    votes[predict_tree_8(features)]++;
+    if (vote_decided(votes, 6)) {
+        early_exit_stats.trees_skipped += 6;
+        return majority_vote(votes);
+    }
+    votes[predict_tree_6(features)]++;
+    if (vote_decided(votes, 5)) {
+        early_exit_stats.trees_skipped += 5;
+        return majority_vote(votes);
+    }
+    votes[predict_tree_12(features)]++;
+    if (vote_decided(votes, 4)) {
+        early_exit_stats.trees_skipped += 4;
+        return majority_vote(votes);
+    }
+    votes[predict_tree_10(features)]++;
+    if (vote_decided(votes, 3)) {
+        early_exit_stats.trees_skipped += 3;
+        return majority_vote(votes);
+    }
+    votes[predict_tree_14(features)]++;
+    if (vote_decided(votes, 2)) {
+        early_exit_stats.trees_skipped += 2;
+        return majority_vote(votes);
+    }
+    votes[predict_tree_4(features)]++;
+    if (vote_decided(votes, 1)) {
+        early_exit_stats.trees_skipped += 1;
+        return majority_vote(votes);
+    }
+    votes[predict_tree_7(features)]++;
+    return majority_vote(votes);
+}
+
+#endif // PREDICT_EARLY_EXIT
+
+// Batch vote counts - X is column-major (X[f * n + i]),
+// votes receives NUM_CLASSES counts per sample (votes[i * NUM_CLASSES + c])
+void predict_batch_votes(const float* X, size_t n, int* votes) {
+    for (size_t i = 0; i < n; i++) {
+        int* sample_votes = votes + i * NUM_CLASSES;
+        for (int c = 0; c < NUM_CLASSES; c++) {
+            sample_votes[c] = 0;
+        }
+        ColumnRow row = {X + i, n};
+        vote_trees(row, sample_votes);
+    }
+}
+
+// Batch prediction - X is column-major (X[f * n + i]), out receives n class indices
+void predict_batch(const float* X, size_t n, int* out) {
+    for (size_t i = 0; i < n; i++) {
+        int votes[NUM_CLASSES] = {0};
+        ColumnRow row = {X + i, n};
+        vote_trees(row, votes);
+        out[i] = majority_vote(votes);
+    }
+}
+
 // Get the class name string from prediction
 const char* predict_class_name(float* raw_features) {
     int class_idx = predict(raw_features);
@@ -314,8 +892,8 @@ const char* predict_class_name(float* raw_features) {
 // Check if there's a fault (returns 1 if fault, 0 if normal)
 int is_fault(float* raw_features) {
     int prediction = predict(raw_features);
-    // Class 0 is 'Normal' - return 1 if NOT normal
-    return (prediction != 0) ? 1 : 0;
+    // Return 1 if NOT normal
+    return (prediction != NORMAL_CLASS) ? 1 : 0;
 }
 
 #endif // SOLAR_FAULT_MODEL_H
\ No newline at end of file
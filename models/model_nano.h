@@ -0,0 +1,362 @@
+/*
+ * Solar Panel Fault Detection - Random Forest Model (integer, Arduino Nano)
+ * Generated from solar_fault_rf_model.joblib (sha256 1b364580bcfcb794)
+ * Trees: 15, Nodes: 269 (1106 bytes PROGMEM)
+ * Readings: 1/64 ADC counts (1023 = 5 V) as uint16_t, no float math
+ * 
+ * Classes:
+ *   0: Dust_Accumulation
+ *   1: Normal
+ *   2: Open_Circuit
+ *   3: Partial_Shading
+ *   4: Short_Circuit
+ * 
+ * Usage: uint8_t fault_type = nano_forest_predict(&SOLAR_NANO_FOREST, readings);
+ */
+
+#ifndef SOLAR_FAULT_MODEL_NANO_H
+#define SOLAR_FAULT_MODEL_NANO_H
+
+#define NANO_MAX_CLASSES 5
+#include "forest_nano.h"
+
+#define NANO_NUM_FEATURES 5
+#define NANO_ADC_SCALE 64
+
+// Fault type names
+const char NANO_CLASS_0[] PROGMEM = "Dust_Accumulation";
+const char NANO_CLASS_1[] PROGMEM = "Normal";
+const char NANO_CLASS_2[] PROGMEM = "Open_Circuit";
+const char NANO_CLASS_3[] PROGMEM = "Partial_Shading";
+const char NANO_CLASS_4[] PROGMEM = "Short_Circuit";
+const char* const NANO_CLASS_NAMES[] PROGMEM = {
+    NANO_CLASS_0, NANO_CLASS_1, NANO_CLASS_2, NANO_CLASS_3, NANO_CLASS_4
+};
+
+// Physical value of one reading unit (volts, amps, degC, lux, percent);
+// the float model sees reading q of feature f as q * NANO_FEATURE_LSB[f]
+const float NANO_FEATURE_LSB[] PROGMEM = {
+    0.000840053777f,   // Voltage
+    0.000412802823f,   // Current
+    0.00763685256f,   // Temperature
+    0.0229105577f,   // Light_Intensity
+    0.0009765625f,   // Efficiency
+};
+
+// Efficiency reading from the voltage, current and light readings:
+// panel_efficiency() (panel_efficiency.h) in integer math, clamped the same way
+#define NANO_EFFICIENCY_FEATURE 4
+#define NANO_EFFICIENCY_FACTOR 8036129UL
+#define NANO_EFFICIENCY_MAX 25600
+inline uint16_t nano_efficiency_reading(const uint16_t* readings) {
+    uint32_t light = readings[3];
+    if (light == 0) {
+        return 0;
+    }
+    uint32_t power = (uint32_t)readings[0] * readings[1];
+    uint64_t efficiency = (uint64_t)power * NANO_EFFICIENCY_FACTOR / (light << 16);
+    return efficiency < NANO_EFFICIENCY_MAX ? (uint16_t)efficiency : NANO_EFFICIENCY_MAX;
+}
+
+// Node table: { threshold (leaves: class), feature (leaves: NANO_LEAF), right }
+const NanoNode NANO_NODES[] PROGMEM = {
+    // Tree 0
+    { 7154, 0, 2 },
+    { 4, NANO_LEAF, 0 },
+    { 4239, 4, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 19128, 4, 10 },
+    { 17786, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 6673, 1, 4 },
+    { 17111, 0, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 16112, 0, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    // Tree 1
+    { 1683, 1, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 4515, 4, 2 },
+    { 4, NANO_LEAF, 0 },
+    { 31481, 3, 10 },
+    { 17668, 3, 4 },
+    { 8648, 1, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 15677, 0, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 5910, 1, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 18949, 4, 4 },
+    { 34320, 3, 2 },
+    { 1, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    // Tree 2
+    { 7231, 0, 2 },
+    { 4, NANO_LEAF, 0 },
+    { 4817, 4, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 17080, 4, 8 },
+    { 7763, 1, 4 },
+    { 17183, 0, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 15594, 0, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    // Tree 3
+    { 7154, 0, 2 },
+    { 4, NANO_LEAF, 0 },
+    { 1816, 1, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 17029, 4, 14 },
+    { 17135, 0, 8 },
+    { 12165, 4, 4 },
+    { 9265, 1, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 6014, 2, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 16728, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 6698, 1, 2 },
+    { 1, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    // Tree 4
+    { 7460, 2, 18 },
+    { 1647, 1, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 18938, 4, 14 },
+    { 7255, 1, 6 },
+    { 20588, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 6637, 1, 2 },
+    { 1, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 9221, 4, 4 },
+    { 12596, 1, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 4, NANO_LEAF, 0 },
+    { 16487, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    { 4, NANO_LEAF, 0 },
+    // Tree 5
+    { 7154, 0, 2 },
+    { 4, NANO_LEAF, 0 },
+    { 4638, 4, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 17152, 4, 12 },
+    { 18901, 3, 6 },
+    { 18332, 0, 4 },
+    { 8817, 1, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 16600, 0, 4 },
+    { 20761, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    // Tree 6
+    { 1683, 1, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 7289, 2, 8 },
+    { 18974, 4, 6 },
+    { 17642, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 6383, 1, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    { 4, NANO_LEAF, 0 },
+    // Tree 7
+    { 4147, 4, 4 },
+    { 6251, 2, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 4, NANO_LEAF, 0 },
+    { 33494, 3, 10 },
+    { 17668, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 8427, 4, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 29669, 3, 2 },
+    { 0, NANO_LEAF, 0 },
+    { 17707, 0, 2 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    // Tree 8
+    { 7336, 2, 16 },
+    { 1816, 1, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 17152, 4, 12 },
+    { 17786, 3, 4 },
+    { 8648, 1, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 6952, 1, 4 },
+    { 17111, 0, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 16112, 0, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    { 4, NANO_LEAF, 0 },
+    // Tree 9
+    { 7267, 0, 2 },
+    { 4, NANO_LEAF, 0 },
+    { 1792, 1, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 31671, 3, 10 },
+    { 18629, 3, 4 },
+    { 9229, 1, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 9354, 4, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 6698, 1, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 18913, 4, 6 },
+    { 9943, 4, 2 },
+    { 1, NANO_LEAF, 0 },
+    { 33407, 3, 2 },
+    { 1, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    // Tree 10
+    { 1647, 1, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 4561, 4, 2 },
+    { 4, NANO_LEAF, 0 },
+    { 17058, 0, 6 },
+    { 9084, 1, 4 },
+    { 21073, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 33856, 3, 4 },
+    { 16728, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 35535, 3, 4 },
+    { 17003, 4, 2 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    // Tree 11
+    { 7124, 0, 2 },
+    { 4, NANO_LEAF, 0 },
+    { 4490, 4, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 31418, 3, 10 },
+    { 18910, 3, 4 },
+    { 19415, 0, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 6698, 1, 4 },
+    { 5514, 2, 2 },
+    { 1, NANO_LEAF, 0 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 19451, 0, 2 },
+    { 0, NANO_LEAF, 0 },
+    { 18938, 4, 2 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    // Tree 12
+    { 4817, 4, 4 },
+    { 6251, 2, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 4, NANO_LEAF, 0 },
+    { 32328, 3, 10 },
+    { 8175, 1, 6 },
+    { 17867, 0, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 17781, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 15493, 0, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 35374, 3, 4 },
+    { 21468, 0, 2 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    { 17239, 4, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    // Tree 13
+    { 7201, 0, 2 },
+    { 4, NANO_LEAF, 0 },
+    { 29844, 3, 12 },
+    { 7533, 1, 6 },
+    { 17439, 0, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 17762, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 16741, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 8939, 4, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 6604, 4, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 19695, 0, 6 },
+    { 8926, 1, 2 },
+    { 1, NANO_LEAF, 0 },
+    { 36208, 3, 2 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    { 17003, 4, 4 },
+    { 21087, 0, 2 },
+    { 1, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    // Tree 14
+    { 1647, 1, 2 },
+    { 2, NANO_LEAF, 0 },
+    { 17080, 4, 14 },
+    { 4561, 4, 2 },
+    { 4, NANO_LEAF, 0 },
+    { 10490, 4, 6 },
+    { 20744, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 29723, 3, 2 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+    { 16846, 3, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 6552, 1, 2 },
+    { 3, NANO_LEAF, 0 },
+    { 0, NANO_LEAF, 0 },
+    { 1, NANO_LEAF, 0 },
+};
+
+// Root node of each tree
+const uint16_t NANO_ROOTS[] PROGMEM = {
+    0, 15, 34, 47, 66, 85, 102, 113, 128, 145, 166, 185, 204, 225, 252,
+};
+
+const NanoForest SOLAR_NANO_FOREST = {
+    NANO_NODES,
+    NANO_ROOTS,
+    15,   // num_trees
+    5,    // num_features
+    5,    // num_classes
+};
+
+#endif // SOLAR_FAULT_MODEL_NANO_H
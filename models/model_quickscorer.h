@@ -0,0 +1,172 @@
+/*
+ * Solar Panel Fault Detection - Random Forest Model (QuickScorer bitvectors)
+ * Generated from solar_fault_rf_model.joblib (sha256 1b364580bcfcb794)
+ * Trees: 15, Max Depth: 6, Conditions: 127, Max Leaves: 14
+ * Thresholds: raw sensor units (StandardScaler folded in)
+ * 
+ * Classes:
+ *   0: Dust_Accumulation
+ *   1: Normal
+ *   2: Open_Circuit
+ *   3: Partial_Shading
+ *   4: Short_Circuit
+ * 
+ * Usage: int fault_type = quickscorer_predict(&SOLAR_QUICKSCORER, features);
+ */
+
+#ifndef SOLAR_FAULT_MODEL_QUICKSCORER_H
+#define SOLAR_FAULT_MODEL_QUICKSCORER_H
+
+#define QUICKSCORER_MASK_BITS 32
+#define QUICKSCORER_MAX_TREES 15
+#include "forest_quickscorer.h"
+
+// Fault type names
+const char* const QS_CLASS_NAMES[] = {
+    "Dust_Accumulation",
+    "Normal",
+    "Open_Circuit",
+    "Partial_Shading",
+    "Short_Circuit",
+};
+
+// First condition of each feature (plus end marker)
+const uint16_t QS_FEATURE_OFFSETS[] = {
+    0, 27, 56, 63, 96, 127
+};
+
+// Split thresholds, ascending within each feature
+const float QS_THRESHOLDS[] = {
+    // Voltage
+    5.98500061f, 6.01000023f, 6.01000023f, 6.01000023f, 6.05000067f, 6.07500029f,
+    6.10500097f, 13.0149994f, 13.0999994f, 13.1699991f, 13.5349998f, 13.5349998f,
+    13.9449997f, 14.329999f, 14.374999f, 14.374999f, 14.3949995f, 14.4349995f,
+    14.6499996f, 14.874999f, 15.0099993f, 15.3999996f, 16.3099995f, 16.3399982f,
+    16.5449982f, 17.7149982f, 18.0349979f,
+    // Current
+    0.680000424f, 0.680000424f, 0.680000424f, 0.69500047f, 0.69500047f, 0.740000367f,
+    0.750000298f, 0.750000298f, 2.43999982f, 2.63499999f, 2.70499992f, 2.74000001f,
+    2.75499988f, 2.76499987f, 2.76499987f, 2.76499987f, 2.86999989f, 2.99499989f,
+    3.1099999f, 3.20499992f, 3.37499976f, 3.56999969f, 3.56999969f, 3.63999987f,
+    3.6849997f, 3.74999976f, 3.8099997f, 3.82499981f, 5.19999933f,
+    // Temperature
+    42.1149979f, 45.9349976f, 47.7449989f, 47.7449989f, 55.6699982f, 56.0249977f,
+    56.9749985f,
+    // Light_Intensity
+    377.73996f, 383.259949f, 383.259949f, 383.564941f, 385.96994f, 404.189972f,
+    404.799957f, 404.799957f, 406.949951f, 407.374969f, 407.494965f, 407.494965f,
+    426.814941f, 433.044952f, 433.244965f, 471.684967f, 475.269958f, 475.654968f,
+    482.809967f, 679.734924f, 680.974915f, 683.754944f, 719.804932f, 721.264954f,
+    725.604919f, 740.674927f, 765.379944f, 767.369934f, 775.679932f, 786.299927f,
+    810.454956f, 814.144958f, 829.559937f,
+    // Efficiency
+    4.05000019f, 4.13999987f, 4.38500023f, 4.40999985f, 4.4550004f, 4.4550004f,
+    4.53000021f, 4.7050004f, 4.7050004f, 6.45000029f, 8.22999954f, 8.72999954f,
+    9.00500011f, 9.13500023f, 9.71000004f, 10.2449999f, 11.8800001f, 16.6049995f,
+    16.6049995f, 16.6299992f, 16.6800003f, 16.6800003f, 16.75f, 16.75f,
+    16.8349991f, 18.4699993f, 18.4949989f, 18.4949989f, 18.5049992f, 18.5300007f,
+    18.6800003f,
+};
+
+// Tree owning each condition
+const uint16_t QS_TREE_IDS[] = {
+    // Voltage
+    11, 0, 3, 5, 13, 2, 9, 12, 2, 1, 0, 8,
+    5, 10, 0, 8, 3, 2, 13, 7, 12, 5, 11, 11,
+    13, 13, 12,
+    // Current
+    4, 10, 14, 1, 6, 9, 3, 8, 1, 6, 14, 4,
+    0, 3, 9, 11, 8, 4, 13, 2, 12, 1, 8, 5,
+    13, 10, 9, 3, 4,
+    // Temperature
+    11, 3, 7, 12, 6, 8, 4,
+    // Light_Intensity
+    4, 3, 10, 13, 14, 6, 1, 7, 13, 12, 0, 8,
+    9, 5, 11, 4, 14, 5, 10, 7, 14, 13, 11, 1,
+    9, 12, 9, 7, 10, 1, 12, 10, 13,
+    // Efficiency
+    7, 0, 11, 1, 10, 14, 5, 2, 12, 13, 7, 13,
+    4, 9, 9, 14, 3, 10, 13, 3, 2, 14, 5, 8,
+    12, 9, 4, 11, 1, 6, 0,
+};
+
+// Leaves still reachable when the condition fails (x > threshold)
+const uint32_t QS_MASKS[] = {
+    // Voltage
+    0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu,
+    0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFDFu,
+    0xFFFFFFEFu, 0xFFFFFFEFu, 0xFFFFFFDFu, 0xFFFFFFDFu,
+    0xFFFFFF9Fu, 0xFFFFFFE3u, 0xFFFFFFF7u, 0xFFFFFFF7u,
+    0xFFFFFFC3u, 0xFFFFFFFBu, 0xFFFFFFFDu, 0xFFFFFFDFu,
+    0xFFFFFFFBu, 0xFFFFFFF3u, 0xFFFFFFFBu, 0xFFFFFF7Fu,
+    0xFFFFF8FFu, 0xFFFFF7FFu, 0xFFFFFF7Fu,
+    // Current
+    0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu, 0xFFFFFFFEu,
+    0xFFFFFFFEu, 0xFFFFFFFDu, 0xFFFFFFFDu, 0xFFFFFFFEu,
+    0xFFFFFFDFu, 0xFFFFFFFBu, 0xFFFFFFBFu, 0xFFFFFFFBu,
+    0xFFFFFFE7u, 0xFFFFFF7Fu, 0xFFFFFFDFu, 0xFFFFFFCFu,
+    0xFFFFFFE7u, 0xFFFFFFF1u, 0xFFFFFFF1u, 0xFFFFFFF3u,
+    0xFFFFFFE3u, 0xFFFFFFFBu, 0xFFFFFFFDu, 0xFFFFFFFBu,
+    0xFFFFFEFFu, 0xFFFFFFF3u, 0xFFFFFFFBu, 0xFFFFFFFBu,
+    0xFFFFFFEFu,
+    // Temperature
+    0xFFFFFFEFu, 0xFFFFFFEFu, 0xFFFFFFFEu, 0xFFFFFFFEu,
+    0xFFFFFFE1u, 0xFFFFFF00u, 0xFFFFFE00u,
+    // Light_Intensity
+    0xFFFFFFBFu, 0xFFFFFFBFu, 0xFFFFFFDFu, 0xFFFFFFEFu,
+    0xFFFFFFDFu, 0xFFFFFFFDu, 0xFFFFFFF3u, 0xFFFFFFFBu,
+    0xFFFFFFFBu, 0xFFFFFFF7u, 0xFFFFFFFBu, 0xFFFFFFF9u,
+    0xFFFFFFF3u, 0xFFFFFFE3u, 0xFFFFFFF3u, 0xFFFFFFFDu,
+    0xFFFFFFFBu, 0xFFFFFFDFu, 0xFFFFFFFBu, 0xFFFFFFEFu,
+    0xFFFFFFF7u, 0xFFFFFF81u, 0xFFFFFF83u, 0xFFFFFF83u,
+    0xFFFFFF83u, 0xFFFFFF83u, 0xFFFFFEFFu, 0xFFFFFF83u,
+    0xFFFFFF9Fu, 0xFFFFFF7Fu, 0xFFFFFE7Fu, 0xFFFFFE7Fu,
+    0xFFFFFDFFu,
+    // Efficiency
+    0xFFFFFFFCu, 0xFFFFFFFDu, 0xFFFFFFFDu, 0xFFFFFFFDu,
+    0xFFFFFFFDu, 0xFFFFFFFDu, 0xFFFFFFFDu, 0xFFFFFFFDu,
+    0xFFFFFFFCu, 0xFFFFFF7Fu, 0xFFFFFFF7u, 0xFFFFFFDFu,
+    0xFFFFFFCFu, 0xFFFFFFEFu, 0xFFFFFF7Fu, 0xFFFFFFE3u,
+    0xFFFFFFF3u, 0xFFFFFF7Fu, 0xFFFFE7FFu, 0xFFFFFE03u,
+    0xFFFFFFC3u, 0xFFFFFF01u, 0xFFFFFF03u, 0xFFFFFF81u,
+    0xFFFFFDFFu, 0xFFFFFC7Fu, 0xFFFFFF01u, 0xFFFFFEFFu,
+    0xFFFFFE7Fu, 0xFFFFFFF1u, 0xFFFFFF83u,
+};
+
+// Leaf classes, left to right, padded to max leaves per tree
+const uint8_t QS_LEAF_VALUES[] = {
+    4, 2, 3, 3, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0,
+    2, 4, 3, 0, 3, 3, 0, 1, 0, 1, 0, 0, 0, 0,
+    4, 2, 3, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    4, 2, 3, 0, 3, 0, 3, 1, 0, 1, 0, 0, 0, 0,
+    2, 3, 1, 0, 3, 4, 3, 0, 1, 4, 0, 0, 0, 0,
+    4, 2, 3, 0, 0, 3, 0, 0, 1, 0, 0, 0, 0, 0,
+    2, 3, 3, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 4, 3, 3, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+    2, 3, 0, 3, 0, 3, 0, 1, 4, 0, 0, 0, 0, 0,
+    4, 2, 3, 0, 3, 3, 0, 1, 1, 0, 1, 0, 0, 0,
+    2, 4, 3, 0, 0, 3, 0, 0, 1, 1, 0, 0, 0, 0,
+    4, 2, 3, 0, 1, 3, 0, 0, 0, 1, 0, 0, 0, 0,
+    2, 4, 3, 3, 0, 3, 0, 0, 1, 3, 1, 0, 0, 0,
+    4, 3, 3, 0, 3, 3, 0, 2, 1, 0, 1, 1, 0, 1,
+    2, 4, 3, 0, 1, 3, 3, 0, 1, 0, 0, 0, 0, 0,
+};
+
+const QuickScorer SOLAR_QUICKSCORER = {
+    QS_FEATURE_OFFSETS,
+    QS_THRESHOLDS,
+    QS_TREE_IDS,
+    QS_MASKS,
+    QS_LEAF_VALUES,
+    14,   // leaves_per_tree
+    15,   // num_trees
+    5,    // num_features
+    5,    // num_classes
+    NULL,   // scaler_mean: folded into thresholds
+    NULL,   // scaler_std
+    QS_CLASS_NAMES,
+};
+static_assert(5 <= FOREST_MAX_FEATURES && 5 <= FOREST_MAX_CLASSES,
+              "SOLAR_QUICKSCORER: define FOREST_MAX_FEATURES >= 5 and FOREST_MAX_CLASSES >= 5");
+
+#endif // SOLAR_FAULT_MODEL_QUICKSCORER_H
@@ -0,0 +1,117 @@
+/*
+ * Solar Panel Fault Detection - Compile-Time Model Backend Selection
+ *
+ * Include this instead of a specific model header and call
+ * model_predict(features). The backend is chosen with one define, before
+ * the include or in the build flags:
+ *
+ *   SOLAR_MODEL_CONSTEXPR     C++17 constexpr unrolled trees (model_constexpr.h)
+ *   SOLAR_MODEL_QUICKSCORER   QuickScorer bitvectors (model_quickscorer.h)
+ *   SOLAR_MODEL_LUT           dense class table over threshold bins (model_lut.h)
+ *   SOLAR_MODEL_SOFT          sklearn-style probability averaging (model_soft.h)
+ *   SOLAR_MODEL_TABLE         flat node table (model_table.h)
+ *   SOLAR_MODEL_COMPACT       4-byte nodes for large forests (model_compact.h)
+ *   SOLAR_MODEL_CASCADE       physics prefilter, then the flat table (model_cascade.h)
+ *   (none)                    nested if/else trees (model_manual.h)
+ *
+ * model_best.h includes this with the backend the exporter's autotuning
+ * (--autotune) found fastest within the flash budget on the host it ran
+ * on (models/autotune_report.txt).
+ *
+ * All backends are generated by ml/step3_export_to_esp32.py --all from
+ * the same forest and return the same class for every input, except
+ * SOLAR_MODEL_SOFT: it follows sklearn's predict() instead of the hard
+ * vote, which can differ near class boundaries, and SOLAR_MODEL_CASCADE:
+ * its first stage answers some readings without the forest and may differ
+ * on a few of them (benchmarks/bench_cascade.cpp).
+ */
+
+#ifndef SOLAR_MODEL_SELECT_H
+#define SOLAR_MODEL_SELECT_H
+
+#if defined(SOLAR_MODEL_CONSTEXPR)
+
+#include "model_constexpr.h"
+#define MODEL_BACKEND_NAME "constexpr"
+#define MODEL_CLASS_NAMES CX_CLASS_NAMES
+
+inline int model_predict(const float* features) {
+    return cx_predict(features);
+}
+
+#elif defined(SOLAR_MODEL_QUICKSCORER)
+
+#include "model_quickscorer.h"
+#define MODEL_BACKEND_NAME "quickscorer"
+#define MODEL_CLASS_NAMES QS_CLASS_NAMES
+
+inline int model_predict(const float* features) {
+    return quickscorer_predict(&SOLAR_QUICKSCORER, features);
+}
+
+#elif defined(SOLAR_MODEL_LUT)
+
+#include "model_lut.h"
+#if !LUT_AVAILABLE
+#error "model_lut.h has no table for this forest (too large for lut_max_bytes), pick another backend"
+#endif
+#define MODEL_BACKEND_NAME "lut"
+#define MODEL_CLASS_NAMES LUT_CLASS_NAMES
+
+inline int model_predict(const float* features) {
+    return lut_predict(features);
+}
+
+#elif defined(SOLAR_MODEL_SOFT)
+
+#include "model_soft.h"
+#define MODEL_BACKEND_NAME "soft"
+#define MODEL_CLASS_NAMES SOFT_CLASS_NAMES
+
+inline int model_predict(const float* features) {
+    return soft_forest_predict(&SOLAR_SOFT_FOREST, features);
+}
+
+#elif defined(SOLAR_MODEL_COMPACT)
+
+#include "model_compact.h"
+#define MODEL_BACKEND_NAME "compact"
+#define MODEL_CLASS_NAMES COMPACT_CLASS_NAMES
+
+inline int model_predict(const float* features) {
+    return compact_forest_predict(&SOLAR_COMPACT_FOREST, features);
+}
+
+#elif defined(SOLAR_MODEL_CASCADE)
+
+#include "model_cascade.h"
+#define MODEL_BACKEND_NAME "cascade"
+#define MODEL_CLASS_NAMES FOREST_CLASS_NAMES
+
+inline int model_predict(const float* features) {
+    return cascade_predict(features);
+}
+
+#elif defined(SOLAR_MODEL_TABLE)
+
+#include "model_table.h"
+#define MODEL_BACKEND_NAME "table"
+#define MODEL_CLASS_NAMES FOREST_CLASS_NAMES
+
+inline int model_predict(const float* features) {
+    return forest_predict(&SOLAR_FOREST, features);
+}
+
+#else
+
+#include "model_manual.h"
+#define MODEL_BACKEND_NAME "if-else"
+#define MODEL_CLASS_NAMES CLASS_NAMES
+
+inline int model_predict(const float* features) {
+    return predict(const_cast<float*>(features));
+}
+
+#endif
+
+#endif // SOLAR_MODEL_SELECT_H
@@ -0,0 +1,610 @@
+/*
+ * Solar Panel Fault Detection - Random Forest Model (soft voting)
+ * Generated from solar_fault_rf_model.joblib (sha256 1b364580bcfcb794)
+ * Trees: 15, Nodes: 415 (3320 bytes), Leaf distributions: 114 x 8-bit (570 bytes)
+ * Thresholds: raw sensor units (StandardScaler folded in)
+ * 
+ * Classes:
+ *   0: Dust_Accumulation
+ *   1: Normal
+ *   2: Open_Circuit
+ *   3: Partial_Shading
+ *   4: Short_Circuit
+ * 
+ * Usage: uint32_t acc[SOFT_NUM_CLASSES];
+ *        int fault_type = soft_forest_predict_proba(&SOLAR_SOFT_FOREST, features, acc);
+ *        // P(class c) = acc[c] / soft_forest_total(&SOLAR_SOFT_FOREST)
+ */
+
+#ifndef SOLAR_FAULT_MODEL_SOFT_H
+#define SOLAR_FAULT_MODEL_SOFT_H
+
+#define FOREST_SOFT_BITS 8
+#include "forest_soft.h"
+
+#define SOFT_NUM_CLASSES 5
+
+// Fault type names
+const char* const SOFT_CLASS_NAMES[] = {
+    "Dust_Accumulation",
+    "Normal",
+    "Open_Circuit",
+    "Partial_Shading",
+    "Short_Circuit",
+};
+
+// Node table: { threshold, right (leaves: distribution row), feature, value }
+const ForestNode SOFT_NODES[] = {
+    // Tree 0
+    { 6.01000023f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.13999987f, 8, 4, 0 },
+    { 39.8250008f, 6, 2, 0 },
+    { 20.9999981f, 4, 0, 0 },
+    { 36.9500008f, 2, 2, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 2, FOREST_LEAF, 2 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 3, FOREST_LEAF, 2 },
+    { 18.6800003f, 12, 4, 0 },
+    { 407.494965f, 4, 3, 0 },
+    { 3.54999971f, 2, 1, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 5, FOREST_LEAF, 3 },
+    { 2.75499988f, 4, 1, 0 },
+    { 14.374999f, 2, 0, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 6, FOREST_LEAF, 0 },
+    { 13.5349998f, 2, 0, 0 },
+    { 0.0f, 7, FOREST_LEAF, 3 },
+    { 0.0f, 8, FOREST_LEAF, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    // Tree 1
+    { 0.69500047f, 8, 1, 0 },
+    { 19.1549988f, 2, 0, 0 },
+    { 0.0f, 10, FOREST_LEAF, 2 },
+    { 4.00500011f, 4, 4, 0 },
+    { 39.8899994f, 2, 2, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 11, FOREST_LEAF, 2 },
+    { 0.0f, 12, FOREST_LEAF, 2 },
+    { 4.40999985f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 721.264954f, 12, 3, 0 },
+    { 404.799957f, 4, 3, 0 },
+    { 3.56999969f, 2, 1, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 13, FOREST_LEAF, 0 },
+    { 13.1699991f, 4, 0, 0 },
+    { 48.9449997f, 2, 2, 0 },
+    { 0.0f, 14, FOREST_LEAF, 3 },
+    { 0.0f, 15, FOREST_LEAF, 3 },
+    { 2.43999982f, 2, 1, 0 },
+    { 0.0f, 16, FOREST_LEAF, 3 },
+    { 0.0f, 17, FOREST_LEAF, 0 },
+    { 18.5049992f, 6, 4, 0 },
+    { 786.299927f, 2, 3, 0 },
+    { 0.0f, 18, FOREST_LEAF, 1 },
+    { 3.87999964f, 2, 1, 0 },
+    { 0.0f, 19, FOREST_LEAF, 0 },
+    { 0.0f, 20, FOREST_LEAF, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    // Tree 2
+    { 6.07500029f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.7050004f, 6, 4, 0 },
+    { 19.1949978f, 2, 0, 0 },
+    { 0.0f, 21, FOREST_LEAF, 2 },
+    { 39.8899994f, 2, 2, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 21, FOREST_LEAF, 2 },
+    { 16.6800003f, 16, 4, 0 },
+    { 3.20499992f, 8, 1, 0 },
+    { 14.4349995f, 4, 0, 0 },
+    { 12.0999994f, 2, 4, 0 },
+    { 0.0f, 22, FOREST_LEAF, 3 },
+    { 0.0f, 23, FOREST_LEAF, 3 },
+    { 41.4150009f, 2, 2, 0 },
+    { 0.0f, 24, FOREST_LEAF, 0 },
+    { 0.0f, 25, FOREST_LEAF, 0 },
+    { 13.0999994f, 4, 0, 0 },
+    { 7.91000032f, 2, 4, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 26, FOREST_LEAF, 3 },
+    { 662.014954f, 2, 3, 0 },
+    { 0.0f, 27, FOREST_LEAF, 0 },
+    { 0.0f, 28, FOREST_LEAF, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    // Tree 3
+    { 6.01000023f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 0.750000298f, 10, 1, 0 },
+    { 19.6699982f, 2, 0, 0 },
+    { 0.0f, 29, FOREST_LEAF, 2 },
+    { 39.8250008f, 6, 2, 0 },
+    { 0.275000423f, 2, 1, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.305000424f, 2, 1, 0 },
+    { 0.0f, 30, FOREST_LEAF, 2 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 3, FOREST_LEAF, 2 },
+    { 16.6299992f, 14, 4, 0 },
+    { 14.3949995f, 8, 0, 0 },
+    { 11.8800001f, 4, 4, 0 },
+    { 3.82499981f, 2, 1, 0 },
+    { 0.0f, 31, FOREST_LEAF, 3 },
+    { 0.0f, 32, FOREST_LEAF, 0 },
+    { 45.9349976f, 2, 2, 0 },
+    { 0.0f, 33, FOREST_LEAF, 3 },
+    { 0.0f, 20, FOREST_LEAF, 0 },
+    { 383.259949f, 2, 3, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 2.76499987f, 2, 1, 0 },
+    { 0.0f, 34, FOREST_LEAF, 1 },
+    { 0.0f, 35, FOREST_LEAF, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    // Tree 4
+    { 56.9749985f, 26, 2, 0 },
+    { 0.680000424f, 10, 1, 0 },
+    { 20.1999989f, 4, 0, 0 },
+    { 1.95500016f, 2, 4, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 36, FOREST_LEAF, 2 },
+    { 20.9949989f, 4, 0, 0 },
+    { 2.67000055f, 2, 4, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 37, FOREST_LEAF, 2 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 18.4949989f, 14, 4, 0 },
+    { 2.99499989f, 6, 1, 0 },
+    { 471.684967f, 2, 3, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 2.74000001f, 2, 1, 0 },
+    { 0.0f, 38, FOREST_LEAF, 1 },
+    { 0.0f, 39, FOREST_LEAF, 0 },
+    { 9.00500011f, 4, 4, 0 },
+    { 5.19999933f, 2, 1, 0 },
+    { 0.0f, 40, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 377.73996f, 2, 3, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 41, FOREST_LEAF, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    // Tree 5
+    { 6.01000023f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.53000021f, 4, 4, 0 },
+    { 3.21500039f, 2, 4, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 42, FOREST_LEAF, 2 },
+    { 16.75f, 16, 4, 0 },
+    { 433.044952f, 8, 3, 0 },
+    { 15.3999996f, 4, 0, 0 },
+    { 3.63999987f, 2, 1, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 43, FOREST_LEAF, 0 },
+    { 3.86999965f, 2, 1, 0 },
+    { 0.0f, 44, FOREST_LEAF, 0 },
+    { 0.0f, 45, FOREST_LEAF, 0 },
+    { 13.9449997f, 4, 0, 0 },
+    { 475.654968f, 2, 3, 0 },
+    { 0.0f, 46, FOREST_LEAF, 3 },
+    { 0.0f, 47, FOREST_LEAF, 0 },
+    { 54.1800003f, 2, 2, 0 },
+    { 0.0f, 48, FOREST_LEAF, 0 },
+    { 0.0f, 49, FOREST_LEAF, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    // Tree 6
+    { 0.69500047f, 8, 1, 0 },
+    { 3.07500005f, 6, 4, 0 },
+    { 21.7449989f, 4, 0, 0 },
+    { 39.2350006f, 2, 2, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 50, FOREST_LEAF, 2 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 51, FOREST_LEAF, 2 },
+    { 55.6699982f, 16, 2, 0 },
+    { 18.5300007f, 14, 4, 0 },
+    { 404.189972f, 6, 3, 0 },
+    { 12.2799997f, 4, 4, 0 },
+    { 3.56999969f, 2, 1, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 52, FOREST_LEAF, 3 },
+    { 0.0f, 5, FOREST_LEAF, 3 },
+    { 2.63499999f, 4, 1, 0 },
+    { 2.21999979f, 2, 1, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 53, FOREST_LEAF, 3 },
+    { 720.239929f, 2, 3, 0 },
+    { 0.0f, 54, FOREST_LEAF, 0 },
+    { 0.0f, 55, FOREST_LEAF, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    { 6.03999949f, 2, 1, 0 },
+    { 0.0f, 56, FOREST_LEAF, 4 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    // Tree 7
+    { 4.05000019f, 6, 4, 0 },
+    { 47.7449989f, 4, 2, 0 },
+    { 2.87000036f, 2, 4, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 57, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 767.369934f, 14, 3, 0 },
+    { 404.799957f, 4, 3, 0 },
+    { 15.1999989f, 2, 0, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 58, FOREST_LEAF, 3 },
+    { 8.22999954f, 2, 4, 0 },
+    { 0.0f, 59, FOREST_LEAF, 3 },
+    { 679.734924f, 4, 3, 0 },
+    { 10.2200003f, 2, 4, 0 },
+    { 0.0f, 60, FOREST_LEAF, 0 },
+    { 0.0f, 61, FOREST_LEAF, 0 },
+    { 14.874999f, 2, 0, 0 },
+    { 0.0f, 62, FOREST_LEAF, 0 },
+    { 0.0f, 63, FOREST_LEAF, 1 },
+    { 16.3249989f, 2, 0, 0 },
+    { 0.0f, 64, FOREST_LEAF, 1 },
+    { 44.8649979f, 2, 2, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    { 0.0f, 65, FOREST_LEAF, 1 },
+    // Tree 8
+    { 56.0249977f, 18, 2, 0 },
+    { 0.750000298f, 4, 1, 0 },
+    { 0.575000405f, 2, 1, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 66, FOREST_LEAF, 2 },
+    { 16.75f, 12, 4, 0 },
+    { 407.494965f, 4, 3, 0 },
+    { 3.56999969f, 2, 1, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 67, FOREST_LEAF, 0 },
+    { 2.86999989f, 4, 1, 0 },
+    { 14.374999f, 2, 0, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 68, FOREST_LEAF, 0 },
+    { 13.5349998f, 2, 0, 0 },
+    { 0.0f, 69, FOREST_LEAF, 3 },
+    { 0.0f, 70, FOREST_LEAF, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    // Tree 9
+    { 6.10500097f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 0.740000367f, 10, 1, 0 },
+    { 706.679932f, 2, 3, 0 },
+    { 0.0f, 71, FOREST_LEAF, 2 },
+    { 0.270000577f, 2, 1, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 36.9049988f, 4, 2, 0 },
+    { 3.44500017f, 2, 4, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 21, FOREST_LEAF, 2 },
+    { 0.0f, 51, FOREST_LEAF, 2 },
+    { 725.604919f, 12, 3, 0 },
+    { 426.814941f, 6, 3, 0 },
+    { 3.8099997f, 4, 1, 0 },
+    { 414.379974f, 2, 3, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 16, FOREST_LEAF, 3 },
+    { 0.0f, 45, FOREST_LEAF, 0 },
+    { 9.13500023f, 2, 4, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 2.76499987f, 2, 1, 0 },
+    { 0.0f, 72, FOREST_LEAF, 3 },
+    { 0.0f, 73, FOREST_LEAF, 0 },
+    { 18.4699993f, 6, 4, 0 },
+    { 9.71000004f, 2, 4, 0 },
+    { 0.0f, 64, FOREST_LEAF, 1 },
+    { 765.379944f, 2, 3, 0 },
+    { 0.0f, 74, FOREST_LEAF, 1 },
+    { 0.0f, 75, FOREST_LEAF, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    // Tree 10
+    { 0.680000424f, 8, 1, 0 },
+    { 19.2299995f, 2, 0, 0 },
+    { 0.0f, 76, FOREST_LEAF, 2 },
+    { 0.175000533f, 2, 1, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.195000291f, 2, 1, 0 },
+    { 0.0f, 77, FOREST_LEAF, 2 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 4.4550004f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 14.329999f, 10, 0, 0 },
+    { 3.74999976f, 4, 1, 0 },
+    { 482.809967f, 2, 3, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 78, FOREST_LEAF, 0 },
+    { 11.9099998f, 2, 4, 0 },
+    { 0.0f, 79, FOREST_LEAF, 0 },
+    { 521.249939f, 2, 3, 0 },
+    { 0.0f, 45, FOREST_LEAF, 0 },
+    { 0.0f, 80, FOREST_LEAF, 0 },
+    { 775.679932f, 6, 3, 0 },
+    { 383.259949f, 2, 3, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 15.8950005f, 2, 4, 0 },
+    { 0.0f, 81, FOREST_LEAF, 0 },
+    { 0.0f, 82, FOREST_LEAF, 0 },
+    { 814.144958f, 4, 3, 0 },
+    { 16.6049995f, 2, 4, 0 },
+    { 0.0f, 83, FOREST_LEAF, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    // Tree 11
+    { 5.98500061f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.38500023f, 6, 4, 0 },
+    { 36.9599991f, 2, 2, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 37.7099991f, 2, 2, 0 },
+    { 0.0f, 77, FOREST_LEAF, 2 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 719.804932f, 14, 3, 0 },
+    { 433.244965f, 6, 3, 0 },
+    { 16.3099995f, 4, 0, 0 },
+    { 383.564941f, 2, 3, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 84, FOREST_LEAF, 3 },
+    { 0.0f, 45, FOREST_LEAF, 0 },
+    { 2.76499987f, 4, 1, 0 },
+    { 42.1149979f, 2, 2, 0 },
+    { 0.0f, 85, FOREST_LEAF, 1 },
+    { 0.0f, 52, FOREST_LEAF, 3 },
+    { 475.269958f, 2, 3, 0 },
+    { 0.0f, 86, FOREST_LEAF, 0 },
+    { 0.0f, 87, FOREST_LEAF, 0 },
+    { 16.3399982f, 4, 0, 0 },
+    { 3.87999964f, 2, 1, 0 },
+    { 0.0f, 88, FOREST_LEAF, 0 },
+    { 0.0f, 89, FOREST_LEAF, 0 },
+    { 18.4949989f, 2, 4, 0 },
+    { 0.0f, 83, FOREST_LEAF, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    // Tree 12
+    { 4.7050004f, 10, 4, 0 },
+    { 47.7449989f, 8, 2, 0 },
+    { 19.4799995f, 2, 0, 0 },
+    { 0.0f, 90, FOREST_LEAF, 2 },
+    { 36.9599991f, 2, 2, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 37.4599991f, 2, 2, 0 },
+    { 0.0f, 91, FOREST_LEAF, 2 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 740.674927f, 22, 3, 0 },
+    { 3.37499976f, 12, 1, 0 },
+    { 15.0099993f, 6, 0, 0 },
+    { 2.71499991f, 2, 1, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 11.1849995f, 2, 4, 0 },
+    { 0.0f, 31, FOREST_LEAF, 3 },
+    { 0.0f, 92, FOREST_LEAF, 3 },
+    { 407.374969f, 2, 3, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 533.564941f, 2, 3, 0 },
+    { 0.0f, 45, FOREST_LEAF, 0 },
+    { 0.0f, 93, FOREST_LEAF, 0 },
+    { 13.0149994f, 4, 0, 0 },
+    { 11.0549994f, 2, 0, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 94, FOREST_LEAF, 3 },
+    { 9.5f, 2, 4, 0 },
+    { 0.0f, 95, FOREST_LEAF, 0 },
+    { 662.614929f, 2, 3, 0 },
+    { 0.0f, 96, FOREST_LEAF, 0 },
+    { 0.0f, 97, FOREST_LEAF, 0 },
+    { 810.454956f, 6, 3, 0 },
+    { 18.0349979f, 4, 0, 0 },
+    { 15.085f, 2, 4, 0 },
+    { 0.0f, 83, FOREST_LEAF, 0 },
+    { 0.0f, 98, FOREST_LEAF, 0 },
+    { 0.0f, 65, FOREST_LEAF, 1 },
+    { 16.8349991f, 2, 4, 0 },
+    { 0.0f, 99, FOREST_LEAF, 3 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    // Tree 13
+    { 6.05000067f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 683.754944f, 18, 3, 0 },
+    { 3.1099999f, 10, 1, 0 },
+    { 14.6499996f, 4, 0, 0 },
+    { 14.3149996f, 2, 0, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 0.0f, 100, FOREST_LEAF, 3 },
+    { 406.949951f, 2, 3, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 17.4649982f, 2, 0, 0 },
+    { 0.0f, 101, FOREST_LEAF, 0 },
+    { 0.0f, 102, FOREST_LEAF, 0 },
+    { 383.564941f, 2, 3, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 8.72999954f, 2, 4, 0 },
+    { 0.0f, 103, FOREST_LEAF, 3 },
+    { 52.7599983f, 2, 2, 0 },
+    { 0.0f, 104, FOREST_LEAF, 0 },
+    { 0.0f, 105, FOREST_LEAF, 0 },
+    { 6.45000029f, 4, 4, 0 },
+    { 3.46500039f, 2, 4, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 37, FOREST_LEAF, 2 },
+    { 16.5449982f, 6, 0, 0 },
+    { 3.6849997f, 2, 1, 0 },
+    { 0.0f, 106, FOREST_LEAF, 1 },
+    { 829.559937f, 2, 3, 0 },
+    { 0.0f, 107, FOREST_LEAF, 0 },
+    { 0.0f, 108, FOREST_LEAF, 1 },
+    { 16.6049995f, 4, 4, 0 },
+    { 17.7149982f, 2, 0, 0 },
+    { 0.0f, 109, FOREST_LEAF, 1 },
+    { 0.0f, 75, FOREST_LEAF, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+    // Tree 14
+    { 0.680000424f, 8, 1, 0 },
+    { 3.14000058f, 6, 4, 0 },
+    { 834.264954f, 4, 3, 0 },
+    { 831.089966f, 2, 3, 0 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 91, FOREST_LEAF, 2 },
+    { 0.0f, 1, FOREST_LEAF, 2 },
+    { 0.0f, 110, FOREST_LEAF, 2 },
+    { 16.6800003f, 14, 4, 0 },
+    { 4.4550004f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 10.2449999f, 6, 4, 0 },
+    { 475.269958f, 2, 3, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 680.974915f, 2, 3, 0 },
+    { 0.0f, 111, FOREST_LEAF, 0 },
+    { 0.0f, 64, FOREST_LEAF, 1 },
+    { 385.96994f, 2, 3, 0 },
+    { 0.0f, 4, FOREST_LEAF, 3 },
+    { 2.70499992f, 2, 1, 0 },
+    { 0.0f, 112, FOREST_LEAF, 3 },
+    { 0.0f, 113, FOREST_LEAF, 0 },
+    { 0.0f, 9, FOREST_LEAF, 1 },
+};
+
+// Root node of each tree
+const uint16_t SOFT_ROOTS[] = {
+    0, 23, 52, 77, 104, 131, 154, 181, 206, 225, 256, 287, 316, 357, 392
+};
+
+// Leaf class distributions, each row sums to 255
+const uint8_t SOFT_LEAF_PROBA[] = {
+    0, 0, 0, 0, 255,
+    0, 0, 255, 0, 0,
+    0, 21, 234, 0, 0,
+    0, 39, 216, 0, 0,
+    0, 0, 0, 255, 0,
+    96, 0, 0, 159, 0,
+    102, 102, 17, 34, 0,
+    66, 47, 0, 142, 0,
+    233, 14, 0, 8, 0,
+    0, 255, 0, 0, 0,
+    0, 64, 127, 64, 0,
+    0, 20, 235, 0, 0,
+    0, 26, 229, 0, 0,
+    146, 0, 0, 109, 0,
+    0, 14, 0, 241, 0,
+    109, 0, 0, 146, 0,
+    36, 0, 0, 219, 0,
+    238, 10, 0, 7, 0,
+    46, 209, 0, 0, 0,
+    128, 102, 0, 25, 0,
+    232, 0, 0, 23, 0,
+    0, 36, 219, 0, 0,
+    3, 0, 0, 252, 0,
+    0, 64, 0, 191, 0,
+    207, 0, 0, 48, 0,
+    108, 96, 0, 51, 0,
+    51, 34, 0, 170, 0,
+    244, 3, 0, 8, 0,
+    143, 101, 0, 11, 0,
+    0, 0, 170, 85, 0,
+    0, 28, 227, 0, 0,
+    4, 4, 0, 247, 0,
+    219, 0, 0, 36, 0,
+    98, 39, 0, 118, 0,
+    64, 159, 0, 32, 0,
+    234, 18, 0, 3, 0,
+    0, 113, 142, 0, 0,
+    0, 32, 223, 0, 0,
+    28, 199, 0, 28, 0,
+    230, 25, 0, 0, 0,
+    46, 12, 0, 197, 0,
+    230, 11, 0, 14, 0,
+    0, 64, 191, 0, 0,
+    170, 0, 0, 85, 0,
+    204, 0, 0, 51, 0,
+    255, 0, 0, 0, 0,
+    59, 0, 0, 196, 0,
+    181, 42, 0, 32, 0,
+    233, 19, 0, 3, 0,
+    179, 0, 0, 76, 0,
+    0, 73, 182, 0, 0,
+    0, 70, 185, 0, 0,
+    73, 0, 0, 182, 0,
+    0, 113, 0, 142, 0,
+    232, 5, 0, 18, 0,
+    112, 87, 0, 31, 25,
+    85, 0, 0, 0, 170,
+    0, 85, 170, 0, 0,
+    77, 0, 0, 178, 0,
+    0, 0, 0, 209, 46,
+    160, 21, 0, 74, 0,
+    233, 6, 0, 16, 0,
+    185, 70, 0, 0, 0,
+    121, 134, 0, 0, 0,
+    43, 127, 0, 85, 0,
+    36, 219, 0, 0, 0,
+    0, 0, 213, 42, 0,
+    128, 0, 0, 127, 0,
+    149, 85, 0, 21, 0,
+    59, 29, 0, 108, 59,
+    240, 12, 0, 3, 0,
+    0, 0, 204, 51, 0,
+    28, 85, 0, 142, 0,
+    236, 13, 0, 6, 0,
+    109, 146, 0, 0, 0,
+    227, 28, 0, 0, 0,
+    0, 37, 182, 36, 0,
+    0, 23, 232, 0, 0,
+    179, 76, 0, 0, 0,
+    182, 0, 0, 73, 0,
+    213, 0, 0, 42, 0,
+    242, 12, 0, 1, 0,
+    159, 96, 0, 0, 0,
+    128, 127, 0, 0, 0,
+    20, 0, 0, 235, 0,
+    0, 165, 0, 90, 0,
+    202, 0, 0, 53, 0,
+    237, 14, 0, 4, 0,
+    109, 73, 0, 73, 0,
+    204, 51, 0, 0, 0,
+    0, 57, 198, 0, 0,
+    0, 43, 212, 0, 0,
+    85, 0, 0, 170, 0,
+    139, 81, 0, 35, 0,
+    102, 0, 0, 153, 0,
+    91, 91, 0, 73, 0,
+    251, 0, 0, 4, 0,
+    207, 48, 0, 0, 0,
+    170, 85, 0, 0, 0,
+    85, 28, 0, 142, 0,
+    32, 0, 0, 223, 0,
+    238, 17, 0, 0, 0,
+    153, 51, 0, 51, 0,
+    64, 0, 0, 191, 0,
+    248, 5, 0, 2, 0,
+    196, 0, 0, 59, 0,
+    23, 232, 0, 0, 0,
+    228, 27, 0, 0, 0,
+    73, 182, 0, 0, 0,
+    113, 142, 0, 0, 0,
+    0, 43, 170, 42, 0,
+    243, 12, 0, 0, 0,
+    51, 0, 0, 204, 0,
+    231, 13, 0, 11, 0,
+};
+
+const SoftForest SOLAR_SOFT_FOREST = {
+    {
+        SOFT_NODES,
+        SOFT_ROOTS,
+        15,   // num_trees
+        5,    // num_features
+        5,    // num_classes
+        NULL,   // scaler_mean: folded into thresholds
+        NULL,   // scaler_std
+        SOFT_CLASS_NAMES,
+    },
+    SOFT_LEAF_PROBA,
+    255,   // proba_scale
+};
+static_assert(5 <= FOREST_MAX_FEATURES && 5 <= FOREST_MAX_CLASSES,
+              "SOLAR_SOFT_FOREST: define FOREST_MAX_FEATURES >= 5 and FOREST_MAX_CLASSES >= 5");
+
+#endif // SOLAR_FAULT_MODEL_SOFT_H
@@ -0,0 +1,1236 @@
+/*
+ * Solar Panel Fault Detection - Random Forest Model (flat node table)
+ * Generated from solar_fault_rf_model.joblib (sha256 1b364580bcfcb794)
+ * Trees: 15, Max Depth: 6, Nodes: 269 (2152 bytes)
+ * Thresholds: raw sensor units (StandardScaler folded in)
+ * 
+ * Classes:
+ *   0: Dust_Accumulation
+ *   1: Normal
+ *   2: Open_Circuit
+ *   3: Partial_Shading
+ *   4: Short_Circuit
+ * 
+ * Usage: int fault_type = forest_predict(&SOLAR_FOREST, features);
+ */
+
+#ifndef SOLAR_FAULT_MODEL_TABLE_H
+#define SOLAR_FAULT_MODEL_TABLE_H
+
+#include "forest_runtime.h"
+
+// Fault type names
+const char* const FOREST_CLASS_NAMES[] = {
+    "Dust_Accumulation",
+    "Normal",
+    "Open_Circuit",
+    "Partial_Shading",
+    "Short_Circuit",
+};
+
+// Feature names (for debugging)
+const char* const FOREST_FEATURE_NAMES[] = {
+    "Voltage",
+    "Current",
+    "Temperature",
+    "Light_Intensity",
+    "Efficiency",
+};
+
+// Node table: { threshold, right, feature, value }
+const ForestNode FOREST_NODES[] = {
+    // Tree 0
+    { 6.01000023f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.13999987f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 18.6800003f, 10, 4, 0 },
+    { 407.494965f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.75499988f, 4, 1, 0 },
+    { 14.374999f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.5349998f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 1
+    { 0.69500047f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 4.40999985f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 721.264954f, 10, 3, 0 },
+    { 404.799957f, 4, 3, 0 },
+    { 3.56999969f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.1699991f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.43999982f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 18.5049992f, 4, 4, 0 },
+    { 786.299927f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 2
+    { 6.07500029f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.7050004f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.6800003f, 8, 4, 0 },
+    { 3.20499992f, 4, 1, 0 },
+    { 14.4349995f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.0999994f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 3
+    { 6.01000023f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 0.750000298f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.6299992f, 14, 4, 0 },
+    { 14.3949995f, 8, 0, 0 },
+    { 11.8800001f, 4, 4, 0 },
+    { 3.82499981f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 45.9349976f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 383.259949f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.76499987f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 4
+    { 56.9749985f, 18, 2, 0 },
+    { 0.680000424f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 18.4949989f, 14, 4, 0 },
+    { 2.99499989f, 6, 1, 0 },
+    { 471.684967f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.74000001f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 9.00500011f, 4, 4, 0 },
+    { 5.19999933f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 377.73996f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    // Tree 5
+    { 6.01000023f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.53000021f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.75f, 12, 4, 0 },
+    { 433.044952f, 6, 3, 0 },
+    { 15.3999996f, 4, 0, 0 },
+    { 3.63999987f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.9449997f, 4, 0, 0 },
+    { 475.654968f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 6
+    { 0.69500047f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 55.6699982f, 8, 2, 0 },
+    { 18.5300007f, 6, 4, 0 },
+    { 404.189972f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.63499999f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    // Tree 7
+    { 4.05000019f, 4, 4, 0 },
+    { 47.7449989f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 767.369934f, 10, 3, 0 },
+    { 404.799957f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 8.22999954f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 679.734924f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 14.874999f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 8
+    { 56.0249977f, 16, 2, 0 },
+    { 0.750000298f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.75f, 12, 4, 0 },
+    { 407.494965f, 4, 3, 0 },
+    { 3.56999969f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 2.86999989f, 4, 1, 0 },
+    { 14.374999f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.5349998f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    // Tree 9
+    { 6.10500097f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 0.740000367f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 725.604919f, 10, 3, 0 },
+    { 426.814941f, 4, 3, 0 },
+    { 3.8099997f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 9.13500023f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.76499987f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 18.4699993f, 6, 4, 0 },
+    { 9.71000004f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 765.379944f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 10
+    { 0.680000424f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 4.4550004f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 14.329999f, 6, 0, 0 },
+    { 3.74999976f, 4, 1, 0 },
+    { 482.809967f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 775.679932f, 4, 3, 0 },
+    { 383.259949f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 814.144958f, 4, 3, 0 },
+    { 16.6049995f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 11
+    { 5.98500061f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.38500023f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 719.804932f, 10, 3, 0 },
+    { 433.244965f, 4, 3, 0 },
+    { 16.3099995f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 2.76499987f, 4, 1, 0 },
+    { 42.1149979f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 16.3399982f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 18.4949989f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 12
+    { 4.7050004f, 4, 4, 0 },
+    { 47.7449989f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 740.674927f, 10, 3, 0 },
+    { 3.37499976f, 6, 1, 0 },
+    { 15.0099993f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 407.374969f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.0149994f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 810.454956f, 4, 3, 0 },
+    { 18.0349979f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 16.8349991f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 13
+    { 6.05000067f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 683.754944f, 12, 3, 0 },
+    { 3.1099999f, 6, 1, 0 },
+    { 14.6499996f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 406.949951f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 383.564941f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 8.72999954f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 6.45000029f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.5449982f, 6, 0, 0 },
+    { 3.6849997f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 829.559937f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 16.6049995f, 4, 4, 0 },
+    { 17.7149982f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 14
+    { 0.680000424f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.6800003f, 14, 4, 0 },
+    { 4.4550004f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 10.2449999f, 6, 4, 0 },
+    { 475.269958f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 680.974915f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 385.96994f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.70499992f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+};
+
+// Root node of each tree
+const uint16_t FOREST_ROOTS[] = {
+    0, 15, 34, 47, 66, 85, 102, 113, 128, 145, 166, 185, 204, 225, 252
+};
+
+const Forest SOLAR_FOREST = {
+    FOREST_NODES,
+    FOREST_ROOTS,
+    15,   // num_trees
+    5,    // num_features
+    5,    // num_classes
+    NULL,   // scaler_mean: folded into thresholds
+    NULL,   // scaler_std
+    FOREST_CLASS_NAMES,
+};
+static_assert(5 <= FOREST_MAX_FEATURES && 5 <= FOREST_MAX_CLASSES,
+              "SOLAR_FOREST: define FOREST_MAX_FEATURES >= 5 and FOREST_MAX_CLASSES >= 5");
+
+// The trees before compaction (same votes as SOLAR_FOREST), for
+// forest_predict_explain(&SOLAR_FOREST_EXPLAIN, FOREST_NODE_VALUES, ...);
+// unused tables are dropped by the linker
+const ForestNode FOREST_EXPLAIN_NODES[] = {
+    // Tree 0
+    { 6.01000023f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.13999987f, 8, 4, 0 },
+    { 39.8250008f, 6, 2, 0 },
+    { 20.9999981f, 4, 0, 0 },
+    { 36.9500008f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 18.6800003f, 12, 4, 0 },
+    { 407.494965f, 4, 3, 0 },
+    { 3.54999971f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.75499988f, 4, 1, 0 },
+    { 14.374999f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.5349998f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 1
+    { 0.69500047f, 8, 1, 0 },
+    { 19.1549988f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 4.00500011f, 4, 4, 0 },
+    { 39.8899994f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 4.40999985f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 721.264954f, 12, 3, 0 },
+    { 404.799957f, 4, 3, 0 },
+    { 3.56999969f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.1699991f, 4, 0, 0 },
+    { 48.9449997f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.43999982f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 18.5049992f, 6, 4, 0 },
+    { 786.299927f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 3.87999964f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 2
+    { 6.07500029f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.7050004f, 6, 4, 0 },
+    { 19.1949978f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 39.8899994f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.6800003f, 16, 4, 0 },
+    { 3.20499992f, 8, 1, 0 },
+    { 14.4349995f, 4, 0, 0 },
+    { 12.0999994f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 41.4150009f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.0999994f, 4, 0, 0 },
+    { 7.91000032f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 662.014954f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 3
+    { 6.01000023f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 0.750000298f, 10, 1, 0 },
+    { 19.6699982f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 39.8250008f, 6, 2, 0 },
+    { 0.275000423f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.305000424f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.6299992f, 14, 4, 0 },
+    { 14.3949995f, 8, 0, 0 },
+    { 11.8800001f, 4, 4, 0 },
+    { 3.82499981f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 45.9349976f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 383.259949f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.76499987f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 4
+    { 56.9749985f, 26, 2, 0 },
+    { 0.680000424f, 10, 1, 0 },
+    { 20.1999989f, 4, 0, 0 },
+    { 1.95500016f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 20.9949989f, 4, 0, 0 },
+    { 2.67000055f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 18.4949989f, 14, 4, 0 },
+    { 2.99499989f, 6, 1, 0 },
+    { 471.684967f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.74000001f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 9.00500011f, 4, 4, 0 },
+    { 5.19999933f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 377.73996f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    // Tree 5
+    { 6.01000023f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.53000021f, 4, 4, 0 },
+    { 3.21500039f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.75f, 16, 4, 0 },
+    { 433.044952f, 8, 3, 0 },
+    { 15.3999996f, 4, 0, 0 },
+    { 3.63999987f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 3.86999965f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.9449997f, 4, 0, 0 },
+    { 475.654968f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 54.1800003f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 6
+    { 0.69500047f, 8, 1, 0 },
+    { 3.07500005f, 6, 4, 0 },
+    { 21.7449989f, 4, 0, 0 },
+    { 39.2350006f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 55.6699982f, 16, 2, 0 },
+    { 18.5300007f, 14, 4, 0 },
+    { 404.189972f, 6, 3, 0 },
+    { 12.2799997f, 4, 4, 0 },
+    { 3.56999969f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.63499999f, 4, 1, 0 },
+    { 2.21999979f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 720.239929f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 6.03999949f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    // Tree 7
+    { 4.05000019f, 6, 4, 0 },
+    { 47.7449989f, 4, 2, 0 },
+    { 2.87000036f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 767.369934f, 14, 3, 0 },
+    { 404.799957f, 4, 3, 0 },
+    { 15.1999989f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 8.22999954f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 679.734924f, 4, 3, 0 },
+    { 10.2200003f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 14.874999f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 16.3249989f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 44.8649979f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 8
+    { 56.0249977f, 18, 2, 0 },
+    { 0.750000298f, 4, 1, 0 },
+    { 0.575000405f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.75f, 12, 4, 0 },
+    { 407.494965f, 4, 3, 0 },
+    { 3.56999969f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 2.86999989f, 4, 1, 0 },
+    { 14.374999f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.5349998f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    // Tree 9
+    { 6.10500097f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 0.740000367f, 10, 1, 0 },
+    { 706.679932f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.270000577f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 36.9049988f, 4, 2, 0 },
+    { 3.44500017f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 725.604919f, 12, 3, 0 },
+    { 426.814941f, 6, 3, 0 },
+    { 3.8099997f, 4, 1, 0 },
+    { 414.379974f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 9.13500023f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.76499987f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 18.4699993f, 6, 4, 0 },
+    { 9.71000004f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 765.379944f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 10
+    { 0.680000424f, 8, 1, 0 },
+    { 19.2299995f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.175000533f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.195000291f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 4.4550004f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 14.329999f, 10, 0, 0 },
+    { 3.74999976f, 4, 1, 0 },
+    { 482.809967f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 11.9099998f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 521.249939f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 775.679932f, 6, 3, 0 },
+    { 383.259949f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 15.8950005f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 814.144958f, 4, 3, 0 },
+    { 16.6049995f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 11
+    { 5.98500061f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 4.38500023f, 6, 4, 0 },
+    { 36.9599991f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 37.7099991f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 719.804932f, 14, 3, 0 },
+    { 433.244965f, 6, 3, 0 },
+    { 16.3099995f, 4, 0, 0 },
+    { 383.564941f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 2.76499987f, 4, 1, 0 },
+    { 42.1149979f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 475.269958f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 16.3399982f, 4, 0, 0 },
+    { 3.87999964f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 18.4949989f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 12
+    { 4.7050004f, 10, 4, 0 },
+    { 47.7449989f, 8, 2, 0 },
+    { 19.4799995f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 36.9599991f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 37.4599991f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 740.674927f, 22, 3, 0 },
+    { 3.37499976f, 12, 1, 0 },
+    { 15.0099993f, 6, 0, 0 },
+    { 2.71499991f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 11.1849995f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 407.374969f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 533.564941f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 13.0149994f, 4, 0, 0 },
+    { 11.0549994f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 9.5f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 662.614929f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 810.454956f, 6, 3, 0 },
+    { 18.0349979f, 4, 0, 0 },
+    { 15.085f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 16.8349991f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 13
+    { 6.05000067f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 683.754944f, 18, 3, 0 },
+    { 3.1099999f, 10, 1, 0 },
+    { 14.6499996f, 4, 0, 0 },
+    { 14.3149996f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 406.949951f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 17.4649982f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 383.564941f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 8.72999954f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 52.7599983f, 2, 2, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 6.45000029f, 4, 4, 0 },
+    { 3.46500039f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.5449982f, 6, 0, 0 },
+    { 3.6849997f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 829.559937f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 16.6049995f, 4, 4, 0 },
+    { 17.7149982f, 2, 0, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    // Tree 14
+    { 0.680000424f, 8, 1, 0 },
+    { 3.14000058f, 6, 4, 0 },
+    { 834.264954f, 4, 3, 0 },
+    { 831.089966f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 0.0f, 0, FOREST_LEAF, 2 },
+    { 16.6800003f, 14, 4, 0 },
+    { 4.4550004f, 2, 4, 0 },
+    { 0.0f, 0, FOREST_LEAF, 4 },
+    { 10.2449999f, 6, 4, 0 },
+    { 475.269958f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 680.974915f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+    { 385.96994f, 2, 3, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 2.70499992f, 2, 1, 0 },
+    { 0.0f, 0, FOREST_LEAF, 3 },
+    { 0.0f, 0, FOREST_LEAF, 0 },
+    { 0.0f, 0, FOREST_LEAF, 1 },
+};
+
+// Root node of each tree
+const uint16_t FOREST_EXPLAIN_ROOTS[] = {
+    0, 23, 52, 77, 104, 131, 154, 181, 206, 225, 256, 287, 316, 357, 392
+};
+
+const Forest SOLAR_FOREST_EXPLAIN = {
+    FOREST_EXPLAIN_NODES,
+    FOREST_EXPLAIN_ROOTS,
+    15,   // num_trees
+    5,    // num_features
+    5,    // num_classes
+    NULL,   // scaler_mean: folded into thresholds
+    NULL,   // scaler_std
+    FOREST_CLASS_NAMES,
+};
+static_assert(5 <= FOREST_MAX_FEATURES && 5 <= FOREST_MAX_CLASSES,
+              "SOLAR_FOREST_EXPLAIN: define FOREST_MAX_FEATURES >= 5 and FOREST_MAX_CLASSES >= 5");
+
+// Class distribution at each node (sklearn's tree_.value, normalized;
+// num_classes per node, same order as FOREST_EXPLAIN_NODES)
+#define FOREST_HAVE_NODE_VALUES 1
+const float FOREST_NODE_VALUES[] = {
+    // Tree 0
+    0.203125f, 0.203906253f, 0.192187503f, 0.194531247f, 0.206249997f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.255905509f, 0.25688976f, 0.242125988f, 0.245078743f, 0.0f,
+    0.0f, 0.0120967738f, 0.987903237f, 0.0f, 0.0f,
+    0.0f, 0.00425531901f, 0.995744705f, 0.0f, 0.0f,
+    0.0f, 0.0149253728f, 0.985074639f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0833333358f, 0.916666687f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.15384616f, 0.846153855f, 0.0f, 0.0f,
+    0.338541657f, 0.3359375f, 0.00130208337f, 0.32421875f, 0.0f,
+    0.485074639f, 0.0485074632f, 0.0018656716f, 0.464552253f, 0.0f,
+    0.0150753772f, 0.0f, 0.0f, 0.984924614f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.375f, 0.0f, 0.0f, 0.625f, 0.0f,
+    0.76261127f, 0.0771513358f, 0.00296735903f, 0.157270029f, 0.0f,
+    0.139534891f, 0.139534891f, 0.0232558139f, 0.697674394f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.400000006f, 0.400000006f, 0.0666666701f, 0.13333334f, 0.0f,
+    0.853741467f, 0.0680272132f, 0.0f, 0.07823129f, 0.0f,
+    0.259259254f, 0.185185179f, 0.0f, 0.555555582f, 0.0f,
+    0.913857698f, 0.0561797768f, 0.0f, 0.0299625471f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    // Tree 1
+    0.216406256f, 0.212500006f, 0.192968756f, 0.193749994f, 0.184375003f,
+    0.0f, 0.0158102773f, 0.976284564f, 0.00790513866f, 0.0f,
+    0.0f, 0.25f, 0.5f, 0.25f, 0.0f,
+    0.0f, 0.00816326495f, 0.991836727f, 0.0f, 0.0f,
+    0.0f, 0.00425531901f, 0.995744705f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0769230798f, 0.923076928f, 0.0f, 0.0f,
+    0.0f, 0.100000001f, 0.899999976f, 0.0f, 0.0f,
+    0.269717634f, 0.260954231f, 0.0f, 0.23953262f, 0.229795516f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.350189626f, 0.338811636f, 0.0f, 0.310998738f, 0.0f,
+    0.503875971f, 0.0232558139f, 0.0f, 0.472868204f, 0.0f,
+    0.0186915882f, 0.0f, 0.0f, 0.981308401f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.571428597f, 0.0f, 0.0f, 0.428571433f, 0.0f,
+    0.847682118f, 0.0397351012f, 0.0f, 0.11258278f, 0.0f,
+    0.119999997f, 0.0399999991f, 0.0f, 0.839999974f, 0.0f,
+    0.0f, 0.055555556f, 0.0f, 0.944444418f, 0.0f,
+    0.428571433f, 0.0f, 0.0f, 0.571428597f, 0.0f,
+    0.913357377f, 0.0397111923f, 0.0f, 0.0469314083f, 0.0f,
+    0.142857149f, 0.0f, 0.0f, 0.857142866f, 0.0f,
+    0.933333337f, 0.0407407396f, 0.0f, 0.025925925f, 0.0f,
+    0.0618181825f, 0.930909097f, 0.0f, 0.00727272732f, 0.0f,
+    0.53125f, 0.40625f, 0.0f, 0.0625f, 0.0f,
+    0.181818187f, 0.818181813f, 0.0f, 0.0f, 0.0f,
+    0.714285731f, 0.190476194f, 0.0f, 0.095238097f, 0.0f,
+    0.5f, 0.400000006f, 0.0f, 0.100000001f, 0.0f,
+    0.909090936f, 0.0f, 0.0f, 0.0909090936f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    // Tree 2
+    0.2265625f, 0.215625003f, 0.185937494f, 0.189062506f, 0.182812497f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.277246654f, 0.263862342f, 0.22753346f, 0.23135756f, 0.0f,
+    0.0f, 0.00833333377f, 0.991666675f, 0.0f, 0.0f,
+    0.0f, 0.142857149f, 0.857142866f, 0.0f, 0.0f,
+    0.0f, 0.00429184549f, 0.995708168f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.142857149f, 0.857142866f, 0.0f, 0.0f,
+    0.359801501f, 0.339950383f, 0.0f, 0.300248146f, 0.0f,
+    0.506108224f, 0.0715532303f, 0.0f, 0.422338575f, 0.0f,
+    0.122137405f, 0.0648854971f, 0.0f, 0.812977076f, 0.0f,
+    0.00970873795f, 0.00970873795f, 0.0f, 0.980582535f, 0.0f,
+    0.0101010101f, 0.0f, 0.0f, 0.98989898f, 0.0f,
+    0.0f, 0.25f, 0.0f, 0.75f, 0.0f,
+    0.535714269f, 0.267857134f, 0.0f, 0.196428567f, 0.0f,
+    0.8125f, 0.0f, 0.0f, 0.1875f, 0.0f,
+    0.425000012f, 0.375f, 0.0f, 0.200000003f, 0.0f,
+    0.829581976f, 0.0771704167f, 0.0f, 0.093247585f, 0.0f,
+    0.119999997f, 0.0799999982f, 0.0f, 0.800000012f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.200000003f, 0.13333334f, 0.0f, 0.666666687f, 0.0f,
+    0.891608417f, 0.0769230798f, 0.0f, 0.031468533f, 0.0f,
+    0.957983196f, 0.0126050422f, 0.0f, 0.0294117648f, 0.0f,
+    0.5625f, 0.395833343f, 0.0f, 0.0416666679f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    // Tree 3
+    0.224999994f, 0.23046875f, 0.189062506f, 0.169531256f, 0.185937494f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.276391566f, 0.283109397f, 0.232245684f, 0.208253354f, 0.0f,
+    0.0f, 0.0121457493f, 0.979757071f, 0.0080971662f, 0.0f,
+    0.0f, 0.0f, 0.666666687f, 0.333333343f, 0.0f,
+    0.0f, 0.012448133f, 0.987551868f, 0.0f, 0.0f,
+    0.0f, 0.00438596494f, 0.995614052f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0163934417f, 0.983606577f, 0.0f, 0.0f,
+    0.0f, 0.111111112f, 0.888888896f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.15384616f, 0.846153855f, 0.0f, 0.0f,
+    0.362264156f, 0.367295593f, 0.0f, 0.270440251f, 0.0f,
+    0.540337682f, 0.0562851764f, 0.0f, 0.403377116f, 0.0f,
+    0.142857149f, 0.021008404f, 0.0f, 0.836134434f, 0.0f,
+    0.0443349741f, 0.0147783253f, 0.0f, 0.940886676f, 0.0f,
+    0.0153061226f, 0.0153061226f, 0.0f, 0.96938777f, 0.0f,
+    0.857142866f, 0.0f, 0.0f, 0.142857149f, 0.0f,
+    0.714285731f, 0.0571428575f, 0.0f, 0.22857143f, 0.0f,
+    0.384615391f, 0.15384616f, 0.0f, 0.461538464f, 0.0f,
+    0.909090936f, 0.0f, 0.0f, 0.0909090936f, 0.0f,
+    0.861016929f, 0.0847457647f, 0.0f, 0.0542372875f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.897526503f, 0.0883392245f, 0.0f, 0.0141342757f, 0.0f,
+    0.25f, 0.625f, 0.0f, 0.125f, 0.0f,
+    0.916363657f, 0.0727272704f, 0.0f, 0.0109090907f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    // Tree 4
+    0.211718753f, 0.21875f, 0.198437497f, 0.203125f, 0.16796875f,
+    0.25232774f, 0.260707647f, 0.236499071f, 0.242085665f, 0.00837988872f,
+    0.0f, 0.0193050187f, 0.980695009f, 0.0f, 0.0f,
+    0.0f, 0.129032254f, 0.870967746f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.444444448f, 0.555555582f, 0.0f, 0.0f,
+    0.0f, 0.00438596494f, 0.995614052f, 0.0f, 0.0f,
+    0.0f, 0.0285714287f, 0.971428573f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.125f, 0.875f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.332515329f, 0.337423325f, 0.0f, 0.319018394f, 0.0110429451f,
+    0.483065963f, 0.0374331549f, 0.0f, 0.463458121f, 0.0160427801f,
+    0.0427350439f, 0.0341880359f, 0.0f, 0.923076928f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.526315808f, 0.421052635f, 0.0f, 0.0526315793f, 0.0f,
+    0.111111112f, 0.777777791f, 0.0f, 0.111111112f, 0.0f,
+    0.899999976f, 0.100000001f, 0.0f, 0.0f, 0.0f,
+    0.798165143f, 0.0397553518f, 0.0f, 0.134556577f, 0.0275229365f,
+    0.129032254f, 0.0322580636f, 0.0f, 0.54838711f, 0.290322572f,
+    0.181818187f, 0.0454545468f, 0.0f, 0.772727251f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.868243217f, 0.0405405387f, 0.0f, 0.091216214f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.901754379f, 0.042105265f, 0.0f, 0.056140352f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    // Tree 5
+    0.192187503f, 0.19921875f, 0.189062506f, 0.202343747f, 0.217187494f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.245508984f, 0.254491031f, 0.241516963f, 0.258483022f, 0.0f,
+    0.0f, 0.00819672085f, 0.991803288f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.25f, 0.75f, 0.0f, 0.0f,
+    0.324538261f, 0.333773077f, 0.0f, 0.341688663f, 0.0f,
+    0.468571424f, 0.0380952395f, 0.0f, 0.49333334f, 0.0f,
+    0.0769230798f, 0.0f, 0.0f, 0.923076928f, 0.0f,
+    0.0244897958f, 0.0f, 0.0f, 0.97551018f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.666666687f, 0.0f, 0.0f, 0.333333343f, 0.0f,
+    0.933333337f, 0.0f, 0.0f, 0.0666666701f, 0.0f,
+    0.800000012f, 0.0f, 0.0f, 0.200000003f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.852830172f, 0.0754716992f, 0.0f, 0.0716981143f, 0.0f,
+    0.540540516f, 0.108108111f, 0.0f, 0.351351351f, 0.0f,
+    0.230769232f, 0.0f, 0.0f, 0.769230783f, 0.0f,
+    0.708333313f, 0.166666672f, 0.0f, 0.125f, 0.0f,
+    0.903508782f, 0.0701754391f, 0.0f, 0.0263157897f, 0.0f,
+    0.912844062f, 0.0733944923f, 0.0f, 0.0137614682f, 0.0f,
+    0.699999988f, 0.0f, 0.0f, 0.300000012f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    // Tree 6
+    0.221874997f, 0.198437497f, 0.194531247f, 0.20703125f, 0.178124994f,
+    0.0f, 0.0196850393f, 0.98031497f, 0.0f, 0.0f,
+    0.0f, 0.00823045243f, 0.991769552f, 0.0f, 0.0f,
+    0.0f, 0.0224719103f, 0.977528095f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.285714298f, 0.714285731f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.272727281f, 0.727272749f, 0.0f, 0.0f,
+    0.276803106f, 0.242690057f, 0.0f, 0.258284599f, 0.222222224f,
+    0.352499992f, 0.311250001f, 0.0f, 0.331250012f, 0.00499999989f,
+    0.490434796f, 0.0417391323f, 0.0f, 0.460869551f, 0.00695652189f,
+    0.0222222228f, 0.0f, 0.0f, 0.977777779f, 0.0f,
+    0.00921658985f, 0.0f, 0.0f, 0.990783393f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.285714298f, 0.0f, 0.0f, 0.714285731f, 0.0f,
+    0.375f, 0.0f, 0.0f, 0.625f, 0.0f,
+    0.791428566f, 0.068571426f, 0.0f, 0.128571436f, 0.0114285713f,
+    0.0f, 0.166666672f, 0.0f, 0.833333313f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.0f, 0.444444448f, 0.0f, 0.555555582f, 0.0f,
+    0.849693239f, 0.0613496937f, 0.0f, 0.0766871199f, 0.0122699384f,
+    0.908771932f, 0.0210526325f, 0.0f, 0.0701754391f, 0.0f,
+    0.439024389f, 0.341463417f, 0.0f, 0.121951222f, 0.097560972f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    0.00884955749f, 0.0f, 0.0f, 0.0f, 0.991150439f,
+    0.333333343f, 0.0f, 0.0f, 0.0f, 0.666666687f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    // Tree 7
+    0.203906253f, 0.21875f, 0.2109375f, 0.178906247f, 0.1875f,
+    0.0f, 0.00392156886f, 0.529411793f, 0.0f, 0.466666669f,
+    0.0f, 0.0073529412f, 0.992647052f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.333333343f, 0.666666687f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.338961035f, 0.361038953f, 0.0f, 0.297402591f, 0.00259740255f,
+    0.508840859f, 0.0412573665f, 0.0f, 0.445972502f, 0.00392927323f,
+    0.0150753772f, 0.0f, 0.0f, 0.984924614f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.300000012f, 0.0f, 0.0f, 0.699999988f, 0.0f,
+    0.825806439f, 0.0677419379f, 0.0f, 0.100000001f, 0.0064516128f,
+    0.0f, 0.0f, 0.0f, 0.818181813f, 0.181818187f,
+    0.856187284f, 0.0702341124f, 0.0f, 0.0735785961f, 0.0f,
+    0.888475835f, 0.0297397766f, 0.0f, 0.0817843899f, 0.0f,
+    0.625f, 0.0833333358f, 0.0f, 0.291666657f, 0.0f,
+    0.914285719f, 0.0244897958f, 0.0f, 0.0612244904f, 0.0f,
+    0.566666663f, 0.433333337f, 0.0f, 0.0f, 0.0f,
+    0.727272749f, 0.272727281f, 0.0f, 0.0f, 0.0f,
+    0.473684222f, 0.526315808f, 0.0f, 0.0f, 0.0f,
+    0.00766283507f, 0.984674335f, 0.0f, 0.00766283507f, 0.0f,
+    0.166666672f, 0.5f, 0.0f, 0.333333343f, 0.0f,
+    0.00392156886f, 0.996078432f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    0.142857149f, 0.857142866f, 0.0f, 0.0f, 0.0f,
+    // Tree 8
+    0.203125f, 0.206249997f, 0.203125f, 0.203125f, 0.184375003f,
+    0.247619048f, 0.251428574f, 0.247619048f, 0.247619048f, 0.00571428565f,
+    0.0f, 0.0f, 0.996168554f, 0.00383141753f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.833333313f, 0.166666672f, 0.0f,
+    0.329531044f, 0.334600747f, 0.0f, 0.328263611f, 0.00760456268f,
+    0.477941185f, 0.0349264704f, 0.0f, 0.476102948f, 0.011029412f,
+    0.0138248848f, 0.0f, 0.0f, 0.98617512f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.5f, 0.0f, 0.0f, 0.5f, 0.0f,
+    0.78593272f, 0.0581039749f, 0.0f, 0.137614682f, 0.0183486231f,
+    0.166666672f, 0.095238097f, 0.0f, 0.738095224f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.583333313f, 0.333333343f, 0.0f, 0.0833333358f, 0.0f,
+    0.877192974f, 0.0526315793f, 0.0f, 0.0491228066f, 0.0210526325f,
+    0.230769232f, 0.115384616f, 0.0f, 0.423076928f, 0.230769232f,
+    0.942084968f, 0.0463320464f, 0.0f, 0.0115830116f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    // Tree 9
+    0.208593756f, 0.212500006f, 0.189843744f, 0.189062506f, 0.200000003f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.260742188f, 0.265625f, 0.237304688f, 0.236328125f, 0.0f,
+    0.0f, 0.0160642564f, 0.97590363f, 0.00803212821f, 0.0f,
+    0.0f, 0.0f, 0.800000012f, 0.200000003f, 0.0f,
+    0.0f, 0.0167364012f, 0.983263612f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0615384616f, 0.938461542f, 0.0f, 0.0f,
+    0.0f, 0.0185185187f, 0.981481493f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.142857149f, 0.857142866f, 0.0f, 0.0f,
+    0.0f, 0.272727281f, 0.727272749f, 0.0f, 0.0f,
+    0.344516128f, 0.34580645f, 0.0f, 0.309677422f, 0.0f,
+    0.500982344f, 0.0314341858f, 0.0f, 0.467583507f, 0.0f,
+    0.05982906f, 0.0f, 0.0f, 0.940170944f, 0.0f,
+    0.0134529145f, 0.0f, 0.0f, 0.986547112f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.142857149f, 0.0f, 0.0f, 0.857142866f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.876363635f, 0.0581818186f, 0.0f, 0.0654545426f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.899253726f, 0.0597014911f, 0.0f, 0.0410447754f, 0.0f,
+    0.111111112f, 0.333333343f, 0.0f, 0.555555582f, 0.0f,
+    0.926640928f, 0.050193049f, 0.0f, 0.0231660232f, 0.0f,
+    0.0451127812f, 0.947368443f, 0.0f, 0.00751879718f, 0.0f,
+    0.545454562f, 0.363636374f, 0.0f, 0.0909090936f, 0.0f,
+    0.166666672f, 0.5f, 0.0f, 0.333333343f, 0.0f,
+    0.6875f, 0.3125f, 0.0f, 0.0f, 0.0f,
+    0.428571433f, 0.571428597f, 0.0f, 0.0f, 0.0f,
+    0.888888896f, 0.111111112f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    // Tree 10
+    0.201562494f, 0.22265625f, 0.19921875f, 0.184375003f, 0.192187503f,
+    0.0f, 0.00775193796f, 0.988372087f, 0.00387596898f, 0.0f,
+    0.0f, 0.142857149f, 0.714285731f, 0.142857149f, 0.0f,
+    0.0f, 0.00398406386f, 0.996015966f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.00847457629f, 0.991525412f, 0.0f, 0.0f,
+    0.0f, 0.0909090936f, 0.909090936f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.252446175f, 0.27690801f, 0.0f, 0.229941294f, 0.240704507f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.332474232f, 0.364690721f, 0.0f, 0.302835047f, 0.0f,
+    0.0987654328f, 0.0123456791f, 0.0f, 0.888888896f, 0.0f,
+    0.0313901342f, 0.0134529145f, 0.0f, 0.955156922f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.699999988f, 0.300000012f, 0.0f, 0.0f, 0.0f,
+    0.850000024f, 0.0f, 0.0f, 0.150000006f, 0.0f,
+    0.714285731f, 0.0f, 0.0f, 0.285714298f, 0.0f,
+    0.923076928f, 0.0f, 0.0f, 0.0769230798f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.833333313f, 0.0f, 0.0f, 0.166666672f, 0.0f,
+    0.439024389f, 0.525328338f, 0.0f, 0.0356472805f, 0.0f,
+    0.864150941f, 0.0641509444f, 0.0f, 0.0716981143f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.927125514f, 0.068825908f, 0.0f, 0.0040485831f, 0.0f,
+    0.948051929f, 0.0476190485f, 0.0f, 0.00432900432f, 0.0f,
+    0.625f, 0.375f, 0.0f, 0.0f, 0.0f,
+    0.0186567158f, 0.981343269f, 0.0f, 0.0f, 0.0f,
+    0.217391297f, 0.782608688f, 0.0f, 0.0f, 0.0f,
+    0.5f, 0.5f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    // Tree 11
+    0.200781256f, 0.220312506f, 0.209374994f, 0.205468744f, 0.1640625f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.240186915f, 0.263551414f, 0.2504673f, 0.245794386f, 0.0f,
+    0.0f, 0.00371747208f, 0.996282518f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0163934417f, 0.983606577f, 0.0f, 0.0f,
+    0.0f, 0.0909090936f, 0.909090936f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.320848942f, 0.350811481f, 0.0f, 0.328339577f, 0.0f,
+    0.456647396f, 0.0404624268f, 0.0f, 0.50289017f, 0.0f,
+    0.0602409653f, 0.0f, 0.0f, 0.939759016f, 0.0f,
+    0.020920502f, 0.0f, 0.0f, 0.979079485f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.0769230798f, 0.0f, 0.0f, 0.923076928f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.822222233f, 0.0777777806f, 0.0f, 0.100000001f, 0.0f,
+    0.0833333358f, 0.458333343f, 0.0f, 0.458333343f, 0.0f,
+    0.0f, 0.647058845f, 0.0f, 0.352941185f, 0.0f,
+    0.285714298f, 0.0f, 0.0f, 0.714285731f, 0.0f,
+    0.894308925f, 0.040650405f, 0.0f, 0.065040648f, 0.0f,
+    0.793650806f, 0.0f, 0.0f, 0.206349209f, 0.0f,
+    0.928961754f, 0.0546448082f, 0.0f, 0.0163934417f, 0.0f,
+    0.0709219873f, 0.921985805f, 0.0f, 0.00709219836f, 0.0f,
+    0.647058845f, 0.235294119f, 0.0f, 0.117647059f, 0.0f,
+    0.428571433f, 0.285714298f, 0.0f, 0.285714298f, 0.0f,
+    0.800000012f, 0.200000003f, 0.0f, 0.0f, 0.0f,
+    0.0339622647f, 0.96603775f, 0.0f, 0.0f, 0.0f,
+    0.5f, 0.5f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    // Tree 12
+    0.194531247f, 0.192187503f, 0.203906253f, 0.213281244f, 0.196093753f,
+    0.0f, 0.00582524249f, 0.506796122f, 0.0f, 0.487378627f,
+    0.0f, 0.0113636367f, 0.988636374f, 0.0f, 0.0f,
+    0.0f, 0.222222224f, 0.777777791f, 0.0f, 0.0f,
+    0.0f, 0.00392156886f, 0.996078432f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0175438598f, 0.982456148f, 0.0f, 0.0f,
+    0.0f, 0.166666672f, 0.833333313f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.325490206f, 0.31764707f, 0.0f, 0.356862754f, 0.0f,
+    0.452471495f, 0.0380228125f, 0.0f, 0.509505689f, 0.0f,
+    0.116438359f, 0.0273972601f, 0.0f, 0.856164396f, 0.0f,
+    0.0122950822f, 0.00409836043f, 0.0f, 0.983606577f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.0441176482f, 0.0147058824f, 0.0f, 0.941176474f, 0.0f,
+    0.0161290318f, 0.0161290318f, 0.0f, 0.967741907f, 0.0f,
+    0.333333343f, 0.0f, 0.0f, 0.666666687f, 0.0f,
+    0.645833313f, 0.145833328f, 0.0f, 0.208333328f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.756097555f, 0.170731708f, 0.0f, 0.073170729f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.545454562f, 0.318181813f, 0.0f, 0.13636364f, 0.0f,
+    0.871794879f, 0.051282052f, 0.0f, 0.0769230798f, 0.0f,
+    0.15384616f, 0.0f, 0.0f, 0.846153855f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.400000006f, 0.0f, 0.0f, 0.600000024f, 0.0f,
+    0.914027154f, 0.054298643f, 0.0f, 0.03167421f, 0.0f,
+    0.357142866f, 0.357142866f, 0.0f, 0.285714298f, 0.0f,
+    0.951690793f, 0.0338164233f, 0.0f, 0.0144927539f, 0.0f,
+    0.982352912f, 0.0f, 0.0f, 0.0176470596f, 0.0f,
+    0.810810804f, 0.189189196f, 0.0f, 0.0f, 0.0f,
+    0.0460251048f, 0.933054388f, 0.0f, 0.020920502f, 0.0f,
+    0.421052635f, 0.578947365f, 0.0f, 0.0f, 0.0f,
+    0.583333313f, 0.416666657f, 0.0f, 0.0f, 0.0f,
+    0.5f, 0.5f, 0.0f, 0.0f, 0.0f,
+    0.666666687f, 0.333333343f, 0.0f, 0.0f, 0.0f,
+    0.142857149f, 0.857142866f, 0.0f, 0.0f, 0.0f,
+    0.0136363637f, 0.963636339f, 0.0f, 0.0227272734f, 0.0f,
+    0.333333343f, 0.111111112f, 0.0f, 0.555555582f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    // Tree 13
+    0.22265625f, 0.208593756f, 0.188281253f, 0.178124994f, 0.202343747f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.279138088f, 0.261508316f, 0.236043096f, 0.223310485f, 0.0f,
+    0.518442631f, 0.014344262f, 0.0f, 0.467213124f, 0.0f,
+    0.097674422f, 0.0139534883f, 0.0f, 0.888372064f, 0.0f,
+    0.00540540554f, 0.0f, 0.0f, 0.994594574f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.125f, 0.0f, 0.0f, 0.875f, 0.0f,
+    0.666666687f, 0.100000001f, 0.0f, 0.233333334f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.800000012f, 0.119999997f, 0.0f, 0.0799999982f, 0.0f,
+    0.933333337f, 0.0666666701f, 0.0f, 0.0f, 0.0f,
+    0.600000024f, 0.200000003f, 0.0f, 0.200000003f, 0.0f,
+    0.849816859f, 0.0146520147f, 0.0f, 0.135531142f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.939271271f, 0.0161943324f, 0.0f, 0.0445344113f, 0.0f,
+    0.25f, 0.0f, 0.0f, 0.75f, 0.0f,
+    0.962343097f, 0.0167364012f, 0.0f, 0.020920502f, 0.0f,
+    0.973451316f, 0.017699115f, 0.0f, 0.00884955749f, 0.0f,
+    0.769230783f, 0.0f, 0.0f, 0.230769232f, 0.0f,
+    0.0600375235f, 0.48780489f, 0.452157587f, 0.0f, 0.0f,
+    0.0f, 0.00413223123f, 0.995867789f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.125f, 0.875f, 0.0f, 0.0f,
+    0.109965637f, 0.890034378f, 0.0f, 0.0f, 0.0f,
+    0.540540516f, 0.459459454f, 0.0f, 0.0f, 0.0f,
+    0.0909090936f, 0.909090936f, 0.0f, 0.0f, 0.0f,
+    0.730769217f, 0.269230783f, 0.0f, 0.0f, 0.0f,
+    0.894736826f, 0.105263159f, 0.0f, 0.0f, 0.0f,
+    0.285714298f, 0.714285731f, 0.0f, 0.0f, 0.0f,
+    0.0472440943f, 0.952755928f, 0.0f, 0.0f, 0.0f,
+    0.666666687f, 0.333333343f, 0.0f, 0.0f, 0.0f,
+    0.444444448f, 0.555555582f, 0.0f, 0.0f, 0.0f,
+    0.888888896f, 0.111111112f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    // Tree 14
+    0.200781256f, 0.212500006f, 0.20703125f, 0.202343747f, 0.177343756f,
+    0.0f, 0.00746268639f, 0.98880595f, 0.0037313432f, 0.0f,
+    0.0f, 0.00381679391f, 0.996183217f, 0.0f, 0.0f,
+    0.0f, 0.0119047621f, 0.988095224f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.166666672f, 0.833333313f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.166666672f, 0.666666687f, 0.166666672f, 0.0f,
+    0.253952563f, 0.266798407f, 0.0f, 0.254940718f, 0.224308297f,
+    0.338603437f, 0.0223978925f, 0.0f, 0.339920938f, 0.299077719f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.483082712f, 0.0319548883f, 0.0f, 0.484962404f, 0.0f,
+    0.0977777764f, 0.0177777782f, 0.0f, 0.884444416f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.785714269f, 0.142857149f, 0.0f, 0.0714285746f, 0.0f,
+    0.954545438f, 0.0454545468f, 0.0f, 0.0f, 0.0f,
+    0.166666672f, 0.5f, 0.0f, 0.333333343f, 0.0f,
+    0.765472293f, 0.042345278f, 0.0f, 0.192182407f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.89353615f, 0.0494296588f, 0.0f, 0.0570342205f, 0.0f,
+    0.200000003f, 0.0f, 0.0f, 0.800000012f, 0.0f,
+    0.906976759f, 0.0503875986f, 0.0f, 0.0426356606f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+};
+
+#endif // SOLAR_FAULT_MODEL_TABLE_H
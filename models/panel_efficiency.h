@@ -0,0 +1,32 @@
+/*
+ * Solar Panel Fault Detection - Panel Efficiency Feature
+ *
+ * The model's Efficiency input, for devices and datasets that only
+ * measure voltage, current and light. Same formula as the backend's
+ * calculate_efficiency() (lux * 0.0079 W/m2 over a 1.6 m2 panel, in
+ * percent, clipped to 0-25) without the rounding to two decimals.
+ * ml/step3_export_to_esp32.py mirrors it operation for operation in
+ * float32 (panel_efficiency()), so the golden classes of rows without an
+ * efficiency column hold on the device.
+ */
+
+#ifndef SOLAR_PANEL_EFFICIENCY_H
+#define SOLAR_PANEL_EFFICIENCY_H
+
+// Solar input in W per lux: 0.0079 W/m2 per lux x 1.6 m2, over 100 %
+#define PANEL_EFFICIENCY_SCALE 0.00012640000f
+#define PANEL_EFFICIENCY_MAX 25.0f
+
+// Efficiency in percent; 0 when there is no light
+inline float panel_efficiency(float voltage, float current, float light) {
+    float solar_input = light * PANEL_EFFICIENCY_SCALE;
+    if (solar_input <= 0.0f) {
+        return 0.0f;
+    }
+    float efficiency = voltage * current / solar_input;
+    if (efficiency < 0.0f) return 0.0f;
+    if (efficiency > PANEL_EFFICIENCY_MAX) return PANEL_EFFICIENCY_MAX;
+    return efficiency;
+}
+
+#endif // SOLAR_PANEL_EFFICIENCY_H
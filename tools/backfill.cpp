@@ -0,0 +1,783 @@
+/*
+ * Solar Panel Fault Detection - Historical Backfill Scorer
+ *
+ * Rescores archived telemetry with an exported model blob
+ * (models/solar_forest.bin, forest_blob.h) after every model change.
+ * Archives are mmap()ed and cut into chunks (1 MiB of CSV, or 64k binary
+ * records) that worker threads parse and score; each worker starts with a
+ * contiguous run of chunks and steals half of another worker's remaining
+ * run when its own is done, so slow regions do not hold up the others.
+ *
+ * Reports rows, throughput, per-thread work and steals, and a confusion
+ * matrix against the archive's fault_label column when it has one.
+ * Predictions are the blob's class probabilities argmax, as the backend's.
+ * Rows are scored FOREST_SIMD_LANES at a time with the AVX2 kernel of
+ * forest_simd.h when the CPU has AVX2 (checked at run time, same classes
+ * and probabilities), else one by one with forest_blob_predict_proba().
+ *
+ * Archives:
+ *   CSV     header row, features found by blob feature name or the
+ *           telemetry column names (voltage_v, current_a, ...); unquoted
+ *           fields only. Without an Efficiency column it is computed
+ *           from voltage, current and light (panel_efficiency.h). Rows
+ *           with a missing feature are skipped.
+ *   binary  written by --to-binary from a CSV: ArchiveHeader, then
+ *           float features[num_features] + int32 label per record, so a
+ *           rescore skips text parsing entirely
+ *
+ * Usage:
+ *   backfill [options] ARCHIVE...
+ *     --model PATH       model blob (default ../models/solar_forest.bin)
+ *     --threads N        worker threads (default: every core)
+ *     --columns A,B,..   CSV feature columns, in blob feature order
+ *     --label NAME       CSV label column (default fault_label)
+ *     --output PATH      write "prediction,confidence" per data row, in
+ *                        archive order (skipped rows stay empty)
+ *     --to-binary PATH   convert one CSV archive to a binary archive
+ *     --scaling          time 1, 2, 4 ... N threads and print the speedup
+ *     --scalar           score row by row even when AVX2 is available
+ *
+ * Build (from tools/, POSIX hosts):
+ *   g++ -O2 -std=c++11 -pthread -I../models backfill.cpp -o backfill
+ *   ./backfill --output labels.csv ../data/solar_data.csv
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "forest_blob_loader.h"
+#include "forest_simd.h"
+#include "panel_efficiency.h"
+
+#define BACKFILL_DEFAULT_MODEL "../models/solar_forest.bin"
+#define BACKFILL_CSV_CHUNK (1u << 20)
+#define BACKFILL_BINARY_CHUNK 65536
+#define BACKFILL_NAME_SIZE 32
+
+#define ARCHIVE_MAGIC 0x41544653u   // "SFTA"
+#define ARCHIVE_VERSION 1
+#define ARCHIVE_NO_LABEL -1
+
+// Binary archive header; labels index class_names, or are num_classes for
+// a label the converting model did not know
+struct ArchiveHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;
+    uint64_t num_rows;
+    uint8_t num_features;
+    uint8_t num_classes;
+    uint16_t reserved;
+    char feature_names[FOREST_MAX_FEATURES][BACKFILL_NAME_SIZE];
+    char class_names[FOREST_MAX_CLASSES][BACKFILL_NAME_SIZE];
+};
+
+// Telemetry column for each feature name (data/solar_data.csv)
+static const char* const TELEMETRY_COLUMNS[][2] = {
+    {"Voltage", "voltage_v"},
+    {"Current", "current_a"},
+    {"Temperature", "temperature_c"},
+    {"Light_Intensity", "light_lux"},
+};
+
+// CSV column roles
+#define COLUMN_IGNORED -1
+#define COLUMN_LABEL -2
+
+struct Options {
+    const char* model_path;
+    const char* output_path;
+    const char* binary_path;
+    const char* label_column;
+    std::vector<std::string> columns;
+    int threads;
+    bool scaling;
+    bool scalar;
+};
+
+// A mapped archive and how to read it
+struct Archive {
+    std::string path;
+    const char* data;
+    size_t size;
+    bool binary;
+    size_t body;                  // Offset of the first row or record
+    size_t num_chunks;
+    std::vector<int> roles;       // CSV: role of each column
+    int efficiency_feature;       // CSV: derived Efficiency feature, or -1
+    int efficiency_inputs[3];     // CSV: its voltage, current and light features
+    int label_map[FOREST_MAX_CLASSES + 1];  // Binary: archive label -> model class
+    int feature_map[FOREST_MAX_FEATURES];   // Binary: model feature -> archive column
+    size_t record_size;
+    uint64_t num_records;
+    int num_labels;               // Binary: class names in the archive header
+};
+
+// Per-chunk output, concatenated in chunk order once all are scored
+struct ChunkOutput {
+    std::string text;
+};
+
+// Per-worker counters
+struct WorkerStats {
+    uint64_t rows;
+    uint64_t skipped;
+    uint64_t chunks;
+    uint64_t steals;
+    uint64_t confusion[FOREST_MAX_CLASSES + 1][FOREST_MAX_CLASSES];  // [label][predicted]
+};
+
+// Chunk indices [begin, end) left to one worker, packed in one word so the
+// owner (taking from the front) and thieves (taking the back half) each
+// need a single compare-and-swap. The packed value is the whole state, so
+// a range that moves away and back is still taken correctly.
+struct alignas(64) WorkRange {
+    std::atomic<uint64_t> range;
+};
+
+static uint64_t work_pack(uint32_t begin, uint32_t end) {
+    return ((uint64_t)begin << 32) | end;
+}
+
+static bool work_take(WorkRange* own, uint32_t* chunk) {
+    uint64_t range = own->range.load(std::memory_order_acquire);
+    for (;;) {
+        uint32_t begin = (uint32_t)(range >> 32), end = (uint32_t)range;
+        if (begin >= end) return false;
+        if (own->range.compare_exchange_weak(range, work_pack(begin + 1, end), std::memory_order_acq_rel)) {
+            *chunk = begin;
+            return true;
+        }
+    }
+}
+
+static bool work_steal(WorkRange* victim, uint32_t* begin_out, uint32_t* end_out) {
+    uint64_t range = victim->range.load(std::memory_order_acquire);
+    for (;;) {
+        uint32_t begin = (uint32_t)(range >> 32), end = (uint32_t)range;
+        if (begin >= end) return false;
+        uint32_t middle = begin + (end - begin) / 2;
+        if (victim->range.compare_exchange_weak(range, work_pack(begin, middle), std::memory_order_acq_rel)) {
+            *begin_out = middle;
+            *end_out = end;
+            return true;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Archive mapping
+// ---------------------------------------------------------------------------
+
+static bool map_archive(const char* path, Archive* archive) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        std::fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        std::fprintf(stderr, "%s: empty archive\n", path);
+        return false;
+    }
+    archive->size = (size_t)info.st_size;
+    void* memory = mmap(NULL, archive->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        std::fprintf(stderr, "%s: mmap failed\n", path);
+        return false;
+    }
+    madvise(memory, archive->size, MADV_WILLNEED);
+    archive->path = path;
+    archive->data = (const char*)memory;
+    return true;
+}
+
+static void unmap_archive(Archive* archive) {
+    munmap(const_cast<char*>(archive->data), archive->size);
+}
+
+static std::vector<std::string> split_names(const char* begin, const char* end) {
+    std::vector<std::string> names;
+    const char* field = begin;
+    for (const char* p = begin; p <= end; p++) {
+        if (p == end || *p == ',') {
+            const char* last = p;
+            while (last > field && (last[-1] == '\r' || last[-1] == ' ')) last--;
+            names.push_back(std::string(field, last));
+            field = p + 1;
+        }
+    }
+    return names;
+}
+
+// Find the feature and label columns of a CSV archive
+static bool open_csv(const ForestBlob& blob, const Options& options, Archive* archive) {
+    const char* end = archive->data + archive->size;
+    const char* newline = (const char*)memchr(archive->data, '\n', archive->size);
+    const char* header_end = newline ? newline : end;
+    std::vector<std::string> header = split_names(archive->data, header_end);
+    archive->body = newline ? (size_t)(newline + 1 - archive->data) : archive->size;
+    archive->roles.assign(header.size(), COLUMN_IGNORED);
+    archive->efficiency_feature = -1;
+
+    for (int f = 0; f < blob.forest.num_features; f++) {
+        std::vector<std::string> candidates;
+        if (!options.columns.empty()) {
+            candidates.push_back(options.columns[f]);
+        } else {
+            candidates.push_back(blob.feature_names[f]);
+            for (size_t a = 0; a < sizeof(TELEMETRY_COLUMNS) / sizeof(TELEMETRY_COLUMNS[0]); a++) {
+                if (candidates[0] == TELEMETRY_COLUMNS[a][0]) candidates.push_back(TELEMETRY_COLUMNS[a][1]);
+            }
+        }
+        int column = -1;
+        for (size_t c = 0; c < candidates.size() && column < 0; c++) {
+            std::vector<std::string>::iterator it = std::find(header.begin(), header.end(), candidates[c]);
+            if (it != header.end()) column = (int)(it - header.begin());
+        }
+        if (column < 0 && options.columns.empty() && std::strcmp(blob.feature_names[f], "Efficiency") == 0) {
+            archive->efficiency_feature = f;
+            continue;
+        }
+        if (column < 0) {
+            std::fprintf(stderr, "%s: no column for feature %s\n", archive->path.c_str(), blob.feature_names[f]);
+            return false;
+        }
+        archive->roles[column] = f;
+    }
+
+    // Efficiency computed from the row, as the backend does
+    if (archive->efficiency_feature >= 0) {
+        static const char* const inputs[3] = {"Voltage", "Current", "Light_Intensity"};
+        for (int i = 0; i < 3; i++) {
+            archive->efficiency_inputs[i] = -1;
+            for (int f = 0; f < blob.forest.num_features; f++) {
+                if (std::strcmp(blob.feature_names[f], inputs[i]) == 0) archive->efficiency_inputs[i] = f;
+            }
+            if (archive->efficiency_inputs[i] < 0) {
+                std::fprintf(stderr, "%s: no column for feature Efficiency\n", archive->path.c_str());
+                return false;
+            }
+        }
+    }
+    std::vector<std::string>::iterator label = std::find(header.begin(), header.end(), options.label_column);
+    if (label != header.end()) archive->roles[label - header.begin()] = COLUMN_LABEL;
+
+    archive->binary = false;
+    archive->num_chunks = (archive->size - archive->body + BACKFILL_CSV_CHUNK - 1) / BACKFILL_CSV_CHUNK;
+    return true;
+}
+
+// Match a binary archive's features and labels to the model by name
+static bool open_binary(const ForestBlob& blob, Archive* archive) {
+    ArchiveHeader header;
+    std::memcpy(&header, archive->data, sizeof(header));
+    if (header.version != ARCHIVE_VERSION || header.header_size < sizeof(ArchiveHeader) ||
+        header.header_size > archive->size || header.num_features > FOREST_MAX_FEATURES ||
+        header.num_classes > FOREST_MAX_CLASSES) {
+        std::fprintf(stderr, "%s: unsupported binary archive\n", archive->path.c_str());
+        return false;
+    }
+    archive->record_size = (header.num_features + 1) * sizeof(float);
+    if ((archive->size - header.header_size) / archive->record_size < header.num_rows) {
+        std::fprintf(stderr, "%s: truncated binary archive\n", archive->path.c_str());
+        return false;
+    }
+    for (int f = 0; f < blob.forest.num_features; f++) {
+        archive->feature_map[f] = -1;
+        for (int c = 0; c < header.num_features; c++) {
+            if (strncmp(header.feature_names[c], blob.feature_names[f], BACKFILL_NAME_SIZE) == 0) {
+                archive->feature_map[f] = c;
+            }
+        }
+        if (archive->feature_map[f] < 0) {
+            std::fprintf(stderr, "%s: no column for feature %s\n", archive->path.c_str(), blob.feature_names[f]);
+            return false;
+        }
+    }
+    for (int l = 0; l <= header.num_classes; l++) {
+        archive->label_map[l] = blob.forest.num_classes;
+        for (int c = 0; l < header.num_classes && c < blob.forest.num_classes; c++) {
+            if (strncmp(header.class_names[l], blob.class_names[c], BACKFILL_NAME_SIZE) == 0) {
+                archive->label_map[l] = c;
+            }
+        }
+    }
+    archive->binary = true;
+    archive->body = header.header_size;
+    archive->num_records = header.num_rows;
+    archive->num_labels = header.num_classes;
+    archive->num_chunks = (header.num_rows + BACKFILL_BINARY_CHUNK - 1) / BACKFILL_BINARY_CHUNK;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Chunk scoring
+// ---------------------------------------------------------------------------
+
+struct Job {
+    const ForestBlob* blob;
+    const ForestSimd* simd;       // NULL: score row by row
+    const Archive* archive;
+    bool write_labels;            // Text predictions into outputs
+    bool write_records;           // Binary records into outputs (--to-binary)
+    std::vector<ChunkOutput>* outputs;
+};
+
+static bool parse_float(const char* begin, const char* end, float* value) {
+    char buffer[32];
+    size_t length = end - begin;
+    if (length == 0 || length >= sizeof(buffer)) return false;
+    std::memcpy(buffer, begin, length);
+    buffer[length] = '\0';
+    char* parsed;
+    *value = std::strtof(buffer, &parsed);
+    return parsed != buffer;
+}
+
+static int match_class(const ForestBlob& blob, const char* begin, const char* end) {
+    size_t length = end - begin;
+    for (int c = 0; c < blob.forest.num_classes; c++) {
+        if (strlen(blob.class_names[c]) == length && std::memcmp(blob.class_names[c], begin, length) == 0) return c;
+    }
+    return blob.forest.num_classes;
+}
+
+// Rows waiting to be scored together, in archive order
+struct RowBatch {
+    float features[FOREST_SIMD_LANES][FOREST_MAX_FEATURES];
+    int labels[FOREST_SIMD_LANES];
+    int count;
+};
+
+// Record one scored row
+static void record_row(const Job& job, int label, int predicted, const float* proba, WorkerStats* stats,
+                       std::string* out) {
+    if (label != ARCHIVE_NO_LABEL) stats->confusion[label][predicted]++;
+    if (job.write_labels) {
+        char line[64];
+        int length = std::snprintf(line, sizeof(line), "%s,%.3f\n", job.blob->forest.class_names[predicted],
+                                   proba[predicted]);
+        out->append(line, length);
+    }
+    stats->rows++;
+}
+
+// Score the batched rows with the AVX2 kernel and record them
+static void flush_rows(const Job& job, RowBatch* batch, WorkerStats* stats, std::string* out) {
+    if (batch->count == 0) return;
+    int predicted[FOREST_SIMD_LANES];
+    float proba[FOREST_SIMD_LANES][FOREST_MAX_CLASSES];
+    forest_simd_predict_proba(job.simd, batch->features[0], batch->count, predicted, proba[0]);
+    for (int r = 0; r < batch->count; r++) {
+        record_row(job, batch->labels[r], predicted[r], proba[r], stats, out);
+    }
+    batch->count = 0;
+}
+
+// Score one row, or queue it for the AVX2 kernel (or store it, for --to-binary)
+static void score_row(const Job& job, const float* features, int label, RowBatch* batch,
+                      WorkerStats* stats, std::string* out) {
+    const Forest& forest = job.blob->forest;
+    if (job.write_records) {
+        out->append((const char*)features, forest.num_features * sizeof(float));
+        int32_t stored = label;
+        out->append((const char*)&stored, sizeof(stored));
+        stats->rows++;
+        return;
+    }
+    if (!job.simd) {
+        float proba[FOREST_MAX_CLASSES];
+        int predicted = forest_blob_predict_proba(job.blob, features, proba);
+        record_row(job, label, predicted, proba, stats, out);
+        return;
+    }
+    std::memcpy(batch->features[batch->count], features, forest.num_features * sizeof(float));
+    batch->labels[batch->count] = label;
+    if (++batch->count == FOREST_SIMD_LANES) flush_rows(job, batch, stats, out);
+}
+
+// Rows whose first byte lies in this chunk's byte range
+static void score_csv_chunk(const Job& job, uint32_t chunk, WorkerStats* stats, std::string* out) {
+    const Archive& archive = *job.archive;
+    const char* data_end = archive.data + archive.size;
+    const char* p = archive.data + archive.body + (size_t)chunk * BACKFILL_CSV_CHUNK;
+    const char* chunk_end = std::min(p + BACKFILL_CSV_CHUNK, data_end);
+    if (chunk > 0 && p[-1] != '\n') {
+        const char* newline = (const char*)memchr(p, '\n', data_end - p);
+        p = newline ? newline + 1 : data_end;
+    }
+    int num_features = job.blob->forest.num_features;
+    int num_columns = (int)archive.roles.size();
+    RowBatch batch;
+    batch.count = 0;
+
+    while (p < chunk_end) {
+        const char* newline = (const char*)memchr(p, '\n', data_end - p);
+        const char* line_end = newline ? newline : data_end;
+        const char* next = newline ? newline + 1 : data_end;
+        if (line_end > p && line_end[-1] == '\r') line_end--;
+        if (line_end == p) {
+            p = next;
+            continue;
+        }
+
+        float features[FOREST_MAX_FEATURES];
+        int found = 0;
+        int label = ARCHIVE_NO_LABEL;
+        const char* field = p;
+        for (int column = 0; column < num_columns && field <= line_end; column++) {
+            const char* comma = (const char*)memchr(field, ',', line_end - field);
+            const char* field_end = comma ? comma : line_end;
+            int role = archive.roles[column];
+            if (role >= 0) {
+                found += parse_float(field, field_end, &features[role]);
+            } else if (role == COLUMN_LABEL && field_end > field) {
+                label = match_class(*job.blob, field, field_end);
+            }
+            field = field_end + 1;
+        }
+
+        if (archive.efficiency_feature >= 0 && found == num_features - 1) {
+            const int* in = archive.efficiency_inputs;
+            features[archive.efficiency_feature] = panel_efficiency(features[in[0]], features[in[1]], features[in[2]]);
+            found++;
+        }
+        if (found == num_features) {
+            score_row(job, features, label, &batch, stats, out);
+        } else {
+            stats->skipped++;
+            if (job.write_labels) {
+                flush_rows(job, &batch, stats, out);
+                out->push_back('\n');
+            }
+        }
+        p = next;
+    }
+    flush_rows(job, &batch, stats, out);
+}
+
+static void score_binary_chunk(const Job& job, uint32_t chunk, WorkerStats* stats, std::string* out) {
+    const Archive& archive = *job.archive;
+    uint64_t first = (uint64_t)chunk * BACKFILL_BINARY_CHUNK;
+    uint64_t last = std::min<uint64_t>(first + BACKFILL_BINARY_CHUNK, archive.num_records);
+    const char* record = archive.data + archive.body + first * archive.record_size;
+    int num_features = job.blob->forest.num_features;
+    int archive_features = (int)(archive.record_size / sizeof(float)) - 1;
+    RowBatch batch;
+    batch.count = 0;
+
+    for (uint64_t r = first; r < last; r++, record += archive.record_size) {
+        float stored[FOREST_MAX_FEATURES + 1];
+        std::memcpy(stored, record, archive.record_size);
+        float features[FOREST_MAX_FEATURES];
+        for (int f = 0; f < num_features; f++) features[f] = stored[archive.feature_map[f]];
+        int32_t label;
+        std::memcpy(&label, &stored[archive_features], sizeof(label));
+        if (label != ARCHIVE_NO_LABEL) label = archive.label_map[std::min<int32_t>(std::max<int32_t>(label, 0), archive.num_labels)];
+        score_row(job, features, label, &batch, stats, out);
+    }
+    flush_rows(job, &batch, stats, out);
+}
+
+static void worker_main(const Job& job, int id, std::vector<WorkRange>& ranges, WorkerStats* stats) {
+    int num_workers = (int)ranges.size();
+    WorkRange* own = &ranges[id];
+    for (;;) {
+        uint32_t chunk;
+        if (work_take(own, &chunk)) {
+            std::string* out = job.outputs ? &(*job.outputs)[chunk].text : NULL;
+            if (job.archive->binary) {
+                score_binary_chunk(job, chunk, stats, out);
+            } else {
+                score_csv_chunk(job, chunk, stats, out);
+            }
+            stats->chunks++;
+            continue;
+        }
+        bool stole = false;
+        for (int k = 1; k < num_workers && !stole; k++) {
+            uint32_t begin, end;
+            if (work_steal(&ranges[(id + k) % num_workers], &begin, &end)) {
+                own->range.store(work_pack(begin, end), std::memory_order_release);
+                stats->steals++;
+                stole = true;
+            }
+        }
+        if (!stole) return;
+    }
+}
+
+// Score every chunk of an archive on `num_threads` workers
+static double run_job(const Job& job, int num_threads, std::vector<WorkerStats>* stats) {
+    uint32_t num_chunks = (uint32_t)job.archive->num_chunks;
+    std::vector<WorkRange> ranges(num_threads);
+    for (int t = 0; t < num_threads; t++) {
+        ranges[t].range.store(work_pack((uint32_t)((uint64_t)num_chunks * t / num_threads),
+                                        (uint32_t)((uint64_t)num_chunks * (t + 1) / num_threads)));
+    }
+    stats->assign(num_threads, WorkerStats());
+    std::memset(&(*stats)[0], 0, num_threads * sizeof(WorkerStats));
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 1; t < num_threads; t++) {
+        workers.push_back(std::thread(worker_main, std::cref(job), t, std::ref(ranges), &(*stats)[t]));
+    }
+    worker_main(job, 0, ranges, &(*stats)[0]);
+    for (size_t t = 0; t < workers.size(); t++) workers[t].join();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// ---------------------------------------------------------------------------
+// Reports
+// ---------------------------------------------------------------------------
+
+static void print_confusion(const ForestBlob& blob, const WorkerStats& total) {
+    int num_classes = blob.forest.num_classes;
+    uint64_t labeled = 0, correct = 0;
+    for (int l = 0; l <= num_classes; l++) {
+        for (int c = 0; c < num_classes; c++) labeled += total.confusion[l][c];
+    }
+    if (labeled == 0) {
+        std::printf("\nNo labels, no confusion matrix\n");
+        return;
+    }
+    std::printf("\nConfusion matrix (rows: label, columns: prediction)\n%-18s", "");
+    for (int c = 0; c < num_classes; c++) std::printf("%16.15s", blob.class_names[c]);
+    std::printf("\n");
+    for (int l = 0; l <= num_classes; l++) {
+        uint64_t row = 0;
+        for (int c = 0; c < num_classes; c++) row += total.confusion[l][c];
+        if (l == num_classes && row == 0) break;
+        std::printf("%-18.17s", l < num_classes ? blob.class_names[l] : "(other label)");
+        for (int c = 0; c < num_classes; c++) std::printf("%16llu", (unsigned long long)total.confusion[l][c]);
+        std::printf("\n");
+        if (l < num_classes) correct += total.confusion[l][l];
+    }
+    std::printf("Accuracy: %.4f over %llu labeled rows\n", (double)correct / labeled, (unsigned long long)labeled);
+}
+
+static WorkerStats sum_stats(const std::vector<WorkerStats>& stats) {
+    WorkerStats total;
+    std::memset(&total, 0, sizeof(total));
+    for (size_t t = 0; t < stats.size(); t++) {
+        total.rows += stats[t].rows;
+        total.skipped += stats[t].skipped;
+        total.chunks += stats[t].chunks;
+        total.steals += stats[t].steals;
+        for (int l = 0; l <= FOREST_MAX_CLASSES; l++) {
+            for (int c = 0; c < FOREST_MAX_CLASSES; c++) total.confusion[l][c] += stats[t].confusion[l][c];
+        }
+    }
+    return total;
+}
+
+static void print_throughput(const Archive& archive, const std::vector<WorkerStats>& stats, double seconds) {
+    WorkerStats total = sum_stats(stats);
+    std::printf("%s: %s, %.1f MB, %zu chunks\n", archive.path.c_str(), archive.binary ? "binary" : "CSV",
+                archive.size / 1e6, archive.num_chunks);
+    std::printf("  %llu rows scored, %llu skipped in %.3f s: %.2f M rows/s, %.0f MB/s\n",
+                (unsigned long long)total.rows, (unsigned long long)total.skipped, seconds,
+                total.rows / seconds / 1e6, archive.size / seconds / 1e6);
+    for (size_t t = 0; t < stats.size(); t++) {
+        std::printf("  thread %2zu: %6llu chunks %10llu rows %4llu steals\n", t,
+                    (unsigned long long)stats[t].chunks, (unsigned long long)stats[t].rows,
+                    (unsigned long long)stats[t].steals);
+    }
+}
+
+// Same archive on 1, 2, 4 ... max_threads workers
+static void print_scaling(const Job& job, int max_threads) {
+    std::vector<WorkerStats> stats;
+    run_job(job, 1, &stats);   // Warm the page cache
+    std::printf("\nScaling on %s\n  threads    seconds   M rows/s   speedup   efficiency\n", job.archive->path.c_str());
+    double base = 0;
+    for (int threads = 1;; threads = std::min(threads * 2, max_threads)) {
+        double best = 1e30;
+        for (int r = 0; r < 3; r++) best = std::min(best, run_job(job, threads, &stats));
+        if (threads == 1) base = best;
+        std::printf("  %7d %10.3f %10.2f %9.2f %11.0f%%\n", threads, best, sum_stats(stats).rows / best / 1e6,
+                    base / best, 100.0 * base / best / threads);
+        if (threads == max_threads) break;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Main
+// ---------------------------------------------------------------------------
+
+static bool write_outputs(const char* path, const std::vector<ChunkOutput>& outputs, const std::string& prefix) {
+    FILE* file = std::fopen(path, "wb");
+    if (!file) {
+        std::fprintf(stderr, "%s: cannot write\n", path);
+        return false;
+    }
+    std::fwrite(prefix.data(), 1, prefix.size(), file);
+    for (size_t c = 0; c < outputs.size(); c++) {
+        std::fwrite(outputs[c].text.data(), 1, outputs[c].text.size(), file);
+    }
+    bool ok = !std::ferror(file);
+    return std::fclose(file) == 0 && ok;
+}
+
+static std::string binary_header(const ForestBlob& blob, uint64_t num_rows) {
+    ArchiveHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = ARCHIVE_MAGIC;
+    header.version = ARCHIVE_VERSION;
+    header.header_size = sizeof(ArchiveHeader);
+    header.num_rows = num_rows;
+    header.num_features = (uint8_t)blob.forest.num_features;
+    header.num_classes = (uint8_t)blob.forest.num_classes;
+    for (int f = 0; f < blob.forest.num_features; f++) {
+        std::strncpy(header.feature_names[f], blob.feature_names[f], BACKFILL_NAME_SIZE - 1);
+    }
+    for (int c = 0; c < blob.forest.num_classes; c++) {
+        std::strncpy(header.class_names[c], blob.class_names[c], BACKFILL_NAME_SIZE - 1);
+    }
+    return std::string((const char*)&header, sizeof(header));
+}
+
+static void usage() {
+    std::fprintf(stderr,
+                 "usage: backfill [--model PATH] [--threads N] [--columns A,B,..] [--label NAME]\n"
+                 "                [--output PATH] [--to-binary PATH] [--scaling] [--scalar] ARCHIVE...\n");
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    options.model_path = BACKFILL_DEFAULT_MODEL;
+    options.output_path = NULL;
+    options.binary_path = NULL;
+    options.label_column = "fault_label";
+    options.threads = (int)std::max(1u, std::thread::hardware_concurrency());
+    options.scaling = false;
+    options.scalar = false;
+    std::vector<const char*> paths;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--model" && has_value) {
+            options.model_path = argv[++i];
+        } else if (arg == "--threads" && has_value) {
+            options.threads = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--columns" && has_value) {
+            const char* value = argv[++i];
+            options.columns = split_names(value, value + std::strlen(value));
+        } else if (arg == "--label" && has_value) {
+            options.label_column = argv[++i];
+        } else if (arg == "--output" && has_value) {
+            options.output_path = argv[++i];
+        } else if (arg == "--to-binary" && has_value) {
+            options.binary_path = argv[++i];
+        } else if (arg == "--scaling") {
+            options.scaling = true;
+        } else if (arg == "--scalar") {
+            options.scalar = true;
+        } else if (arg.size() > 1 && arg[0] == '-') {
+            usage();
+            return 2;
+        } else {
+            paths.push_back(argv[i]);
+        }
+    }
+    if (paths.empty() || (options.binary_path && paths.size() != 1)) {
+        usage();
+        return 2;
+    }
+
+    ForestBlobStatus status;
+    ForestModelPtr model = forest_blob_map_file(options.model_path, &status);
+    if (!model) {
+        std::fprintf(stderr, "%s: %s\n", options.model_path, forest_blob_error(status));
+        return 1;
+    }
+    const ForestBlob& blob = model->blob;
+    if (!options.columns.empty() && (int)options.columns.size() != blob.forest.num_features) {
+        std::fprintf(stderr, "--columns needs %d names\n", blob.forest.num_features);
+        return 2;
+    }
+    ForestSimd simd;
+    bool use_simd = !options.scalar && forest_simd_prepare(&blob, &simd);
+    std::printf("Model %s: version %u, CRC-32 %08x, %d trees, %d classes; %d threads, %s\n\n", options.model_path,
+                blob.model_version, blob.checksum, blob.forest.num_trees, blob.forest.num_classes, options.threads,
+                use_simd ? "avx2 kernel" : "scalar");
+
+    std::vector<ChunkOutput> all_outputs;
+    WorkerStats grand_total;
+    std::memset(&grand_total, 0, sizeof(grand_total));
+    bool ok = true;
+
+    for (size_t a = 0; a < paths.size() && ok; a++) {
+        Archive archive;
+        if (!map_archive(paths[a], &archive)) return 1;
+        uint32_t magic = 0;
+        if (archive.size >= sizeof(ArchiveHeader)) std::memcpy(&magic, archive.data, sizeof(magic));
+        ok = magic == ARCHIVE_MAGIC ? open_binary(blob, &archive) : open_csv(blob, options, &archive);
+        if (ok && options.binary_path && archive.binary) {
+            std::fprintf(stderr, "%s: already a binary archive\n", paths[a]);
+            ok = false;
+        }
+        if (!ok) {
+            unmap_archive(&archive);
+            break;
+        }
+
+        std::vector<ChunkOutput> outputs(archive.num_chunks);
+        Job job;
+        job.blob = &blob;
+        job.simd = use_simd ? &simd : NULL;
+        job.archive = &archive;
+        job.write_labels = options.output_path != NULL;
+        job.write_records = options.binary_path != NULL;
+        job.outputs = (job.write_labels || job.write_records) ? &outputs : NULL;
+
+        std::vector<WorkerStats> stats;
+        double seconds = run_job(job, options.threads, &stats);
+        WorkerStats total = sum_stats(stats);
+
+        if (job.write_records) {
+            std::printf("%s: %llu records (%llu rows skipped) in %.3f s\n", paths[a],
+                        (unsigned long long)total.rows, (unsigned long long)total.skipped, seconds);
+            ok = write_outputs(options.binary_path, outputs, binary_header(blob, total.rows));
+            if (ok) std::printf("Wrote %s\n", options.binary_path);
+        } else {
+            print_throughput(archive, stats, seconds);
+            if (job.write_labels) {
+                for (size_t c = 0; c < outputs.size(); c++) {
+                    all_outputs.push_back(ChunkOutput());
+                    all_outputs.back().text.swap(outputs[c].text);
+                }
+            }
+            if (options.scaling) {
+                job.write_labels = false;
+                job.outputs = NULL;
+                print_scaling(job, options.threads);
+            }
+            std::vector<WorkerStats> pair(1, grand_total);
+            pair.push_back(total);
+            grand_total = sum_stats(pair);
+        }
+        unmap_archive(&archive);
+    }
+    if (!ok) return 1;
+    if (options.binary_path) return 0;
+
+    print_confusion(blob, grand_total);
+    if (options.output_path) {
+        if (!write_outputs(options.output_path, all_outputs, "prediction,confidence\n")) return 1;
+        std::printf("Wrote %s\n", options.output_path);
+    }
+    return 0;
+}